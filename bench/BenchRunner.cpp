@@ -0,0 +1,114 @@
+#include "BenchRunner.h"
+#include <QDateTime>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSysInfo>
+#include <QTextStream>
+#include <QDebug>
+#include <numeric>
+
+#ifndef RRTPLANNER_LIB_VERSION
+#define RRTPLANNER_LIB_VERSION "unknown"
+#endif
+
+volatile double BenchRunner::s_sink = 0.0;
+
+//----------
+BenchRunner::BenchRunner(int nSample, double minSampleTime_ms, const QString& filter, bool quick)
+    :m_nSample(std::max(nSample, 1)),
+      m_minSampleTime_ms(minSampleTime_ms),
+      m_filter(filter),
+      m_quick(quick)
+{
+    if(!m_filter.isValid()){
+        qWarning() << "[BenchRunner] Invalid filter" << filter << ":" << m_filter.errorString() << ". Running all cases.";
+        m_filter = QRegularExpression();
+    }
+}
+
+//----------
+bool BenchRunner::isEnabled(const QString& group, const QString& name) const
+{
+    if(m_filter.pattern().isEmpty()){
+        return(true);
+    }
+    return(m_filter.match(group + "/" + name).hasMatch());
+}
+
+//----------
+void BenchRunner::append(const QString& group, const QString& name, const QString& param,
+                         qint64 nIter, QVector<double>& nsPerIter)
+{
+    std::sort(nsPerIter.begin(), nsPerIter.end());
+    int n = nsPerIter.size();
+
+    BenchResult res;
+    res.group = group;
+    res.name = name;
+    res.param = param;
+    res.nIter = nIter;
+    res.nSample = n;
+    res.nsMin = nsPerIter.first();
+    res.nsMedian = (n % 2 == 1)? nsPerIter.at(n/2) : 0.5 * (nsPerIter.at(n/2 - 1) + nsPerIter.at(n/2));
+    res.nsMean = std::accumulate(nsPerIter.cbegin(), nsPerIter.cend(), 0.0) / n;
+    m_results.append(res);
+
+    qInfo().noquote() << QString("%1/%2 [%3] %4 us/iter (median of %5 x %6 iter)")
+                         .arg(group, name, param)
+                         .arg(res.nsMedian * 1e-3, 0, 'f', 3)
+                         .arg(n)
+                         .arg(nIter);
+}
+
+//----------
+QByteArray BenchRunner::toJson() const
+{
+    QJsonObject context;
+    context["library"] = "RrtPlannerLib";
+    context["version"] = RRTPLANNER_LIB_VERSION;
+    context["date"] = QDateTime::currentDateTimeUtc().toString(Qt::ISODate);
+    context["host"] = QSysInfo::machineHostName();
+    context["os"] = QSysInfo::prettyProductName();
+    context["cpu_arch"] = QSysInfo::currentCpuArchitecture();
+    context["qt_version"] = qVersion();
+    context["samples"] = m_nSample;
+    context["min_sample_time_ms"] = m_minSampleTime_ms;
+
+    QJsonArray results;
+    for(const BenchResult& res: m_results){
+        QJsonObject obj;
+        obj["group"] = res.group;
+        obj["name"] = res.name;
+        obj["param"] = res.param;
+        obj["iterations"] = static_cast<double>(res.nIter);
+        obj["samples"] = res.nSample;
+        obj["ns_min"] = res.nsMin;
+        obj["ns_median"] = res.nsMedian;
+        obj["ns_mean"] = res.nsMean;
+        results.append(obj);
+    }
+
+    QJsonObject root;
+    root["context"] = context;
+    root["results"] = results;
+    return(QJsonDocument(root).toJson(QJsonDocument::Indented));
+}
+
+//----------
+QByteArray BenchRunner::toCsv() const
+{
+    QByteArray out;
+    QTextStream ts(&out);
+    ts << "group,name,param,iterations,samples,ns_min,ns_median,ns_mean\n";
+    for(const BenchResult& res: m_results){
+        //param uses ';' as separator so that it needs no quoting
+        ts << res.group << "," << res.name << "," << res.param << ","
+           << res.nIter << "," << res.nSample << ","
+           << QString::number(res.nsMin, 'f', 1) << ","
+           << QString::number(res.nsMedian, 'f', 1) << ","
+           << QString::number(res.nsMean, 'f', 1) << "\n";
+    }
+    ts.flush();
+    return(out);
+}
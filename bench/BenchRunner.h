@@ -0,0 +1,148 @@
+/**
+ * @file BenchRunner.h
+ * @brief Minimal timing harness for the RrtPlannerLibBench executable.
+ *
+ * Each benchmark case is a callable executing one unit of work (e.g. one buildEllMap call or one getRootData query).
+ * The runner calibrates how many iterations fit in a sample of at least minSampleTime_ms, then times nSample such
+ * samples and records min/median/mean time per iteration. Results can be written as JSON or CSV so that they can be
+ * compared across releases and machines.
+ *
+ * @authors Enric Xargay Mata, ycw
+ * @date 2024-03-18
+ */
+
+#ifndef RRTPLANNER_LIB_BENCHRUNNER_H
+#define RRTPLANNER_LIB_BENCHRUNNER_H
+
+#include <QByteArray>
+#include <QElapsedTimer>
+#include <QRegularExpression>
+#include <QString>
+#include <QVector>
+#include <algorithm>
+
+/**
+ * @brief Result of a single benchmark case.
+ */
+struct BenchResult
+{
+    QString group;      /**< Component under test, e.g. "EllMap". */
+    QString name;       /**< Function under test, e.g. "buildEllMap". */
+    QString param;      /**< Parameter set, e.g. "nWaypt=500;crossTrackHorizon=1000". */
+    qint64 nIter{};     /**< Iterations per sample. */
+    int nSample{};      /**< Number of timed samples. */
+    double nsMin{};     /**< Fastest sample [ns/iteration]. */
+    double nsMedian{};  /**< Median sample [ns/iteration]. */
+    double nsMean{};    /**< Mean over all samples [ns/iteration]. */
+};
+
+/**
+ * @class BenchRunner
+ * @brief Runs benchmark cases and collects their results.
+ */
+class BenchRunner
+{
+public:
+    /**
+     * @brief Constructor.
+     * @param nSample Number of timed samples per case.
+     * @param minSampleTime_ms Minimum duration of one sample [ms]. Used to calibrate the iteration count.
+     * @param filter Regular expression matched against "group/name". Cases that do not match are skipped.
+     * An empty filter runs every case.
+     * @param quick If true, cases should restrict themselves to their smallest parameter sets.
+     */
+    BenchRunner(int nSample, double minSampleTime_ms, const QString& filter, bool quick);
+
+    /**
+     * @brief True if the given case is selected by the filter.
+     */
+    bool isEnabled(const QString& group, const QString& name) const;
+
+    /**
+     * @brief True if only the smallest parameter sets should be run.
+     */
+    bool quick() const { return(m_quick); }
+
+    /**
+     * @brief Times the given callable and appends its result.
+     * @param group Component under test.
+     * @param name Function under test.
+     * @param param Parameter set description.
+     * @param fn Callable executing one iteration. Takes no arguments.
+     */
+    template<typename Fn>
+    void run(const QString& group, const QString& name, const QString& param, Fn&& fn);
+
+    /**
+     * @brief Prevents the compiler from discarding a value computed by a benchmark case.
+     */
+    static void keep(double value) { s_sink = value; }
+
+    /**
+     * @brief Collected results, in the order the cases were run.
+     */
+    const QVector<BenchResult>& results() const { return(m_results); }
+
+    /**
+     * @brief Results as a JSON document, including a description of the host it ran on.
+     */
+    QByteArray toJson() const;
+
+    /**
+     * @brief Results as CSV with a header row.
+     */
+    QByteArray toCsv() const;
+
+private:
+    void append(const QString& group, const QString& name, const QString& param,
+                qint64 nIter, QVector<double>& nsPerIter);
+
+    int m_nSample;
+    double m_minSampleTime_ms;
+    QRegularExpression m_filter;
+    bool m_quick;
+    QVector<BenchResult> m_results;
+    static volatile double s_sink;
+};
+
+//----------
+template<typename Fn>
+void BenchRunner::run(const QString& group, const QString& name, const QString& param, Fn&& fn)
+{
+    if(!isEnabled(group, name)){
+        return;
+    }
+
+    QElapsedTimer timer;
+    qint64 minSampleTime_ns = static_cast<qint64>(m_minSampleTime_ms * 1e6);
+
+    //calibrate iterations per sample. Warms up caches as a side effect.
+    qint64 nIter = 1;
+    while(true){
+        timer.start();
+        for(qint64 i = 0; i < nIter; ++i){
+            fn();
+        }
+        qint64 elapsed = timer.nsecsElapsed();
+        if(elapsed >= minSampleTime_ns || nIter >= (qint64(1) << 30)){
+            break;
+        }
+        //aim slightly above the minimum sample time, at most x10 per step
+        double scale = elapsed > 0? 1.2 * minSampleTime_ns / elapsed : 10.0;
+        nIter = std::max(nIter + 1, static_cast<qint64>(nIter * std::min(scale, 10.0)));
+    }
+
+    QVector<double> nsPerIter;
+    nsPerIter.reserve(m_nSample);
+    for(int s = 0; s < m_nSample; ++s){
+        timer.start();
+        for(qint64 i = 0; i < nIter; ++i){
+            fn();
+        }
+        nsPerIter.append(static_cast<double>(timer.nsecsElapsed()) / nIter);
+    }
+
+    append(group, name, param, nIter, nsPerIter);
+}
+
+#endif // RRTPLANNER_LIB_BENCHRUNNER_H
@@ -0,0 +1,180 @@
+#include "EllMapBench.h"
+#include "BenchRunner.h"
+#include "TestScenario.h"
+#include <RrtPlannerLib/framework/EllMap.h>
+#include <RrtPlannerLib/framework/RootData.h>
+#include <RrtPlannerLib/framework/RootDataBatch.h>
+#include <RrtPlannerLib/framework/Vec2.h>
+#include <QDebug>
+#include <QThread>
+#include <algorithm>
+#include <random>
+
+using namespace rrtplanner::framework;
+
+//----------
+void EllMapBench::run(BenchRunner& runner)
+{
+    buildEllMap(runner);
+    getRootData(runner);
+    getRootDataBatch(runner);
+    locateSector(runner);
+}
+
+//----------
+void EllMapBench::buildEllMap(BenchRunner& runner)
+{
+    if(!runner.isEnabled("EllMap", "buildEllMap")){
+        return;
+    }
+
+    const QVector<int> nWayptList = runner.quick()? QVector<int>{20, 100} : QVector<int>{20, 100, 500, 2000};
+    const QVector<double> horizonList = runner.quick()? QVector<double>{1000.0} : QVector<double>{500.0, 1000.0, 2500.0};
+
+    for(int nWaypt: nWayptList){
+        const Plan planNominal = TestScenario::longRoute(nWaypt);
+        for(double crossTrackHorizon: horizonList){
+            EllMap ellMapRef;
+            if(!ellMapRef.buildEllMap(planNominal, crossTrackHorizon)){
+                qWarning() << "[EllMapBench::buildEllMap] buildEllMap failed. nWaypt =" << nWaypt;
+                continue;
+            }
+            QString param = QString("nWaypt=%1;crossTrackHorizon=%2;nPlan=%3")
+                    .arg(nWaypt).arg(crossTrackHorizon).arg(ellMapRef.size());
+
+            runner.run("EllMap", "buildEllMap", param, [&](){
+                EllMap ellMap;
+                bool ok = ellMap.buildEllMap(planNominal, crossTrackHorizon);
+                BenchRunner::keep(ok);
+            });
+        }
+    }
+}
+
+//----------
+void EllMapBench::getRootData(BenchRunner& runner)
+{
+    if(!runner.isEnabled("EllMap", "getRootData")){
+        return;
+    }
+
+    const QVector<int> nWayptList = runner.quick()? QVector<int>{10, 100} : QVector<int>{10, 100, 500};
+    const double crossTrackHorizon = 1000.0;
+    const double tickStep = 25.0;  //[m] ~ 2s at 12 m/s
+
+    for(int nWaypt: nWayptList){
+        const Plan planNominal = TestScenario::longRoute(nWaypt);
+        EllMap ellMap;
+        if(!ellMap.buildEllMap(planNominal, crossTrackHorizon)){
+            qWarning() << "[EllMapBench::getRootData] buildEllMap failed. nWaypt =" << nWaypt;
+            continue;
+        }
+
+        for(double crossTrack: {0.0, 300.0}){
+            const QVector<VectorF> ticks = TestScenario::ticksAlong(planNominal, tickStep, crossTrack);
+            QString param = QString("nWaypt=%1;crossTrackHorizon=%2;nPlan=%3;crossTrack=%4")
+                    .arg(nWaypt).arg(crossTrackHorizon).arg(ellMap.size()).arg(crossTrack);
+
+            //one iteration = one tick. rootData is carried over as the warm start, as in a control loop.
+            RootData rootData;
+            int idx = 0;
+            runner.run("EllMap", "getRootData", param, [&](){
+                bool ok = ellMap.getRootData(ticks.at(idx), rootData);
+                BenchRunner::keep(ok? rootData.ell() : -1.0);
+                idx = (idx + 1) % ticks.size();
+            });
+        }
+    }
+}
+
+//----------
+void EllMapBench::getRootDataBatch(BenchRunner& runner)
+{
+    if(!runner.isEnabled("EllMap", "getRootDataBatch")){
+        return;
+    }
+
+    const int nWaypt = 100;
+    const double crossTrackHorizon = 1000.0;
+    const Plan planNominal = TestScenario::longRoute(nWaypt);
+    EllMap ellMap;
+    if(!ellMap.buildEllMap(planNominal, crossTrackHorizon)){
+        qWarning() << "[EllMapBench::getRootDataBatch] buildEllMap failed. nWaypt =" << nWaypt;
+        return;
+    }
+
+    //positions along the route at several crosstracks, in track order (coherent) and shuffled (e.g. rrt samples)
+    QVector<Vec2> posNEList;
+    for(double crossTrack: {-600.0, -200.0, 0.0, 200.0, 600.0}){
+        for(const VectorF& tick: TestScenario::ticksAlong(planNominal, 10.0, crossTrack)){
+            posNEList.append(tick);
+        }
+    }
+    QVector<Vec2> posNEListShuffled(posNEList);
+    std::shuffle(posNEListShuffled.begin(), posNEListShuffled.end(), std::mt19937(1));
+
+    const QVector<int> nThreadList = runner.quick()? QVector<int>{1} : QVector<int>{1, 0};
+    for(int nThread: nThreadList){
+        for(bool isShuffled: {false, true}){
+            const QVector<Vec2>& posList = isShuffled? posNEListShuffled : posNEList;
+            QString param = QString("nWaypt=%1;nPos=%2;order=%3;nThread=%4")
+                    .arg(nWaypt).arg(posList.size()).arg(isShuffled? "shuffled" : "track")
+                    .arg(nThread == 0? QThread::idealThreadCount() : nThread);
+
+            //one iteration = one batch
+            RootDataBatch batch;
+            runner.run("EllMap", "getRootDataBatch", param, [&](){
+                int nFound = ellMap.getRootData(posList, batch, nThread);
+                BenchRunner::keep(nFound);
+            });
+        }
+    }
+}
+
+//----------
+void EllMapBench::locateSector(BenchRunner& runner)
+{
+    if(!runner.isEnabled("EllMap", "locateSector")){
+        return;
+    }
+
+    const QVector<int> nWayptList = runner.quick()? QVector<int>{10, 100} : QVector<int>{10, 100, 500};
+    const double crossTrackHorizon = 1000.0;
+    const double tickStep = 25.0;  //[m]
+
+    for(int nWaypt: nWayptList){
+        const Plan planNominal = TestScenario::longRoute(nWaypt);
+        EllMap ellMap;
+        if(!ellMap.buildEllMap(planNominal, crossTrackHorizon)){
+            qWarning() << "[EllMapBench::locateSector] buildEllMap failed. nWaypt =" << nWaypt;
+            continue;
+        }
+
+        //cold start: initial indices unrelated to the position, e.g. first tick or after a jump
+        const QVector<VectorF> ticks = TestScenario::ticksAlong(planNominal, tickStep, 300.0);
+        QString param = QString("nWaypt=%1;crossTrackHorizon=%2;nPlan=%3;start=cold")
+                .arg(nWaypt).arg(crossTrackHorizon).arg(ellMap.size());
+
+        int idx = 0;
+        runner.run("EllMap", "locateSector", param, [&](){
+            int planIdx, segIdx;
+            bool ok = ellMap.locateSector(ticks.at(idx), 0, 0, planIdx, segIdx);
+            BenchRunner::keep(ok? segIdx : -1);
+            idx = (idx + 1) % ticks.size();
+        });
+
+        //warm start: initial indices of the previous tick, as getRootData is called during transit
+        param = QString("nWaypt=%1;crossTrackHorizon=%2;nPlan=%3;start=warm")
+                .arg(nWaypt).arg(crossTrackHorizon).arg(ellMap.size());
+        idx = 0;
+        int planIdx_prev = -1, segIdx_prev = -1;
+        runner.run("EllMap", "locateSector", param, [&](){
+            int planIdx, segIdx;
+            bool ok = ellMap.locateSector(ticks.at(idx), planIdx_prev, segIdx_prev, planIdx, segIdx);
+            BenchRunner::keep(ok? segIdx : -1);
+            planIdx_prev = planIdx;
+            segIdx_prev = segIdx;
+            idx = (idx + 1) % ticks.size();
+        });
+    }
+}
@@ -0,0 +1,25 @@
+#ifndef RRTPLANNER_LIB_ELLMAPBENCH_H
+#define RRTPLANNER_LIB_ELLMAPBENCH_H
+
+class BenchRunner;
+
+/**
+ * @class EllMapBench
+ * @brief Benchmarks of EllMap::buildEllMap, EllMap::getRootData (single and batch) and EllMap::locateSector.
+ */
+class EllMapBench
+{
+public:
+    /**
+     * @brief Runs all EllMap cases selected by the runner.
+     */
+    static void run(BenchRunner& runner);
+
+private:
+    static void buildEllMap(BenchRunner& runner);
+    static void getRootData(BenchRunner& runner);
+    static void getRootDataBatch(BenchRunner& runner);
+    static void locateSector(BenchRunner& runner);
+};
+
+#endif // RRTPLANNER_LIB_ELLMAPBENCH_H
@@ -0,0 +1,100 @@
+#include "SMapBench.h"
+#include "BenchRunner.h"
+#include "TestScenario.h"
+#include <RrtPlannerLib/framework/EllMap.h>
+#include <RrtPlannerLib/framework/RootData.h>
+#include <RrtPlannerLib/framework/SMap.h>
+#include <RrtPlannerLib/framework/SMapHelper.h>
+#include <RrtPlannerLib/framework/SPlan.h>
+#include <RrtPlannerLib/framework/Segment.h>
+#include <QDebug>
+
+using namespace rrtplanner::framework;
+
+namespace {
+    //transit figures, same as SMapQTests
+    const double LH0 = 2500.0;      //[m]
+    const double TH0 = 375.0;       //[s]
+    const double UMIN = 7.7167;     //[m/s]
+    const double UMAX = 15.4333;    //[m/s]
+}
+
+//----------
+void SMapBench::run(BenchRunner& runner)
+{
+    reset(runner);
+    create(runner);
+}
+
+//----------
+void SMapBench::reset(BenchRunner& runner)
+{
+    if(!runner.isEnabled("SMap", "reset")){
+        return;
+    }
+
+    const QVector<int> nWayptList = runner.quick()? QVector<int>{10, 100} : QVector<int>{10, 100, 500};
+    const double crossTrackHorizon = 2500.0;
+    const double tickStep = 25.0;  //[m]
+
+    for(int nWaypt: nWayptList){
+        const Plan planNominal = TestScenario::longRoute(nWaypt);
+        EllMap ellMap;
+        if(!ellMap.buildEllMap(planNominal, crossTrackHorizon)){
+            qWarning() << "[SMapBench::reset] buildEllMap failed. nWaypt =" << nWaypt;
+            continue;
+        }
+        SMap sMap;
+        sMap.setEllMap(ellMap, LH0, TH0, UMIN, UMAX);
+
+        const QVector<VectorF> ticks = TestScenario::ticksAlong(planNominal, tickStep, 0.0);
+        QString param = QString("nWaypt=%1;crossTrackHorizon=%2;nPlan=%3")
+                .arg(nWaypt).arg(crossTrackHorizon).arg(ellMap.size());
+
+        //one iteration = one tick
+        int idx = 0;
+        runner.run("SMap", "reset", param, [&](){
+            bool ok = sMap.reset(ticks.at(idx));
+            BenchRunner::keep(ok? sMap.size() : -1);
+            idx = (idx + 1) % ticks.size();
+        });
+    }
+}
+
+//----------
+void SMapBench::create(BenchRunner& runner)
+{
+    if(!runner.isEnabled("SMapHelper", "create")){
+        return;
+    }
+
+    //the number of plans in the ell map grows with the crosstrack horizon
+    const int nWaypt = 100;
+    const QVector<double> horizonList = runner.quick()? QVector<double>{500.0, 2500.0}
+                                                      : QVector<double>{250.0, 500.0, 1000.0, 2500.0, 5000.0};
+    const Plan planNominal = TestScenario::longRoute(nWaypt);
+    const VectorF posNE(planNominal.segmentList().at(nWaypt/2).wayptPrev().coord_const_ref());
+
+    for(double crossTrackHorizon: horizonList){
+        EllMap ellMap;
+        if(!ellMap.buildEllMap(planNominal, crossTrackHorizon)){
+            qWarning() << "[SMapBench::create] buildEllMap failed. crossTrackHorizon =" << crossTrackHorizon;
+            continue;
+        }
+        RootData rootData;
+        if(!ellMap.getRootData(posNE, rootData)){
+            qWarning() << "[SMapBench::create] getRootData failed. crossTrackHorizon =" << crossTrackHorizon;
+            continue;
+        }
+        QString param = QString("nWaypt=%1;crossTrackHorizon=%2;nPlan=%3")
+                .arg(nWaypt).arg(crossTrackHorizon).arg(ellMap.size());
+
+        QList<SPlan> sPlanList;
+        int idxNominal = 0;
+        runner.run("SMapHelper", "create", param, [&](){
+            sPlanList.clear();
+            SMapHelper::create(ellMap, rootData, LH0, TH0, UMIN, UMAX, sPlanList, idxNominal);
+            BenchRunner::keep(sPlanList.size());
+        });
+    }
+}
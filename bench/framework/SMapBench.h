@@ -0,0 +1,23 @@
+#ifndef RRTPLANNER_LIB_SMAPBENCH_H
+#define RRTPLANNER_LIB_SMAPBENCH_H
+
+class BenchRunner;
+
+/**
+ * @class SMapBench
+ * @brief Benchmarks of SMap::reset and SMapHelper::create.
+ */
+class SMapBench
+{
+public:
+    /**
+     * @brief Runs all SMap cases selected by the runner.
+     */
+    static void run(BenchRunner& runner);
+
+private:
+    static void reset(BenchRunner& runner);
+    static void create(BenchRunner& runner);
+};
+
+#endif // RRTPLANNER_LIB_SMAPBENCH_H
@@ -0,0 +1,535 @@
+#include "GjkBench.h"
+#include "BenchRunner.h"
+#include "TestScenario.h"
+#include <RrtPlannerLib/framework/algorithm/gjk/ConvexPolygon.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/CSpaceObstacleSet.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/Gjk.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/GjkBatch.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/GjkFactory.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/GjkKernel.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/ObstacleSet.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/PointShape.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/Polygon.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/SignedDistanceGrid.h>
+#include <QMetaEnum>
+#include <QScopedPointer>
+#include <cmath>
+
+using namespace rrtplanner::framework;
+using namespace rrtplanner::framework::algorithm::gjk;
+
+//----------
+void GjkBench::run(BenchRunner& runner)
+{
+    runChkIntersect(runner);
+    runKernel(runner);
+    runConvexPolygon(runner);
+    runSeparation(runner);
+    runObstacleSet(runner);
+    runSweep(runner);
+    runCache(runner);
+    runBatch(runner);
+    runCSpace(runner);
+    runSdf(runner);
+}
+
+//----------
+void GjkBench::runChkIntersect(BenchRunner& runner)
+{
+    if(!runner.isEnabled("Gjk", "chkIntersect")){
+        return;
+    }
+
+    const QVector<int> nVertexList = runner.quick()? QVector<int>{4, 16} : QVector<int>{3, 4, 8, 16, 32, 64, 128};
+    const double radius = 10.0;
+    const QMetaEnum metaEnum = QMetaEnum::fromType<GjkFactory::GjkType>();
+
+    for(GjkFactory::GjkType gjkType: {GjkFactory::GjkType::Basic, GjkFactory::GjkType::MinDist, GjkFactory::GjkType::Epa}){
+        QScopedPointer<Gjk> p_gjk(GjkFactory::getGjk(gjkType));
+        QString typeName = metaEnum.valueToKey(static_cast<int>(gjkType));
+
+        for(int nVertex: nVertexList){
+            const Polygon polygon1 = TestScenario::regularPolygon(nVertex, radius, Vec2(0.0, 0.0));
+
+            //separated: centres 2.5 radii apart. overlapping: centres 0.5 radius apart.
+            for(double offset: {2.5 * radius, 0.5 * radius}){
+                const Polygon polygon2 = TestScenario::regularPolygon(nVertex, radius, Vec2(offset, 0.3 * radius));
+                QString param = QString("gjkType=%1;nVertex=%2;case=%3")
+                        .arg(typeName).arg(nVertex).arg(offset > 2.0 * radius? "separated" : "intersecting");
+
+                if(gjkType == GjkFactory::GjkType::Epa){ //contact incl. penetration depth
+                    runner.run("Gjk", "chkIntersect", param, [&](){
+                        GjkContact contact;
+                        bool intersect = p_gjk->chkContact(polygon1, polygon2, contact);
+                        BenchRunner::keep(intersect? contact.depth : contact.distance);
+                    });
+                    continue;
+                }
+                runner.run("Gjk", "chkIntersect", param, [&](){
+                    double distance;
+                    bool isValidDistance;
+                    bool intersect = p_gjk->chkIntersect(polygon1, polygon2, distance, isValidDistance);
+                    BenchRunner::keep(intersect? 0.0 : distance);
+                });
+            }
+        }
+    }
+}
+
+//----------
+void GjkBench::runKernel(BenchRunner& runner)
+{
+    if(!runner.isEnabled("Gjk", "kernel")){
+        return;
+    }
+
+    const QVector<int> nVertexList = runner.quick()? QVector<int>{4, 16} : QVector<int>{3, 4, 8, 16, 32, 64, 128};
+    const double radius = 10.0;
+    QScopedPointer<Gjk> p_gjk(GjkFactory::getGjk(GjkFactory::GjkType::MinDist));
+
+    //same pairs as chkIntersect: kernel on ConvexView vs virtual Gjk on Polygon
+    for(int nVertex: nVertexList){
+        const Polygon polygon1 = TestScenario::regularPolygon(nVertex, radius, Vec2(0.0, 0.0));
+        for(double offset: {2.5 * radius, 0.5 * radius}){
+            const Polygon polygon2 = TestScenario::regularPolygon(nVertex, radius, Vec2(offset, 0.3 * radius));
+            const QVector<Vec2>& vertexList1 = polygon1.vertexList_const_ref();
+            const QVector<Vec2>& vertexList2 = polygon2.vertexList_const_ref();
+            QString param = QString("nVertex=%1;case=%2").arg(nVertex).arg(offset > 2.0 * radius? "separated" : "intersecting");
+
+            runner.run("Gjk", "kernel", param + ";impl=virtual", [&](){
+                double distance;
+                bool isValidDistance;
+                bool isIntersect = p_gjk->chkIntersect(polygon1, polygon2, distance, isValidDistance);
+                BenchRunner::keep(isIntersect? 0.0 : distance);
+            });
+            runner.run("Gjk", "kernel", param + ";impl=template", [&](){
+                double distance;
+                bool isValidDistance;
+                bool isIntersect = intersectMinDist(ConvexView(vertexList1.constData(), vertexList1.size()),
+                                                    ConvexView(vertexList2.constData(), vertexList2.size()),
+                                                    distance, isValidDistance);
+                BenchRunner::keep(isIntersect? 0.0 : distance);
+            });
+        }
+    }
+
+    //point vs sector quad, the locateSector pattern before the SectorTable
+    const Polygon quad{Vec2(0.0, 0.0), Vec2(50.0, 2.0), Vec2(48.0, 12.0), Vec2(1.0, 10.0)};
+    const QVector<Vec2>& quadVertexList = quad.vertexList_const_ref();
+    for(const Vec2& pt: {Vec2(20.0, 5.0), Vec2(20.0, 30.0)}){
+        QString param = QString("nVertex=4;case=point_%1").arg(pt[1] < 12.0? "inside" : "outside");
+        const Polygon point{pt};
+        runner.run("Gjk", "kernel", param + ";impl=virtual", [&](){
+            double distance;
+            bool isValidDistance;
+            BenchRunner::keep(p_gjk->chkIntersect(point, quad, distance, isValidDistance)? 1.0 : 0.0);
+        });
+        runner.run("Gjk", "kernel", param + ";impl=template", [&](){
+            BenchRunner::keep(intersect(PointView(pt), ConvexView(quadVertexList.constData(), quadVertexList.size()))? 1.0 : 0.0);
+        });
+    }
+}
+
+//----------
+void GjkBench::runConvexPolygon(BenchRunner& runner)
+{
+    const QVector<int> nVertexList = runner.quick()? QVector<int>{16, 256} : QVector<int>{8, 16, 64, 256, 512};
+    const double radius = 10.0;
+
+    if(runner.isEnabled("Gjk", "support")){
+        //coherent: small rotation between queries as in GJK iterations. jump: unrelated directions.
+        for(int nVertex: nVertexList){
+            const Polygon polygon = TestScenario::regularPolygon(nVertex, radius, Vec2(0.0, 0.0));
+            const ConvexPolygon convexPolygon(polygon.vertexList_const_ref());
+            for(double dAngle: {0.05, 2.4}){
+                QString param = QString("nVertex=%1;case=%2").arg(nVertex).arg(dAngle < 1.0? "coherent" : "jump");
+                double angle = 0.0;
+                runner.run("Gjk", "support", param + ";shape=Polygon", [&](){
+                    angle += dAngle;
+                    BenchRunner::keep(polygon.support(Vec2(std::cos(angle), std::sin(angle)))[0]);
+                });
+                angle = 0.0;
+                runner.run("Gjk", "support", param + ";shape=ConvexPolygon", [&](){
+                    angle += dAngle;
+                    BenchRunner::keep(convexPolygon.support(Vec2(std::cos(angle), std::sin(angle)))[0]);
+                });
+            }
+        }
+    }
+
+    if(runner.isEnabled("Gjk", "chkIntersectConvex")){
+        QScopedPointer<Gjk> p_gjk(GjkFactory::getGjk(GjkFactory::GjkType::MinDist));
+        for(int nVertex: nVertexList){
+            const Polygon polygon1 = TestScenario::regularPolygon(nVertex, radius, Vec2(0.0, 0.0));
+            const ConvexPolygon convexPolygon1(polygon1.vertexList_const_ref());
+            for(double offset: {2.5 * radius, 0.5 * radius}){
+                const Polygon polygon2 = TestScenario::regularPolygon(nVertex, radius, Vec2(offset, 0.3 * radius));
+                const ConvexPolygon convexPolygon2(polygon2.vertexList_const_ref());
+                QString param = QString("nVertex=%1;case=%2").arg(nVertex).arg(offset > 2.0 * radius? "separated" : "intersecting");
+
+                runner.run("Gjk", "chkIntersectConvex", param + ";shape=Polygon", [&](){
+                    double distance;
+                    bool isValidDistance;
+                    bool isIntersect = p_gjk->chkIntersect(polygon1, polygon2, distance, isValidDistance);
+                    BenchRunner::keep(isIntersect? 0.0 : distance);
+                });
+                runner.run("Gjk", "chkIntersectConvex", param + ";shape=ConvexPolygon", [&](){
+                    double distance;
+                    bool isValidDistance;
+                    bool isIntersect = p_gjk->chkIntersect(convexPolygon1, convexPolygon2, distance, isValidDistance);
+                    BenchRunner::keep(isIntersect? 0.0 : distance);
+                });
+                runner.run("Gjk", "chkIntersectConvex", param + ";shape=ConvexPolygon;impl=template", [&](){
+                    double distance;
+                    bool isValidDistance;
+                    bool isIntersect = intersectMinDist(convexPolygon1, convexPolygon2, distance, isValidDistance);
+                    BenchRunner::keep(isIntersect? 0.0 : distance);
+                });
+            }
+        }
+    }
+}
+
+//----------
+void GjkBench::runSeparation(BenchRunner& runner)
+{
+    if(!runner.isEnabled("Gjk", "chkSeparation")){
+        return;
+    }
+
+    const QVector<int> nVertexList = runner.quick()? QVector<int>{4, 16} : QVector<int>{4, 16, 64};
+    const double radius = 10.0;
+    const double distanceMin = 50.0;
+    QScopedPointer<Gjk> p_gjk(GjkFactory::getGjk(GjkFactory::GjkType::MinDist));
+
+    //traffic screening: most pairs far beyond the clearance, some close to it
+    for(int nVertex: nVertexList){
+        const Polygon polygon1 = TestScenario::regularPolygon(nVertex, radius, Vec2(0.0, 0.0));
+        for(double offset: {2000.0, 75.0}){
+            const Polygon polygon2 = TestScenario::regularPolygon(nVertex, radius, Vec2(offset, 0.7 * offset));
+            QString param = QString("nVertex=%1;case=%2").arg(nVertex).arg(offset > 1000.0? "far" : "near");
+
+            runner.run("Gjk", "chkSeparation", param + ";impl=chkIntersect", [&](){
+                double distance;
+                bool isValidDistance;
+                bool isIntersect = p_gjk->chkIntersect(polygon1, polygon2, distance, isValidDistance);
+                BenchRunner::keep(!isIntersect && distance > distanceMin? 1.0 : 0.0);
+            });
+            runner.run("Gjk", "chkSeparation", param + ";impl=chkSeparation", [&](){
+                GjkContact contact;
+                BenchRunner::keep(p_gjk->chkSeparation(polygon1, polygon2, distanceMin, contact)? 1.0 : 0.0);
+            });
+        }
+    }
+}
+
+//----------
+void GjkBench::runObstacleSet(BenchRunner& runner)
+{
+    if(!runner.isEnabled("Gjk", "chkIntersectBatch")){
+        return;
+    }
+
+    const QVector<int> nObstacleList = runner.quick()? QVector<int>{1000} : QVector<int>{100, 1000, 4000};
+    const Polygon footprint{Vec2(-30.0, -6.0), Vec2(30.0, -6.0), Vec2(30.0, 6.0), Vec2(-30.0, 6.0)};
+    QScopedPointer<Gjk> p_gjk(GjkFactory::getGjk(GjkFactory::GjkType::MinDist));
+
+    //obstacles scattered 100 m apart, footprint among them
+    for(int nObstacle: nObstacleList){
+        int nSide = static_cast<int>(std::ceil(std::sqrt(static_cast<double>(nObstacle))));
+        QVector<Polygon> obstacleList;
+        ObstacleSet obstacleSet;
+        for(int k = 0; k < nObstacle; ++k){
+            Vec2 centre(100.0 * (k / nSide), 100.0 * (k % nSide));
+            obstacleList.append(TestScenario::regularPolygon(4 + k % 8, 10.0 + k % 20, centre));
+            obstacleSet.append(obstacleList.last());
+        }
+        Polygon query(footprint);
+        for(Vec2& vertex: query.vertexList()){
+            vertex += Vec2(50.0 * nSide, 50.0 * nSide);
+        }
+
+        for(double distanceMax: {0.0, 20.0}){
+            QString param = QString("nObstacle=%1;distanceMax=%2").arg(nObstacle).arg(distanceMax);
+
+            runner.run("Gjk", "chkIntersectBatch", param + ";impl=loop", [&](){
+                int nHit = 0;
+                for(const Polygon& obstacle: obstacleList){
+                    double distance;
+                    bool isValidDistance;
+                    nHit += p_gjk->chkIntersect(query, obstacle, distance, isValidDistance) || distance <= distanceMax;
+                }
+                BenchRunner::keep(nHit);
+            });
+            runner.run("Gjk", "chkIntersectBatch", param + ";impl=ObstacleSet", [&](){
+                QVector<int> hitIdxList;
+                QVector<double> distanceList;
+                BenchRunner::keep(obstacleSet.chkIntersect(query, hitIdxList, &distanceList, distanceMax));
+            });
+        }
+    }
+}
+
+//----------
+void GjkBench::runSweep(BenchRunner& runner)
+{
+    if(!runner.isEnabled("Gjk", "chkSweep")){
+        return;
+    }
+
+    //20 m x 6 m hull along a 100 m edge, turning 30 deg, past an obstacle 8 m abeam or onto it at 60 m
+    const Polygon footprint{Vec2(-10.0, -3.0), Vec2(10.0, -3.0), Vec2(10.0, 3.0), Vec2(-10.0, 3.0)};
+    const GjkPose poseStart{Vec2(0.0, 0.0), 0.0};
+    const GjkPose poseEnd{Vec2(100.0, 20.0), 30.0};
+    const double stepSample = 1.0; //[m]
+    const int nSample = static_cast<int>(std::ceil((poseEnd.position - poseStart.position).norm2() / stepSample));
+    QScopedPointer<Gjk> p_gjk(GjkFactory::getGjk(GjkFactory::GjkType::MinDist));
+
+    for(bool isHit: {false, true}){
+        const Polygon obstacle = TestScenario::regularPolygon(8, 5.0, isHit? Vec2(60.0, 12.0) : Vec2(50.0, -15.0));
+        QString param = QString("case=%1").arg(isHit? "hit" : "clear");
+
+        runner.run("Gjk", "chkSweep", param + QString(";impl=sampled%1m").arg(stepSample), [&](){
+            double timeContact = 1.0;
+            for(int i = 0; i <= nSample; ++i){
+                GjkPose pose = GjkPose::interpolate(poseStart, poseEnd, static_cast<double>(i) / nSample);
+                Polygon moved;
+                for(const Vec2& vertex: footprint.vertexList_const_ref()){
+                    moved.vertexList().append(pose.toWorld(vertex));
+                }
+                double distance;
+                bool isValidDistance;
+                if(p_gjk->chkIntersect(moved, obstacle, distance, isValidDistance)){
+                    timeContact = static_cast<double>(i) / nSample;
+                    break;
+                }
+            }
+            BenchRunner::keep(timeContact);
+        });
+        runner.run("Gjk", "chkSweep", param + ";impl=chkSweep", [&](){
+            double timeContact;
+            GjkContact contact;
+            p_gjk->chkSweep(footprint, poseStart, poseEnd, obstacle, timeContact, contact);
+            BenchRunner::keep(timeContact);
+        });
+    }
+}
+
+//----------
+void GjkBench::runCache(BenchRunner& runner)
+{
+    if(!runner.isEnabled("Gjk", "chkIntersectCached")){
+        return;
+    }
+
+    const QVector<int> nVertexList = runner.quick()? QVector<int>{4, 16} : QVector<int>{4, 16, 64};
+    const Polygon hull{Vec2(-10.0, -3.0), Vec2(10.0, -3.0), Vec2(10.0, 3.0), Vec2(-10.0, 3.0)};
+    const Vec2 stepPerTick(0.2, 0.05); //[m]
+    QScopedPointer<Gjk> p_gjk(GjkFactory::getGjk(GjkFactory::GjkType::Basic));
+
+    //control ticks: the hull creeps past the obstacles, which are checked again at every tick
+    for(int nVertex: nVertexList){
+        QVector<Polygon> obstacleList;
+        for(int i = 0; i < 16; ++i){
+            obstacleList.append(TestScenario::regularPolygon(nVertex, 5.0, Vec2(25.0 * (i % 4) + 20.0, 25.0 * (i / 4) - 30.0)));
+        }
+        QString param = QString("nVertex=%1;nObstacle=%2").arg(nVertex).arg(obstacleList.size());
+
+        for(bool isCached: {false, true}){
+            Polygon moved(hull);
+            GjkCache cache;
+            int tick = 0;
+            runner.run("Gjk", "chkIntersectCached", param + (isCached? ";impl=cached" : ";impl=chkIntersect"), [&](){
+                if(++tick % 500 == 0){
+                    moved = hull;
+                }
+                for(Vec2& vertex: moved.vertexList()){
+                    vertex += stepPerTick;
+                }
+                int nHit = 0;
+                for(int i = 0; i < obstacleList.size(); ++i){
+                    if(isCached){
+                        nHit += p_gjk->chkIntersectCached(moved, obstacleList.at(i), cache, i)? 1 : 0;
+                    }
+                    else{
+                        double distance;
+                        bool isValidDistance;
+                        nHit += p_gjk->chkIntersect(moved, obstacleList.at(i), distance, isValidDistance)? 1 : 0;
+                    }
+                }
+                BenchRunner::keep(nHit);
+            });
+        }
+    }
+}
+
+//----------
+void GjkBench::runBatch(BenchRunner& runner)
+{
+    if(!runner.isEnabled("Gjk", "GjkBatch")){
+        return;
+    }
+
+    const QVector<int> nPairList = runner.quick()? QVector<int>{1000} : QVector<int>{100, 1000, 4000};
+    const QString simd = GjkBatch::isAvx2()? "GjkBatchAvx2" : "GjkBatch";
+    QScopedPointer<Gjk> p_gjkBasic(GjkFactory::getGjk(GjkFactory::GjkType::Basic));
+    QScopedPointer<Gjk> p_gjkMinDist(GjkFactory::getGjk(GjkFactory::GjkType::MinDist));
+
+    //hull vs small obstacle pairs, e.g., the candidates of a planner expansion, about a third of them intersecting
+    for(int nPair: nPairList){
+        QVector<Polygon> shape1List, shape2List;
+        GjkBatch batch;
+        for(int i = 0; i < nPair; ++i){
+            Vec2 offset(15.0 * std::sin(1.3 * i), 15.0 * std::cos(0.7 * i));
+            shape1List.append(TestScenario::regularPolygon(4, 10.0, Vec2(0.0, 0.0)));
+            shape2List.append(TestScenario::regularPolygon(4 + i % 5, 3.0 + i % 4, offset));
+            batch.append(shape1List.last(), shape2List.last());
+        }
+        QString param = QString("nPair=%1").arg(nPair);
+
+        runner.run("Gjk", "GjkBatch", param + ";type=Basic;impl=loop", [&](){
+            int nHit = 0;
+            for(int i = 0; i < nPair; ++i){
+                double distance;
+                bool isValidDistance;
+                nHit += p_gjkBasic->chkIntersect(shape1List.at(i), shape2List.at(i), distance, isValidDistance)? 1 : 0;
+            }
+            BenchRunner::keep(nHit);
+        });
+        runner.run("Gjk", "GjkBatch", param + ";type=Basic;impl=" + simd, [&](){
+            QVector<bool> isIntersectList;
+            batch.chkIntersect(isIntersectList);
+            BenchRunner::keep(isIntersectList.count(true));
+        });
+        runner.run("Gjk", "GjkBatch", param + ";type=MinDist;impl=loop", [&](){
+            double distanceSum = 0.0;
+            for(int i = 0; i < nPair; ++i){
+                double distance;
+                bool isValidDistance;
+                p_gjkMinDist->chkIntersect(shape1List.at(i), shape2List.at(i), distance, isValidDistance);
+                distanceSum += isValidDistance? distance : 0.0;
+            }
+            BenchRunner::keep(distanceSum);
+        });
+        runner.run("Gjk", "GjkBatch", param + ";type=MinDist;impl=" + simd, [&](){
+            QVector<bool> isIntersectList;
+            QVector<double> distanceList;
+            QVector<bool> isValidDistanceList;
+            batch.chkIntersect(isIntersectList, distanceList, isValidDistanceList);
+            double distanceSum = 0.0;
+            for(double distance: distanceList){
+                distanceSum += distance;
+            }
+            BenchRunner::keep(distanceSum);
+        });
+    }
+}
+
+//----------
+void GjkBench::runCSpace(BenchRunner& runner)
+{
+    if(!runner.isEnabled("Gjk", "CSpace")){
+        return;
+    }
+
+    const QVector<int> nObstacleList = runner.quick()? QVector<int>{100} : QVector<int>{100, 1000};
+    const Polygon footprint{Vec2(-10.0, -3.0), Vec2(10.0, -3.0), Vec2(10.0, 3.0), Vec2(-10.0, 3.0)};
+    const int nPose = 1000;
+
+    //node validation: poses scattered over an obstacle field 100 m apart, as sampled by the planner
+    for(int nObstacle: nObstacleList){
+        int nSide = static_cast<int>(std::ceil(std::sqrt(static_cast<double>(nObstacle))));
+        ObstacleSet obstacleSet;
+        CSpaceObstacleSet cSpace(footprint.vertexList_const_ref());
+        for(int k = 0; k < nObstacle; ++k){
+            Polygon obstacle = TestScenario::regularPolygon(4 + k % 8, 10.0 + k % 20, Vec2(100.0 * (k / nSide), 100.0 * (k % nSide)));
+            obstacleSet.append(obstacle);
+            cSpace.append(obstacle);
+        }
+        QVector<GjkPose> poseList;
+        for(int i = 0; i < nPose; ++i){
+            poseList.append(GjkPose{Vec2(100.0 * nSide * std::fmod(0.618034 * i, 1.0),
+                                         100.0 * nSide * std::fmod(0.414214 * i, 1.0)), std::fmod(137.5 * i, 360.0)});
+        }
+        QString param = QString("nObstacle=%1;nPose=%2").arg(nObstacle).arg(nPose);
+
+        runner.run("Gjk", "CSpace", param + ";impl=ObstacleSet", [&](){
+            int nHit = 0;
+            QVector<int> hitIdxList;
+            Polygon moved(footprint);
+            for(const GjkPose& pose: poseList){
+                for(int j = 0; j < footprint.vertexList_const_ref().size(); ++j){
+                    moved.vertexList()[j] = pose.toWorld(footprint.vertexList_const_ref().at(j));
+                }
+                nHit += obstacleSet.chkIntersect(moved, hitIdxList) > 0? 1 : 0;
+            }
+            BenchRunner::keep(nHit);
+        });
+        runner.run("Gjk", "CSpace", param + ";impl=CSpaceObstacleSet", [&](){
+            int nHit = 0;
+            for(const GjkPose& pose: poseList){
+                nHit += cSpace.chkIntersect(pose)? 1 : 0;
+            }
+            BenchRunner::keep(nHit);
+        });
+    }
+}
+
+//----------
+void GjkBench::runSdf(BenchRunner& runner)
+{
+    if(!runner.isEnabled("Gjk", "SignedDistanceGrid")){
+        return;
+    }
+
+    const QVector<int> nObstacleList = runner.quick()? QVector<int>{100} : QVector<int>{100, 1000};
+    const double clearance = 20.0;
+    const double resolution = 1.0;
+    const int nSample = 1000;
+
+    //clearance of samples scattered over an obstacle field 100 m apart, as checked along candidate edges
+    for(int nObstacle: nObstacleList){
+        int nSide = static_cast<int>(std::ceil(std::sqrt(static_cast<double>(nObstacle))));
+        ObstacleSet obstacleSet;
+        for(int k = 0; k < nObstacle; ++k){
+            obstacleSet.append(TestScenario::regularPolygon(4 + k % 8, 10.0 + k % 20, Vec2(100.0 * (k / nSide), 100.0 * (k % nSide))));
+        }
+        QVector<Vec2> sampleList;
+        for(int i = 0; i < nSample; ++i){
+            sampleList.append(Vec2(100.0 * nSide * std::fmod(0.618034 * i, 1.0), 100.0 * nSide * std::fmod(0.414214 * i, 1.0)));
+        }
+        const Vec2 minNE(-50.0, -50.0), maxNE(100.0 * nSide + 50.0, 100.0 * nSide + 50.0);
+        SignedDistanceGrid sdf;
+        sdf.build(obstacleSet, minNE, maxNE, resolution, 2.0 * clearance);
+        QString param = QString("nObstacle=%1;nSample=%2;resolution=%3").arg(nObstacle).arg(nSample).arg(resolution);
+
+        runner.run("Gjk", "SignedDistanceGrid", param + ";impl=ObstacleSet", [&](){
+            int nClear = 0;
+            QVector<int> hitIdxList;
+            for(const Vec2& pt: sampleList){
+                nClear += obstacleSet.chkIntersect(PointShape(pt), hitIdxList, nullptr, clearance) == 0? 1 : 0;
+            }
+            BenchRunner::keep(nClear);
+        });
+        runner.run("Gjk", "SignedDistanceGrid", param + ";impl=SignedDistanceGrid", [&](){
+            //the grid decides the samples further than errorBound() from the clearance, ObstacleSet the others
+            int nClear = 0;
+            QVector<int> hitIdxList;
+            const double errorBound = sdf.errorBound();
+            for(const Vec2& pt: sampleList){
+                double distance = sdf.distance(pt);
+                if(std::abs(distance - clearance) > errorBound){
+                    nClear += distance > clearance? 1 : 0;
+                }
+                else{
+                    nClear += obstacleSet.chkIntersect(PointShape(pt), hitIdxList, nullptr, clearance) == 0? 1 : 0;
+                }
+            }
+            BenchRunner::keep(nClear);
+        });
+        runner.run("Gjk", "SignedDistanceGrid", param + ";impl=build", [&](){
+            SignedDistanceGrid grid;
+            BenchRunner::keep(grid.build(obstacleSet, minNE, maxNE, resolution, 2.0 * clearance));
+        });
+    }
+}
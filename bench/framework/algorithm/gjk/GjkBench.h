@@ -0,0 +1,37 @@
+#ifndef RRTPLANNER_LIB_GJKBENCH_H
+#define RRTPLANNER_LIB_GJKBENCH_H
+
+class BenchRunner;
+
+/**
+ * @class GjkBench
+ * @brief Benchmarks of Gjk::chkIntersect (chkContact for Epa) for each GjkType vs polygon vertex count, of the
+ * templated kernel in GjkKernel.h against the virtual implementation, of ConvexPolygon against the linear scan
+ * of Polygon, of the early-out clearance query chkSeparation, of the one-vs-many ObstacleSet query against a loop
+ * of chkIntersect, of the swept collision check chkSweep against sampled poses, of warm-started repeat queries
+ * through a GjkCache, of many independent pairs evaluated in lanes by GjkBatch against a loop of chkIntersect, of
+ * pose checks against precomputed C-space obstacles (CSpaceObstacleSet) against the ObstacleSet query, and of
+ * clearance checks through a SignedDistanceGrid, with exact confirmation near the boundary, against ObstacleSet.
+ */
+class GjkBench
+{
+public:
+    /**
+     * @brief Runs all Gjk cases selected by the runner.
+     */
+    static void run(BenchRunner& runner);
+
+private:
+    static void runChkIntersect(BenchRunner& runner);
+    static void runKernel(BenchRunner& runner);
+    static void runConvexPolygon(BenchRunner& runner);
+    static void runSeparation(BenchRunner& runner);
+    static void runObstacleSet(BenchRunner& runner);
+    static void runSweep(BenchRunner& runner);
+    static void runCache(BenchRunner& runner);
+    static void runBatch(BenchRunner& runner);
+    static void runCSpace(BenchRunner& runner);
+    static void runSdf(BenchRunner& runner);
+};
+
+#endif // RRTPLANNER_LIB_GJKBENCH_H
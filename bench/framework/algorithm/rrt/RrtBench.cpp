@@ -0,0 +1,188 @@
+#include "RrtBench.h"
+#include "BenchRunner.h"
+#include "TestScenario.h"
+#include <RrtPlannerLib/framework/SMap.h>
+#include <RrtPlannerLib/framework/vessel.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/ObstacleSet.h>
+#include <RrtPlannerLib/framework/algorithm/rrt/KdTree.h>
+#include <RrtPlannerLib/framework/algorithm/rrt/ParallelRrt.h>
+#include <RrtPlannerLib/framework/algorithm/rrt/RrtStar.h>
+#include <QDebug>
+#include <cmath>
+#include <limits>
+#include <random>
+
+using namespace rrtplanner::framework;
+using namespace rrtplanner::framework::algorithm::gjk;
+using namespace rrtplanner::framework::algorithm::rrt;
+
+namespace {
+    //arclength horizon of the transit figures of TestScenario::rrtProblem(), same as SMapQTests
+    const double LH0 = 2500.0;      //[m]
+    const double CROSS_TRACK_HORIZON = 500.0;   //[m]
+
+    //vessel on the 10th segment of the transit route, headed along it
+    bool transitProblem(SMap& sMap, Vessel& vessel)
+    {
+        const Plan planNominal = TestScenario::longRoute(100);
+        const Segment& segment = planNominal.segmentList().at(10);
+        if(!TestScenario::rrtProblem(planNominal, CROSS_TRACK_HORIZON, segment.wayptPrev().coord_const_ref(),
+                                     std::atan2(segment.tVec()[1], segment.tVec()[0]) * 180.0 / M_PI, sMap, vessel)){
+            qWarning() << "[RrtBench] The RRT problem could not be built.";
+            return(false);
+        }
+        return(true);
+    }
+
+    //obstacles on a regular grid over the SMap area ahead, clear of the vessel
+    ObstacleSet gridObstacles(int nObstacle, const Vec2& posNE)
+    {
+        ObstacleSet obstacleSet;
+        int nSide = static_cast<int>(std::ceil(std::sqrt(static_cast<double>(nObstacle))));
+        const Vec2 areaMin(posNE[0], posNE[1] - CROSS_TRACK_HORIZON);
+        const double spacingN = LH0 / std::max(nSide, 1), spacingE = 2.0 * CROSS_TRACK_HORIZON / std::max(nSide, 1);
+        for(int k = 0; k < nObstacle; ++k){
+            Vec2 centre = areaMin + Vec2((k / nSide + 0.5) * spacingN, (k % nSide + 0.5) * spacingE);
+            if((centre - posNE).norm2() > 100.0){
+                obstacleSet.append(TestScenario::regularPolygon(4 + k % 8, 0.2 * std::min(spacingN, spacingE), centre));
+            }
+        }
+        return(obstacleSet);
+    }
+}
+
+//----------
+void RrtBench::run(BenchRunner& runner)
+{
+    runRrtStar(runner);
+    runParallelRrt(runner);
+    runKdTree(runner);
+}
+
+//----------
+void RrtBench::runRrtStar(BenchRunner& runner)
+{
+    if(!runner.isEnabled("Rrt", "RrtStar")){
+        return;
+    }
+
+    const QVector<int> nIterationList = runner.quick()? QVector<int>{500} : QVector<int>{500, 2000};
+    const QVector<int> nObstacleList = runner.quick()? QVector<int>{0, 100} : QVector<int>{0, 100, 1000};
+
+    SMap sMap;
+    Vessel vessel;
+    if(!transitProblem(sMap, vessel)){
+        return;
+    }
+
+    for(int nObstacle: nObstacleList){
+        ObstacleSet obstacleSet = gridObstacles(nObstacle, vessel.posNE());
+        for(int nIteration: nIterationList){
+            RrtStar rrtStar;
+            rrtStar.setSMap(sMap);
+            rrtStar.setVessel(vessel);
+            rrtStar.setObstacleSet(obstacleSet);
+            rrtStar.setMaxIteration(nIteration);
+            QString param = QString("nIteration=%1;nObstacle=%2;crossTrackHorizon=%3")
+                    .arg(nIteration).arg(obstacleSet.size()).arg(CROSS_TRACK_HORIZON);
+
+            //one iteration = one solve
+            runner.run("Rrt", "RrtStar", param, [&](){
+                rrtStar.solve();
+                BenchRunner::keep(rrtStar.nNode());
+            });
+        }
+    }
+}
+
+//----------
+void RrtBench::runParallelRrt(BenchRunner& runner)
+{
+    if(!runner.isEnabled("Rrt", "ParallelRrt")){
+        return;
+    }
+
+    const int nIteration = 2000;
+    const int nObstacle = 1000;
+    const QVector<int> nThreadList = runner.quick()? QVector<int>{1, 2} : QVector<int>{1, 2, 4, 8, 16};
+
+    SMap sMap;
+    Vessel vessel;
+    if(!transitProblem(sMap, vessel)){
+        return;
+    }
+    ObstacleSet obstacleSet = gridObstacles(nObstacle, vessel.posNE());
+
+    for(int nThread: nThreadList){
+        ParallelRrt parallelRrt;
+        parallelRrt.setSMap(sMap);
+        parallelRrt.setVessel(vessel);
+        parallelRrt.setObstacleSet(obstacleSet);
+        parallelRrt.setMaxIteration(nIteration);
+        parallelRrt.setThreadCount(nThread);
+
+        //throughput of a first solve, in the parameters since the runner reports the time per solve
+        parallelRrt.solve();
+        QString param = QString("nThread=%1;nIteration=%2;nObstacle=%3;nodeRate=%4")
+                .arg(nThread).arg(nIteration).arg(obstacleSet.size()).arg(parallelRrt.nodeRate(), 0, 'f', 0);
+
+        //one iteration = one solve of nThread trees
+        runner.run("Rrt", "ParallelRrt", param, [&](){
+            parallelRrt.solve();
+            BenchRunner::keep(parallelRrt.nNode());
+        });
+    }
+}
+
+//----------
+void RrtBench::runKdTree(BenchRunner& runner)
+{
+    const bool runKdTree = runner.isEnabled("Rrt", "KdTreeNearest");
+    const bool runBruteForce = runner.isEnabled("Rrt", "BruteForceNearest");
+    if(!runKdTree && !runBruteForce){
+        return;
+    }
+
+    const QVector<int> nNodeList = runner.quick()? QVector<int>{1000} : QVector<int>{1000, 10000, 100000};
+
+    //nodes and queries uniform over a corridor of the SMap transit figures, 1000 m wide
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<double> unitDx(-500.0, 500.0);
+    std::uniform_real_distribution<double> unitEll(0.0, LH0);
+    QVector<std::array<double, 2>> queryList(1024);
+    for(std::array<double, 2>& query: queryList){
+        query = {unitDx(rng), unitEll(rng)};
+    }
+
+    for(int nNode: nNodeList){
+        KdTree<2> kdTree;
+        kdTree.reserve(nNode);
+        for(int k = 0; k < nNode; ++k){
+            kdTree.insert({unitDx(rng), unitEll(rng)});
+        }
+        QString param = QString("nNode=%1").arg(nNode);
+
+        //one iteration = one nearest node query
+        int k = 0;
+        if(runKdTree){
+            runner.run("Rrt", "KdTreeNearest", param, [&](){
+                BenchRunner::keep(kdTree.nearest(queryList.at(k++ & 1023)));
+            });
+        }
+        if(runBruteForce){
+            runner.run("Rrt", "BruteForceNearest", param, [&](){
+                const std::array<double, 2>& query = queryList.at(k++ & 1023);
+                int nearest = -1;
+                double distMin = std::numeric_limits<double>::max();
+                for(int idx = 0; idx < kdTree.size(); ++idx){
+                    double dist = kdTree.metric().distance(query, kdTree.point(idx));
+                    if(dist < distMin){
+                        distMin = dist;
+                        nearest = idx;
+                    }
+                }
+                BenchRunner::keep(nearest);
+            });
+        }
+    }
+}
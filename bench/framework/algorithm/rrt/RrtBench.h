@@ -0,0 +1,25 @@
+#ifndef RRTPLANNER_LIB_RRTBENCH_H
+#define RRTPLANNER_LIB_RRTBENCH_H
+
+class BenchRunner;
+
+/**
+ * @class RrtBench
+ * @brief Benchmarks of RrtStar::solve() on a transit route, vs the iteration budget and the number of obstacles, of
+ * ParallelRrt::solve() vs the number of threads, and of the KdTree nearest node lookup vs brute force.
+ */
+class RrtBench
+{
+public:
+    /**
+     * @brief Runs all Rrt cases selected by the runner.
+     */
+    static void run(BenchRunner& runner);
+
+private:
+    static void runRrtStar(BenchRunner& runner);
+    static void runParallelRrt(BenchRunner& runner);
+    static void runKdTree(BenchRunner& runner);
+};
+
+#endif // RRTPLANNER_LIB_RRTBENCH_H
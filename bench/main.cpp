@@ -0,0 +1,59 @@
+#include "BenchRunner.h"
+#include "EllMapBench.h"
+#include "SMapBench.h"
+#include "GjkBench.h"
+#include "RrtBench.h"
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QFile>
+#include <QDebug>
+#include <cstdio>
+
+int main(int argc, char* argv[])
+{
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName("RrtPlannerLibBench");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Benchmarks of the RrtPlannerLib hot paths (EllMap, SMap, Gjk, Rrt).");
+    parser.addHelpOption();
+    QCommandLineOption formatOption("format", "Output format: json or csv.", "format", "json");
+    QCommandLineOption outputOption({"o", "output"}, "Write results to <file> instead of stdout.", "file");
+    QCommandLineOption filterOption("filter", "Only run cases whose \"group/name\" matches <regex>.", "regex");
+    QCommandLineOption samplesOption("samples", "Timed samples per case.", "n", "5");
+    QCommandLineOption minTimeOption("min-time-ms", "Minimum duration of a sample [ms].", "ms", "200");
+    QCommandLineOption quickOption("quick", "Only run the smallest parameter sets.");
+    parser.addOptions({formatOption, outputOption, filterOption, samplesOption, minTimeOption, quickOption});
+    parser.process(app);
+
+    QString format = parser.value(formatOption).toLower();
+    if(format != "json" && format != "csv"){
+        qCritical() << "[RrtPlannerLibBench] Unknown format" << format << ". Use json or csv.";
+        return(1);
+    }
+
+    BenchRunner runner(parser.value(samplesOption).toInt(),
+                       parser.value(minTimeOption).toDouble(),
+                       parser.value(filterOption),
+                       parser.isSet(quickOption));
+
+    EllMapBench::run(runner);
+    SMapBench::run(runner);
+    GjkBench::run(runner);
+    RrtBench::run(runner);
+
+    QByteArray out = (format == "json")? runner.toJson() : runner.toCsv();
+    if(parser.isSet(outputOption)){
+        QFile file(parser.value(outputOption));
+        if(!file.open(QIODevice::WriteOnly | QIODevice::Truncate)){
+            qCritical() << "[RrtPlannerLibBench] Cannot open" << file.fileName() << ":" << file.errorString();
+            return(1);
+        }
+        file.write(out);
+    }
+    else{
+        fwrite(out.constData(), 1, out.size(), stdout);
+    }
+
+    return(0);
+}
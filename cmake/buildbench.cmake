@@ -0,0 +1,40 @@
+###Benchmarks#####
+#RrtPlannerLibBench times the hot paths of the library and writes the results as JSON or CSV, e.g.
+#   RrtPlannerLibBench --format csv -o bench.csv
+#   RrtPlannerLibBench --filter "EllMap/.*" --quick
+#Build in Release for meaningful numbers.
+
+add_executable(${PROJECT_NAME}Bench
+    bench/main.cpp
+    bench/BenchRunner.h
+    bench/BenchRunner.cpp
+    common/TestScenario.h
+    bench/framework/EllMapBench.h
+    bench/framework/EllMapBench.cpp
+    bench/framework/SMapBench.h
+    bench/framework/SMapBench.cpp
+    bench/framework/algorithm/gjk/GjkBench.h
+    bench/framework/algorithm/gjk/GjkBench.cpp
+    bench/framework/algorithm/rrt/RrtBench.h
+    bench/framework/algorithm/rrt/RrtBench.cpp
+    )
+
+target_include_directories(${PROJECT_NAME}Bench PRIVATE
+    ./
+    ./bench
+    ./common
+    ./bench/framework
+    ./bench/framework/algorithm/gjk
+    ./bench/framework/algorithm/rrt
+    ${Boost_INCLUDE_DIRS}
+    )
+
+target_compile_definitions(${PROJECT_NAME}Bench PRIVATE
+    RRTPLANNER_LIB_VERSION="${PROJECT_VERSION}"
+    )
+
+target_link_libraries(
+    ${PROJECT_NAME}Bench
+    Qt::Core
+    ${PROJECT_NAME}
+    )
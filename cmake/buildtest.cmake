@@ -18,14 +18,25 @@ find_package(Qt${QT_VERSION_MAJOR} COMPONENTS Test REQUIRED)
 
 add_executable(${PROJECT_NAME}QTests
     tests/main.cpp
+    common/TestScenario.h
     tests/framework/VectorFQTests.h
     tests/framework/VectorFQTests.cpp
+    tests/framework/Vec2QTests.h
+    tests/framework/Vec2QTests.cpp
+    tests/framework/Vec2HelperQTests.h
+    tests/framework/Vec2HelperQTests.cpp
     tests/framework/VectorFHelperQTests.h
     tests/framework/VectorFHelperQTests.cpp
     tests/framework/WayptQTests.h
     tests/framework/WayptQTests.cpp
     tests/framework/SegmentQTests.h
     tests/framework/SegmentQTests.cpp
+    tests/framework/SegmentArraysQTests.h
+    tests/framework/SegmentArraysQTests.cpp
+    tests/framework/SectorTableQTests.h
+    tests/framework/SectorTableQTests.cpp
+    tests/framework/SectorGridQTests.h
+    tests/framework/SectorGridQTests.cpp
     tests/framework/PlanQTests.h
     tests/framework/PlanQTests.cpp
     tests/framework/PlanHelperQTests.h
@@ -38,6 +49,8 @@ add_executable(${PROJECT_NAME}QTests
     tests/framework/SMapQTests.cpp
     tests/framework/SMapHelperQTests.h
     tests/framework/SMapHelperQTests.cpp
+    tests/framework/SMapSamplerQTests.h
+    tests/framework/SMapSamplerQTests.cpp
 
     tests/framework/VesRectangleQTests.h
     tests/framework/VesRectangleQTests.cpp
@@ -48,10 +61,27 @@ add_executable(${PROJECT_NAME}QTests
 
     tests/framework/algorithm/gjk/PolygonQTests.h
     tests/framework/algorithm/gjk/PolygonQTests.cpp
+    tests/framework/algorithm/gjk/ConvexPolygonQTests.h
+    tests/framework/algorithm/gjk/ConvexPolygonQTests.cpp
     tests/framework/algorithm/gjk/SimplexQTests.h
     tests/framework/algorithm/gjk/SimplexQTests.cpp
     tests/framework/algorithm/gjk/GjkQTests.h
     tests/framework/algorithm/gjk/GjkQTests.cpp
+    tests/framework/algorithm/gjk/ObstacleSetQTests.h
+    tests/framework/algorithm/gjk/ObstacleSetQTests.cpp
+    tests/framework/algorithm/gjk/GjkBatchQTests.h
+    tests/framework/algorithm/gjk/GjkBatchQTests.cpp
+    tests/framework/algorithm/gjk/CSpaceObstacleSetQTests.h
+    tests/framework/algorithm/gjk/CSpaceObstacleSetQTests.cpp
+    tests/framework/algorithm/gjk/SignedDistanceGridQTests.h
+    tests/framework/algorithm/gjk/SignedDistanceGridQTests.cpp
+
+    tests/framework/algorithm/rrt/KdTreeQTests.h
+    tests/framework/algorithm/rrt/KdTreeQTests.cpp
+    tests/framework/algorithm/rrt/RrtStarQTests.h
+    tests/framework/algorithm/rrt/RrtStarQTests.cpp
+    tests/framework/algorithm/rrt/ParallelRrtQTests.h
+    tests/framework/algorithm/rrt/ParallelRrtQTests.cpp
     )
 
 target_include_directories(${PROJECT_NAME}QTests PRIVATE
@@ -60,16 +90,19 @@ target_include_directories(${PROJECT_NAME}QTests PRIVATE
     ./incl/${PROJECT_NAME}/framework
     ./incl/${PROJECT_NAME}/framework/algorithm
     ./incl/${PROJECT_NAME}/framework/algorithm/gjk
+    ./incl/${PROJECT_NAME}/framework/algorithm/rrt
     ./incl/${PROJECT_NAME}/controllers
     ./incl/${PROJECT_NAME}/models
     ./pimpl/${PROJECT_NAME}/framework
     ./pimpl/${PROJECT_NAME}/framework/algorithm
     ./pimpl/${PROJECT_NAME}/controllers
     ./pimpl/${PROJECT_NAME}/models
+    ./common
     ./tests
     ./tests/framework
     ./tests/framework/algorithm
     ./tests/framework/algorithm/gjk
+    ./tests/framework/algorithm/rrt
     ./tests/controllers
     ./tests/models
     ${Boost_INCLUDE_DIRS}
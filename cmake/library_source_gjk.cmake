@@ -1,20 +1,38 @@
 #############################
 #add project files to our exe/lib
 set(LIBRARY_SOURCES_GJK
+  incl/${PROJECT_NAME}/framework/algorithm/gjk/GjkBatch.h
+  src/framework/algorithm/gjk/GjkBatch.cpp
+  incl/${PROJECT_NAME}/framework/algorithm/gjk/GjkCache.h
+  src/framework/algorithm/gjk/GjkCache.cpp
+  incl/${PROJECT_NAME}/framework/algorithm/gjk/GjkContact.h
   incl/${PROJECT_NAME}/framework/algorithm/gjk/GjkDefines.h
+  incl/${PROJECT_NAME}/framework/algorithm/gjk/GjkPose.h
   incl/${PROJECT_NAME}/framework/algorithm/gjk/GjkFactory.h
   src/framework/algorithm/gjk/GjkFactory.cpp
   incl/${PROJECT_NAME}/framework/algorithm/gjk/Gjk.h
   src/framework/algorithm/gjk/Gjk.cpp
+  incl/${PROJECT_NAME}/framework/algorithm/gjk/ConvexPolygon.h
+  src/framework/algorithm/gjk/ConvexPolygon.cpp
+  incl/${PROJECT_NAME}/framework/algorithm/gjk/CSpaceObstacleSet.h
+  src/framework/algorithm/gjk/CSpaceObstacleSet.cpp
+  incl/${PROJECT_NAME}/framework/algorithm/gjk/GjkKernel.h
   incl/${PROJECT_NAME}/framework/algorithm/gjk/IShape.h
+  incl/${PROJECT_NAME}/framework/algorithm/gjk/ObstacleSet.h
+  src/framework/algorithm/gjk/ObstacleSet.cpp
   incl/${PROJECT_NAME}/framework/algorithm/gjk/PointShape.h
   src/framework/algorithm/gjk/PointShape.cpp
   incl/${PROJECT_NAME}/framework/algorithm/gjk/Polygon.h
   src/framework/algorithm/gjk/Polygon.cpp
+  incl/${PROJECT_NAME}/framework/algorithm/gjk/SignedDistanceGrid.h
+  src/framework/algorithm/gjk/SignedDistanceGrid.cpp
+  incl/${PROJECT_NAME}/framework/algorithm/gjk/internal/ConvexHull.h
   incl/${PROJECT_NAME}/framework/algorithm/gjk/internal/GjkBasic.h
   src/framework/algorithm/gjk/internal/GjkBasic.cpp
   incl/${PROJECT_NAME}/framework/algorithm/gjk/internal/GjkMinDist.h
   src/framework/algorithm/gjk/internal/GjkMinDist.cpp
+  incl/${PROJECT_NAME}/framework/algorithm/gjk/internal/GjkEpa.h
+  src/framework/algorithm/gjk/internal/GjkEpa.cpp
 
 
   incl/${PROJECT_NAME}/framework/algorithm/gjk/internal/GjkComponentFactory.h
@@ -30,10 +48,13 @@ set(LIBRARY_SOURCES_GJK
   src/framework/algorithm/gjk/internal/SimplexBasic.cpp
   incl/${PROJECT_NAME}/framework/algorithm/gjk/internal/SimplexMinDist.h
   src/framework/algorithm/gjk/internal/SimplexMinDist.cpp
+  incl/${PROJECT_NAME}/framework/algorithm/gjk/internal/SimplexKernel.h
   incl/${PROJECT_NAME}/framework/algorithm/gjk/internal/Support.h
   src/framework/algorithm/gjk/internal/Support.cpp
   incl/${PROJECT_NAME}/framework/algorithm/gjk/internal/SupportBasic.h
   src/framework/algorithm/gjk/internal/SupportBasic.cpp
   incl/${PROJECT_NAME}/framework/algorithm/gjk/internal/SupportMinDist.h
   src/framework/algorithm/gjk/internal/SupportMinDist.cpp
+  incl/${PROJECT_NAME}/framework/algorithm/gjk/internal/SupportLanes.h
+  src/framework/algorithm/gjk/internal/SupportLanes.cpp
 )
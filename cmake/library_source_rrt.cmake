@@ -0,0 +1,12 @@
+#############################
+#add project files to our exe/lib
+set(LIBRARY_SOURCES_RRT
+  incl/${PROJECT_NAME}/framework/algorithm/rrt/KdTree.h
+  incl/${PROJECT_NAME}/framework/algorithm/rrt/ParallelRrt.h
+  src/framework/algorithm/rrt/ParallelRrt.cpp
+  incl/${PROJECT_NAME}/framework/algorithm/rrt/internal/InformedSampling.h
+  src/framework/algorithm/rrt/internal/InformedSampling.cpp
+  incl/${PROJECT_NAME}/framework/algorithm/rrt/RrtDefines.h
+  incl/${PROJECT_NAME}/framework/algorithm/rrt/RrtStar.h
+  src/framework/algorithm/rrt/RrtStar.cpp
+)
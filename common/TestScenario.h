@@ -0,0 +1,145 @@
+/**
+ * @file TestScenario.h
+ * @brief Synthetic inputs shared by the QTests and the benchmark cases. It lives in common/, on the include path of
+ * both executables, so that neither depends on the other's tree.
+ *
+ * The route generator produces a transit-like zig-zag plan heading north with an irregular east offset, so that
+ * every waypt has a bisector and edge events occur at varying crosstracks. The tick generator samples positions
+ * along the nominal plan the way a usv would report them during transit. The RRT problem sets up the SMap and the
+ * vessel the RrtStar and ParallelRrt tests and benchmarks plan from.
+ *
+ * @authors Enric Xargay Mata, ycw
+ * @date 2024-03-18
+ */
+
+#ifndef RRTPLANNER_LIB_TESTSCENARIO_H
+#define RRTPLANNER_LIB_TESTSCENARIO_H
+
+#include <RrtPlannerLib/framework/EllMap.h>
+#include <RrtPlannerLib/framework/Plan.h>
+#include <RrtPlannerLib/framework/SMap.h>
+#include <RrtPlannerLib/framework/Segment.h>
+#include <RrtPlannerLib/framework/VesRectangle.h>
+#include <RrtPlannerLib/framework/Waypt.h>
+#include <RrtPlannerLib/framework/VectorF.h>
+#include <RrtPlannerLib/framework/Vec2.h>
+#include <RrtPlannerLib/framework/vessel.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/Polygon.h>
+#include <QSharedPointer>
+#include <QVector>
+#include <cmath>
+#include <math.h> //for M_PI
+
+/**
+ * @class TestScenario
+ * @brief Generators of synthetic plans, positions and shapes for tests and benchmarks.
+ */
+class TestScenario
+{
+public:
+    /**
+     * @brief Transit route of nWaypt waypts, 300m apart in northing.
+     */
+    static rrtplanner::framework::Plan longRoute(int nWaypt)
+    {
+        using namespace rrtplanner::framework;
+        QVector<Waypt> wayptList;
+        for(int i = 0; i < nWaypt; ++i){
+            double northing = 300.0 * i;
+            double easting = 400.0 * std::sin(0.7 * i) + 150.0 * std::sin(2.3 * i);
+            wayptList.append(Waypt{northing, easting, 0.0, i});
+        }
+        Plan plan;
+        plan.setPlan(wayptList, 0);
+        return(plan);
+    }
+
+    /**
+     * @brief Nominal route of the RRT tests: 5 waypts over 4km, with a 1km dog-leg to the east.
+     */
+    static rrtplanner::framework::Plan rrtRoute()
+    {
+        using namespace rrtplanner::framework;
+        Plan plan;
+        plan.setPlan(QVector<Waypt>{Waypt{0.0, 0.0, 0.0, 0},
+                                    Waypt{1000.0, 1000.0, 0.0, 1},
+                                    Waypt{2000.0, 1000.0, 0.0, 2},
+                                    Waypt{3000.0, 0.0, 0.0, 3},
+                                    Waypt{4000.0, 0.0, 0.0, 4}},
+                     0);
+        plan.setProperty(Plan::Property::IS_NOMINAL);
+        return(plan);
+    }
+
+    /**
+     * @brief RRT problem: the SMap of the transit figures (lh0 2500m, th0 375s, 15-30kn) over the EllMap of
+     * planNominal, reset at the vessel, a 20m x 8m VesRectangle at posNE with heading hdg_deg.
+     * @return False if the EllMap or the SMap could not be built.
+     */
+    static bool rrtProblem(const rrtplanner::framework::Plan& planNominal, double crossTrackHorizon,
+                           const rrtplanner::framework::VectorF& posNE, double hdg_deg,
+                           rrtplanner::framework::SMap& sMap, rrtplanner::framework::Vessel& vessel)
+    {
+        using namespace rrtplanner::framework;
+        EllMap ellMap;
+        if(!ellMap.buildEllMap(planNominal, crossTrackHorizon)){
+            return(false);
+        }
+        sMap.setEllMap(ellMap, 2500.0, 375.0, 7.7167, 15.4333);
+
+        VesRectangle* p_rectangle = new VesRectangle(RRT_VES_LENGTH, RRT_VES_WIDTH);
+        p_rectangle->setOffset(VectorF{0.0, 0.0});
+        vessel = Vessel(posNE, 0.0, VectorF{0.0, 0.0}, hdg_deg);
+        vessel.setVesShape(QSharedPointer<VesShape>(p_rectangle));
+        return(sMap.reset(vessel.posNE()));
+    }
+
+    static constexpr double RRT_VES_LENGTH = 20.0;  //[m] footprint of the RRT problem vessel
+    static constexpr double RRT_VES_WIDTH = 8.0;    //[m]
+
+    /**
+     * @brief Positions along the plan every step metres, offset by crossTrack along the segment normal.
+     */
+    static QVector<rrtplanner::framework::VectorF> ticksAlong(const rrtplanner::framework::Plan& plan,
+                                                              double step, double crossTrack)
+    {
+        using namespace rrtplanner::framework;
+        QVector<VectorF> ticks;
+        for(const Segment& seg: plan.segmentList()){
+            const Vec2& start = seg.wayptPrev().coord_const_ref();
+            for(double s = 0.0; s < seg.length(); s += step){
+                ticks.append(VectorF(start + s * seg.tVec() + crossTrack * seg.nVec()));
+            }
+        }
+        return(ticks);
+    }
+
+    /**
+     * @brief Regular polygon with nVertex vertices, the first one at angle phase [rad].
+     */
+    static rrtplanner::framework::algorithm::gjk::Polygon regularPolygon(int nVertex, double radius,
+                                                                         const rrtplanner::framework::Vec2& centre,
+                                                                         double phase = 0.0)
+    {
+        return(ellipsePolygon(nVertex, radius, radius, centre, phase));
+    }
+
+    /**
+     * @brief Convex polygon of nVertex vertices on an ellipse of semi-axes a (northing) and b (easting), the first
+     * one at angle phase [rad].
+     */
+    static rrtplanner::framework::algorithm::gjk::Polygon ellipsePolygon(int nVertex, double a, double b,
+                                                                         const rrtplanner::framework::Vec2& centre,
+                                                                         double phase = 0.0)
+    {
+        using namespace rrtplanner::framework;
+        algorithm::gjk::Polygon polygon;
+        for(int i = 0; i < nVertex; ++i){
+            double theta = 2.0 * M_PI * i / nVertex + phase;
+            polygon.vertexList().append(centre + Vec2(a * std::cos(theta), b * std::sin(theta)));
+        }
+        return(polygon);
+    }
+};
+
+#endif // RRTPLANNER_LIB_TESTSCENARIO_H
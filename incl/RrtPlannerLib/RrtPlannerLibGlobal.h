@@ -9,7 +9,7 @@
 #  define RRTPLANNER_LIB_EXPORT Q_DECL_IMPORT
 #endif
 
-#if defined(BUILD_TESTING_ON)
+#if defined(BUILD_TESTING_ON) || defined(BUILD_BENCHMARK_ON)
 #  define RRTPLANNER_LIB_EXPORT_FOR_BUILDTEST Q_DECL_EXPORT
 #else
 #  define RRTPLANNER_LIB_EXPORT_FOR_BUILDTEST Q_DECL_IMPORT
@@ -19,6 +19,7 @@
 #define FRAMEWORK_NAMESPACE     framework
 #define ALGORITHM_NAMESPACE     algorithm
 #define GJK_NAMESPACE           gjk
+#define RRT_NAMESPACE           rrt
 
 #define RRTPLANNER_BEGIN_NAMESPACE namespace RRTPLANNER_NAMESPACE{
 #define RRTPLANNER_END_NAMESPACE };
@@ -32,5 +33,8 @@
 #define RRTPLANNER_FRAMEWORK_ALGORITHM_GJK_BEGIN_NAMESPACE  namespace RRTPLANNER_NAMESPACE::FRAMEWORK_NAMESPACE::ALGORITHM_NAMESPACE::GJK_NAMESPACE{
 #define RRTPLANNER_FRAMEWORK_ALGORITHM_GJK_END_NAMESPACE };
 
+#define RRTPLANNER_FRAMEWORK_ALGORITHM_RRT_BEGIN_NAMESPACE  namespace RRTPLANNER_NAMESPACE::FRAMEWORK_NAMESPACE::ALGORITHM_NAMESPACE::RRT_NAMESPACE{
+#define RRTPLANNER_FRAMEWORK_ALGORITHM_RRT_END_NAMESPACE };
+
 
 #endif // RRPLANNER_LIB_GLOBAL_H
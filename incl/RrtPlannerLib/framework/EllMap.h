@@ -14,6 +14,8 @@
 #include <RrtPlannerLib/RrtPlannerLibGlobal.h>
 #include <RrtPlannerLib/framework/Plan.h>
 #include <RrtPlannerLib/framework/RootData.h>
+#include <RrtPlannerLib/framework/RootDataBatch.h>
+#include <RrtPlannerLib/framework/Vec2.h>
 #include <QObject>
 #include <QScopedPointer>
 
@@ -24,6 +26,10 @@ class EllMapPrivate;
  * @class EllMap
  * @brief The EllMap class represents a map consisting of a nominal plan and offset plans on both sides about the nominal plan.
  *
+ * Thread safety: once built, an EllMap holds no per-query state. The query functions (const) keep their workspace
+ * on the stack and only read the map, so any number of threads may query the same EllMap, or copies sharing its
+ * data, concurrently. buildEllMap() and assignment modify the map and must not run concurrently with any other
+ * call on the same object.
  */
 class RRTPLANNER_LIB_EXPORT EllMap
 {
@@ -81,13 +87,25 @@ public:
      */
     const Plan& at(int idx) const;
 
+    /**
+     * @brief Gets the bounding box of the EllMap, i.e., of the sectors between its plans.
+     * @param[out] minNE Minimum [Northing, Easting] [m].
+     * @param[out] maxNE Maximum [Northing, Easting] [m].
+     * @return False if the map is not built, minNE and maxNE are then unchanged.
+     */
+    bool boundingBox(Vec2& minNE, Vec2& maxNE) const;
+
     /**
      * @brief Locate the sector in EllMap given a position.
+     * The search first walks from sector (planIdx_0, segIdx_0) to its neighbours towards posNE, which takes O(1)
+     * when the initial indices are those of a recent nearby position. Otherwise the candidate sectors are looked up
+     * in a grid index built by buildEllMap(), so the cost does not depend on the route length.
      * @param[in] posNE Position in Northing-Easting [m] to query.
-     * @param[in] planIdx_0 Initial plan idx to start the search.
-     * @param[in] segIdx_0 Initial segment idx to start the search.
-     * @param[out] planIdx plan idx associated with the found sector.
-     * @param[out] segIdx segment idx associated with the found sector.
+     * @param[in] planIdx_0 Initial plan idx. If posNE is on the boundary of several sectors, the one closest to
+     * (planIdx_0, segIdx_0) in search order is returned.
+     * @param[in] segIdx_0 Initial segment idx. See planIdx_0.
+     * @param[out] planIdx plan idx associated with the found sector. -1 if not found.
+     * @param[out] segIdx segment idx associated with the found sector. -1 if not found.
      * @return bool True if sector is found. False if given position is out of the Ellmap boundaries.
      */
     [[nodiscard]] bool locateSector(const VectorF& posNE,
@@ -97,6 +115,9 @@ public:
 
     /**
      * @brief Get root data with given usv position.
+     *
+     * The crosstrack coordinates are evaluated from per-sector coefficients precomputed in buildEllMap(), i.e., no
+     * offset plan is built and no memory is allocated apart from sizing rootData's ell_list.
      * @param posNE usv position in [Northing, Easting] metres
      * @param[in][out] rootData The planIdx and segIdx set upon input will be used as a starting point for search. Thereafter,
      * upon output, it will be overwritten with the found planIdx and segIdx for the given posNE input.
@@ -104,6 +125,31 @@ public:
      */
     [[nodiscard]] bool getRootData(const VectorF& posNE, RootData& rootData) const;
 
+    /**
+     * @brief Get the position at given crosstrack coordinates, the inverse of getRootData().
+     * The offset plan at dx is evaluated from the same per-sector coefficients as getRootData(), so that
+     * getRootData(posNE) returns dx and ell again.
+     * @param[in] dx Crosstrack with respect to the nominal plan [m], between the crosstracks of the first and last plans.
+     * @param[in] ell Arclength along the offset plan at dx [m], between 0 and its length.
+     * @param[out] posNE Position in [Northing, Easting] metres. Unchanged if dx or ell are out of range.
+     * @return bool True if (dx, ell) is within the EllMap.
+     */
+    [[nodiscard]] bool getPosNE(double dx, double ell, Vec2& posNE) const;
+
+    /**
+     * @brief Get root data of many positions at once.
+     *
+     * Positions are processed in order, each sector search starting from the sector of the previous position, so
+     * spatially coherent inputs (tracks, local sample clouds) mostly take the O(1) warm start path of locateSector().
+     * No memory is allocated per position.
+     * @param[in] posNEList Positions in [Northing, Easting] metres.
+     * @param[out] batch Resized to posNEList.size() and filled with the root data of each position.
+     * @param[in] nThread Number of threads sharing the positions. 0 => QThread::idealThreadCount(). Each thread
+     * handles a contiguous chunk of at least a few hundred positions, so small batches run on the calling thread.
+     * @return Number of positions within the ell map.
+     */
+    int getRootData(const QVector<Vec2>& posNEList, RootDataBatch& batch, int nThread = 1) const;
+
     /**
      * @brief Overloads the << operator to output the EllMap object to the debug stream.
      * @param debug The debug stream.
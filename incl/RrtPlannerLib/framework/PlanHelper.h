@@ -150,11 +150,11 @@ public:
      *
      *   pt - pt_offset = a.bVec
      */
-    static VectorF findOffsetWaypt(const VectorF& pt,
-                                   const VectorF& nVec,
-                                   const VectorF& bVec,
-                                   double dx,
-                                   double tol_small);
+    static Vec2 findOffsetWaypt(const Vec2& pt,
+                                const Vec2& nVec,
+                                const Vec2& bVec,
+                                double dx,
+                                double tol_small);
 };
 
 RRTPLANNER_FRAMEWORK_END_NAMESPACE
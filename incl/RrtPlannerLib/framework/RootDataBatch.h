@@ -0,0 +1,105 @@
+/**
+ * @file RootDataBatch.h
+ * @brief Structure-of-arrays root data of many positions, filled by EllMap::getRootData().
+ *
+ * RootData holds the crosstrack coordinates of one position, with a heap allocated pimpl and ell_list. Callers that
+ * need the coordinates of thousands of positions per cycle (rrt sampling, Monte-Carlo runs, fleet monitoring) use
+ * RootDataBatch instead: one contiguous array per attribute, element i belonging to position i. The arrays keep
+ * their capacity, so a batch reused across cycles of the same size does not allocate.
+ *
+ * ell_list is not stored. As in RootData::ell_list(), the arclength of position i on plan p is the cumulative length
+ * of plan p before segment segIdx(i), plus f_ell(i) times the length of that segment.
+ *
+ * @see EllMap.h, RootData.h
+ * @authors Enric Xargay Mata, ycw
+ * @date 2024-03-18
+ */
+
+#ifndef RRTPLANNER_LIB_ROOTDATABATCH_H
+#define RRTPLANNER_LIB_ROOTDATABATCH_H
+
+#include <RrtPlannerLib/RrtPlannerLibGlobal.h>
+#include <QVector>
+
+RRTPLANNER_FRAMEWORK_BEGIN_NAMESPACE
+
+class EllMap;
+
+/**
+ * @class RootDataBatch
+ * @brief Root data of many positions, one array per attribute.
+ *
+ * Positions outside of the ell map have planIdx = segIdx = -1 and zero coordinates, as a reset RootData.
+ */
+class RRTPLANNER_LIB_EXPORT RootDataBatch
+{
+public:
+    /**
+     * @brief Default constructor. Constructs an empty batch.
+     */
+    RootDataBatch();
+
+    /**
+     * @brief Destructor.
+     */
+    ~RootDataBatch();
+
+    /**
+     * @brief Resizes all arrays to n positions. Existing capacity is kept.
+     */
+    void resize(int n);
+
+    /**
+     * @brief Number of positions.
+     */
+    int size() const { return(m_planIdx.size()); }
+
+    /**
+     * @brief Cross-track distance with respect to the nominal plan [m].
+     */
+    const QVector<double>& dx() const { return(m_dx); }
+
+    /**
+     * @brief Length from start to the position [m].
+     */
+    const QVector<double>& ell() const { return(m_ell); }
+
+    /**
+     * @brief Length of the offset segment through the position [m].
+     */
+    const QVector<double>& L() const { return(m_L); }
+
+    /**
+     * @brief Fraction dl/L, dl being the distance from the start of the offset segment to the position.
+     */
+    const QVector<double>& f_ell() const { return(m_f_ell); }
+
+    /**
+     * @brief Plan index of the sector containing the position. -1 if outside of the ell map.
+     */
+    const QVector<int>& planIdx() const { return(m_planIdx); }
+
+    /**
+     * @brief Segment index of the sector containing the position. -1 if outside of the ell map.
+     */
+    const QVector<int>& segIdx() const { return(m_segIdx); }
+
+    /**
+     * @brief True if position i is within the span of the ell map.
+     */
+    bool isInPoly(int i) const { return(m_planIdx[i] >= 0); }
+
+private:
+    friend class EllMap;
+
+    QVector<double> m_dx;
+    QVector<double> m_ell;
+    QVector<double> m_L;
+    QVector<double> m_f_ell;
+    QVector<int> m_planIdx;
+    QVector<int> m_segIdx;
+};
+
+RRTPLANNER_FRAMEWORK_END_NAMESPACE
+
+#endif // RRTPLANNER_LIB_ROOTDATABATCH_H
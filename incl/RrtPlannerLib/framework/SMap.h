@@ -11,6 +11,7 @@
 #include <RrtPlannerLib/RrtPlannerLibGlobal.h>
 #include <RrtPlannerLib/framework/SPlan.h>
 #include <RrtPlannerLib/framework/EllMap.h>
+#include <RrtPlannerLib/framework/RootData.h>
 #include <QSharedDataPointer>
 #include <QSharedPointer>
 
@@ -140,6 +141,12 @@ public:
      */
     int idxNominal() const;
 
+    /**
+     * @brief Get the root data of the position given to the last reset(), e.g., its arclength along each EllMap plan.
+     * @return The root data, reset if reset() has not succeeded.
+     */
+    const RootData& rootData() const;
+
     //----------------------------------
 
     /**
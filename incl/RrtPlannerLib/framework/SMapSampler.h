@@ -0,0 +1,158 @@
+/**
+ * @file SMapSampler.h
+ * @brief This file contains the declaration of the SMapSampler class, which draws samples from the SMap volume.
+ *
+ * The SMap sampling volume is the set of (crosstrack dx, arclength ell, time t) with dx between the first and last
+ * SPlans, ell in [0, lh(dx)] ahead of the root, and t in [ell/umax, min(th0, ell/umin)], i.e., the points reachable
+ * within the time horizon between the min and max speeds. vol_cum is its cumulative distribution over the SPlan
+ * intervals.
+ *
+ * SMapSampler maps 4 uniform variates to a uniform sample of that volume without rejection:
+ * - the interval, by binary search on vol_cum (inverse CDF), or in O(1) with a Walker alias table;
+ * - dx within the interval. lh is linear in dx and each interval is either limited by the arclength horizon
+ *   (lh <= th0 umin) or by the time horizon (lh >= th0 umin), see SMapHelper::appendSPlan(), so the area of the
+ *   (ell, t) section is an exact quadratic in dx. Its Bernstein coefficients are non-negative, so the dx marginal is
+ *   a mixture of Beta(1,3), Beta(2,2) and Beta(3,1), each inverted in closed form;
+ * - ell given dx, whose density is the time span at ell, piecewise linear, inverted in closed form;
+ * - t given ell, uniform, reported as the speed ell/t.
+ *
+ * @see SMap.h, SMapHelper.h
+ * @authors Enric Xargay Mata, ycw
+ * @date 2024-03-18
+ */
+
+#ifndef RRTPLANNER_LIB_S_MAP_SAMPLER_H
+#define RRTPLANNER_LIB_S_MAP_SAMPLER_H
+
+#include <RrtPlannerLib/RrtPlannerLibGlobal.h>
+#include <RrtPlannerLib/framework/SMap.h>
+#include <RrtPlannerLib/framework/Vec2.h>
+#include <QSharedDataPointer>
+#include <QVector>
+#include <random>
+
+RRTPLANNER_FRAMEWORK_BEGIN_NAMESPACE
+
+/**
+ * @brief A sample of the SMap volume.
+ */
+struct SMapSample
+{
+    double dx{};        ///< [m] Crosstrack with respect to the nominal plan.
+    double ell{};       ///< [m] Arclength ahead of the root along the offset plan at dx.
+    double t{};         ///< [s] Time to reach ell.
+    double speed{};     ///< [m/s] Speed ell/t, umax at ell = 0.
+    int interval{-1};   ///< Index i of the SPlan interval [i, i+1] containing dx.
+};
+
+class SMapSamplerPrivate;
+
+/**
+ * @class SMapSampler
+ * @brief Draws uniform samples of the volume of an SMap, which has been reset() at the root.
+ *
+ * Copies share the tables until one of them is rebuilt. Sampling is const, so threads may share a sampler as long as
+ * each has its own random generator.
+ */
+class RRTPLANNER_LIB_EXPORT SMapSampler
+{
+public:
+    /**
+     * @brief Search of the SPlan interval of a sample.
+     */
+    enum class IntervalSearch{
+        BINARY_SEARCH,  ///< O(log n) inverse CDF, monotone in the first variate.
+        ALIAS           ///< O(1) Walker alias table.
+    };
+
+    /**
+     * @brief Default constructor. Constructs an empty sampler.
+     */
+    SMapSampler();
+
+    /**
+     * @brief Copy constructor.
+     */
+    SMapSampler(const SMapSampler& other);
+
+    /**
+     * @brief Assignment operator.
+     */
+    SMapSampler& operator=(const SMapSampler& other);
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~SMapSampler();
+
+    /**
+     * @brief Builds the tables of an SMap.
+     * @param sMap SMap, reset() at the root.
+     * @param intervalSearch Search of the interval of a sample.
+     * @return False if the SMap has less than 2 SPlans or no volume, the sampler is then empty.
+     */
+    bool build(const SMap& sMap, IntervalSearch intervalSearch = IntervalSearch::ALIAS);
+
+    /**
+     * @brief Empties the sampler.
+     */
+    void clear();
+
+    /**
+     * @brief True if the sampler is not built.
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief Search of the interval of a sample.
+     */
+    IntervalSearch intervalSearch() const;
+
+    /**
+     * @brief Number of SPlan intervals, SMap::size() - 1.
+     */
+    int nInterval() const;
+
+    /**
+     * @brief Volume of an interval as integrated by the sampler, normalised by the total volume. It matches the
+     * increment of vol_cum over the interval.
+     */
+    double intervalVolume(int idx) const;
+
+    /**
+     * @brief Maps uniform variates to a sample.
+     * @param u0 Uniform variate in [0, 1) choosing the interval, and then the mixture component of dx.
+     * @param u1 Uniform variate in [0, 1] for dx within the interval.
+     * @param u2 Uniform variate in [0, 1] for ell given dx.
+     * @param u3 Uniform variate in [0, 1] for t given ell.
+     * @param[out] sample The sample.
+     */
+    void sample(double u0, double u1, double u2, double u3, SMapSample& sample) const;
+
+    /**
+     * @brief Draws n samples into contiguous buffers.
+     * @param rng Random generator, 4 variates per sample.
+     * @param n Number of samples.
+     * @param[out] dxList Resized to n, crosstrack of the samples [m]. Existing capacity is kept.
+     * @param[out] ellList Resized to n, arclength of the samples [m].
+     * @param[out] speedList Resized to n, speed of the samples [m/s].
+     * @param[out] p_tList If not null, resized to n, time of the samples [s].
+     */
+    void sample(std::mt19937& rng, int n, QVector<double>& dxList, QVector<double>& ellList,
+                QVector<double>& speedList, QVector<double>* p_tList = nullptr) const;
+
+    /**
+     * @brief Position of a sample: arclength ell ahead of the root on the offset plan at dx.
+     * @param[in] dx [m] Crosstrack.
+     * @param[in] ell [m] Arclength ahead of the root.
+     * @param[out] posNE Position in [Northing, Easting] metres. Unchanged on failure.
+     * @return False if the position is beyond the end of the offset plan, see EllMap::getPosNE().
+     */
+    [[nodiscard]] bool posNE(double dx, double ell, Vec2& posNE) const;
+
+private:
+    QSharedDataPointer<SMapSamplerPrivate> d_ptr;
+};
+
+RRTPLANNER_FRAMEWORK_END_NAMESPACE
+#endif // RRTPLANNER_LIB_S_MAP_SAMPLER_H
@@ -0,0 +1,133 @@
+/**
+ * @file SectorGrid.h
+ * @brief Grid spatial index over the sectors of an ell map.
+ *
+ * A sector (planIdx, segIdx) is the quadrilateral bounded by segment segIdx of plan planIdx and segment segIdx of
+ * plan planIdx+1, see SectorTable. Sector sizes span several orders of magnitude: sectors next to the nominal plan
+ * are a few metres wide, sectors of the outermost plans can be kilometres long, and dummy segments give degenerate
+ * sectors.
+ * A single uniform grid either wastes memory on the large sectors or returns too many candidates near the route.
+ *
+ * The index is therefore a stack of uniform grids with cell sizes c0, 2*c0, 4*c0, ... Each sector is stored in
+ * the finest level whose cell size is not smaller than the sector's bounding box, so it is listed in at most 2x2
+ * cells. Only non-empty cells are stored (hashed), so memory is linear in the number of sectors. A query visits one
+ * cell per level and keeps the sectors whose bounding box contains the position. Its cost depends on the local
+ * sector density, not on the route length.
+ *
+ * Candidates are conservative: the caller still has to run the exact containment test on them, e.g.
+ * SectorTable::contains().
+ *
+ * @see EllMap.h, SectorTable.h
+ * @authors Enric Xargay Mata, ycw
+ * @date 2024-03-18
+ */
+
+#ifndef RRTPLANNER_LIB_SECTORGRID_H
+#define RRTPLANNER_LIB_SECTORGRID_H
+
+#include <RrtPlannerLib/RrtPlannerLibGlobal.h>
+#include <RrtPlannerLib/framework/Vec2.h>
+#include <QHash>
+#include <QVarLengthArray>
+#include <QVector>
+
+RRTPLANNER_FRAMEWORK_BEGIN_NAMESPACE
+
+class SectorTable;
+
+/**
+ * @class SectorGrid
+ * @brief Multi-level grid mapping a position to the candidate sectors of an ell map.
+ *
+ * Sectors are identified by the same sectorIdx as in SectorTable, i.e., planIdx * nSeg() + segIdx.
+ */
+class RRTPLANNER_LIB_EXPORT SectorGrid
+{
+public:
+    /**
+     * @brief Candidate list filled by candidates(). Stack allocated for typical sizes.
+     */
+    using CandidateList = QVarLengthArray<int, 64>;
+
+    /**
+     * @brief Default constructor. Constructs an empty grid.
+     */
+    SectorGrid();
+
+    /**
+     * @brief Destructor.
+     */
+    ~SectorGrid();
+
+    /**
+     * @brief Builds the grid over the sectors of an ell map.
+     * @param sectorTable Sector vertices of the ell map.
+     * @param margin [m] Sector bounding boxes are inflated by this amount, so that points the exact containment
+     * test accepts on a sector's boundary are still listed as candidates.
+     */
+    void build(const SectorTable& sectorTable, double margin);
+
+    /**
+     * @brief Clears the grid.
+     */
+    void clear();
+
+    /**
+     * @brief True if the grid holds no sector.
+     */
+    bool isEmpty() const { return(m_nSector == 0); }
+
+    /**
+     * @brief Number of segments per plan, used to split sectorIdx into planIdx and segIdx.
+     */
+    int nSeg() const { return(m_nSeg); }
+
+    /**
+     * @brief Number of grid levels holding at least one sector.
+     */
+    int nLevel() const { return(m_levelList.size()); }
+
+    /**
+     * @brief Cell size of the finest level [m].
+     */
+    double cellSize0() const { return(m_cellSize0); }
+
+    /**
+     * @brief Sectors whose (inflated) bounding box contains pos.
+     * @param[in] pos Position in Northing-Easting [m].
+     * @param[out] sectorIdxList Cleared, then filled with sectorIdx in no particular order.
+     */
+    void candidates(const Vec2& pos, CandidateList& sectorIdxList) const;
+
+    /**
+     * @brief planIdx and segIdx of a sector.
+     */
+    int planIdx(int sectorIdx) const { return(sectorIdx / m_nSeg); }
+    int segIdx(int sectorIdx) const { return(sectorIdx % m_nSeg); }
+
+private:
+    struct Level
+    {
+        int level;           //cell size is m_cellSize0 * 2^level
+        double invCellSize;
+    };
+
+    static quint64 cellKey(int level, qint64 iN, qint64 iE);
+
+    int m_nSeg{};
+    int m_nSector{};
+    Vec2 m_origin;                      //min northing, min easting of all sectors
+    double m_cellSize0{};
+    QVector<Level> m_levelList;         //non-empty levels only
+    QHash<quint64, int> m_cellHash;     //cell key -> idx in m_cellStart
+    QVector<int> m_cellStart;           //sectors of cell c are m_entry[m_cellStart[c] .. m_cellStart[c+1])
+    QVector<int> m_entry;               //sectorIdx
+    QVector<double> m_minN;             //inflated bounding box of each sector, by sectorIdx
+    QVector<double> m_minE;
+    QVector<double> m_maxN;
+    QVector<double> m_maxE;
+};
+
+RRTPLANNER_FRAMEWORK_END_NAMESPACE
+
+#endif // RRTPLANNER_LIB_SECTORGRID_H
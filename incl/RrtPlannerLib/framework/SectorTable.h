@@ -0,0 +1,162 @@
+/**
+ * @file SectorTable.h
+ * @brief Flat table of the sector quadrilaterals of an ell map, with a point-in-sector test.
+ *
+ * A sector (planIdx, segIdx) is the quadrilateral with vertices nodePrev/nodeNext of segment segIdx of plan planIdx
+ * and of plan planIdx+1. It is identified by sectorIdx = planIdx * nSeg() + segIdx.
+ *
+ * For each sector the table stores its four vertices and four half-planes, n_i . p >= c_i, with unit inward normals
+ * n_i, whose intersection is the convex hull of the vertices. This is the set the GJK test of a point against the
+ * sector polygon accepts, so contains() can replace GJK for point queries. Degenerate sectors, e.g. next to dummy
+ * segments, are handled through their hull as well:
+ * - triangle: three edges, the fourth half-plane repeats the first one,
+ * - segment: two half-planes along the segment's normal and two caps at its end points,
+ * - point: four caps around the point.
+ *
+ * The table also holds the adjacency of the sectors, used to walk from a previously located sector towards a
+ * position. A sector's neighbour across one of its four sides is the next sector in that direction that has a
+ * non-zero area. Segment and point sectors, i.e., those next to the zero length dummy segments inserted by
+ * PlanHelper::insertDummySegments(), are skipped along the plans and are not used as neighbours across plans.
+ *
+ * @see SectorGrid.h, EllMap.h
+ * @authors Enric Xargay Mata, ycw
+ * @date 2024-03-18
+ */
+
+#ifndef RRTPLANNER_LIB_SECTORTABLE_H
+#define RRTPLANNER_LIB_SECTORTABLE_H
+
+#include <RrtPlannerLib/RrtPlannerLibGlobal.h>
+#include <RrtPlannerLib/framework/Vec2.h>
+#include <QVector>
+#include <algorithm>
+
+RRTPLANNER_FRAMEWORK_BEGIN_NAMESPACE
+
+class SegmentArrays;
+
+/**
+ * @class SectorTable
+ * @brief Flat table of sector vertices and half-planes, indexed by sectorIdx.
+ */
+class RRTPLANNER_LIB_EXPORT SectorTable
+{
+public:
+    /**
+     * @brief Sides of a sector.
+     */
+    enum class Side
+    {
+        SegPrev = 0,    //edge nodePrev(planIdx) - nodePrev(planIdx+1)
+        SegNext,        //edge nodeNext(planIdx) - nodeNext(planIdx+1)
+        Port,           //segment of plan planIdx
+        Stbd            //segment of plan planIdx+1
+    };
+
+    /**
+     * @brief Default constructor. Constructs an empty table.
+     */
+    SectorTable();
+
+    /**
+     * @brief Destructor.
+     */
+    ~SectorTable();
+
+    /**
+     * @brief Builds the table from the plans of an ell map.
+     * @param segArraysList Segment arrays of the ell map plans, ordered from port to stbd. All plans are expected
+     * to have the same number of segments.
+     */
+    void build(const QVector<SegmentArrays>& segArraysList);
+
+    /**
+     * @brief Clears the table.
+     */
+    void clear();
+
+    /**
+     * @brief Number of sectors, i.e., (nPlan - 1) * nSeg.
+     */
+    int size() const { return(m_vertex.size() / 4); }
+
+    /**
+     * @brief Number of segments per plan, used to split sectorIdx into planIdx and segIdx.
+     */
+    int nSeg() const { return(m_nSeg); }
+
+    /**
+     * @brief planIdx and segIdx of a sector.
+     */
+    int planIdx(int sectorIdx) const { return(sectorIdx / m_nSeg); }
+    int segIdx(int sectorIdx) const { return(sectorIdx % m_nSeg); }
+
+    /**
+     * @brief Vertex i of a sector. 0: nodePrev(planIdx), 1: nodeNext(planIdx), 2: nodePrev(planIdx+1),
+     * 3: nodeNext(planIdx+1).
+     */
+    const Vec2& vertex(int sectorIdx, int i) const { return(m_vertex[4*sectorIdx + i]); }
+
+    /**
+     * @brief True if pos is inside the sector or within tol [m] of it.
+     */
+    bool contains(int sectorIdx, const Vec2& pos, double tol) const
+    {
+        const double* nN = m_normalN.constData() + 4*sectorIdx;
+        const double* nE = m_normalE.constData() + 4*sectorIdx;
+        const double* c = m_offset.constData() + 4*sectorIdx;
+        return(nN[0]*pos[0] + nE[0]*pos[1] - c[0] >= -tol &&
+               nN[1]*pos[0] + nE[1]*pos[1] - c[1] >= -tol &&
+               nN[2]*pos[0] + nE[2]*pos[1] - c[2] >= -tol &&
+               nN[3]*pos[0] + nE[3]*pos[1] - c[3] >= -tol);
+    }
+
+    /**
+     * @brief Signed distance [m] from pos to the boundary of the sector, positive inside. Zero or negative for
+     * degenerate sectors.
+     */
+    double depth(int sectorIdx, const Vec2& pos) const
+    {
+        const double* nN = m_normalN.constData() + 4*sectorIdx;
+        const double* nE = m_normalE.constData() + 4*sectorIdx;
+        const double* c = m_offset.constData() + 4*sectorIdx;
+        return(std::min(std::min(nN[0]*pos[0] + nE[0]*pos[1] - c[0], nN[1]*pos[0] + nE[1]*pos[1] - c[1]),
+                        std::min(nN[2]*pos[0] + nE[2]*pos[1] - c[2], nN[3]*pos[0] + nE[3]*pos[1] - c[3])));
+    }
+
+    /**
+     * @brief True if the sector is a segment or a point, i.e., has zero area.
+     */
+    bool isDegenerate(int sectorIdx) const { return(m_isDegenerate[sectorIdx]); }
+
+    /**
+     * @brief Neighbour of a sector across one of its sides.
+     * @return sectorIdx of the neighbour, -1 if there is none.
+     */
+    int neighbour(int sectorIdx, Side side) const { return(m_neighbour[4*sectorIdx + static_cast<int>(side)]); }
+
+    /**
+     * @brief Side of the sector that pos lies furthest beyond.
+     * @param[in] sectorIdx Sector to leave.
+     * @param[in] pos Position in Northing-Easting [m].
+     * @param[out] side The side to cross to get closer to pos.
+     * @return False if pos is not beyond any side, e.g., it is inside the sector.
+     */
+    bool exitSide(int sectorIdx, const Vec2& pos, Side& side) const;
+
+private:
+    void setHalfPlanes(int sectorIdx);
+    void setNeighbours(int planIdx, int segIdx);
+
+    int m_nSeg{};
+    QVector<Vec2> m_vertex;     //4 per sector
+    QVector<double> m_normalN;  //4 half-planes per sector, unit inward normal
+    QVector<double> m_normalE;
+    QVector<double> m_offset;   //n . p >= offset inside
+    QVector<bool> m_isDegenerate;
+    QVector<int> m_neighbour;   //4 per sector, in Side order
+};
+
+RRTPLANNER_FRAMEWORK_END_NAMESPACE
+
+#endif // RRTPLANNER_LIB_SECTORTABLE_H
@@ -18,7 +18,7 @@
 
 #include <RrtPlannerLib/RrtPlannerLibGlobal.h>
 #include <RrtPlannerLib/framework/Waypt.h>
-#include <RrtPlannerLib/framework/VectorF.h>
+#include <RrtPlannerLib/framework/Vec2.h>
 #include <QSharedDataPointer>
 
 RRTPLANNER_FRAMEWORK_BEGIN_NAMESPACE
@@ -112,25 +112,25 @@ public:
      * @brief Sets the unit tangent vector along the segment.
      * @param tVec The unit tangent vector.
      */
-    void setTVec(const VectorF& tVec);
+    void setTVec(const Vec2& tVec);
 
     /**
      * @brief Gets the unit tangent vector along the segment.
      * @return The unit tangent vector.
      */
-    const VectorF& tVec() const;
+    const Vec2& tVec() const;
 
     /**
      * @brief Sets the unit normal vector to the segment.
      * @param nVec The unit normal vector.
      */
-    void setNVec(const VectorF& nVec);
+    void setNVec(const Vec2& nVec);
 
     /**
      * @brief Gets the unit normal vector to the segment.
      * @return The unit normal vector.
      */
-    const VectorF& nVec() const;
+    const Vec2& nVec() const;
 
     /**
      * @brief Sets the length of the segment.
@@ -160,7 +160,7 @@ public:
      * @brief Sets the bisector vector with respect to the previous segment.
      * @param bVecPrev The bisector vector.
      */
-    void setbVecPrev(const VectorF& bVecPrev);
+    void setbVecPrev(const Vec2& bVecPrev);
 
     /**
      * @brief Sets the bisector vector with respect to the previous segment.
@@ -172,13 +172,13 @@ public:
      * @brief Gets the bisector vector with respect to the previous segment.
      * @return The bisector vector.
      */
-    const VectorF& bVecPrev() const;
+    const Vec2& bVecPrev() const;
 
     /**
      * @brief Sets the bisector vector with respect to the next segment.
      * @param bVecNext The bisector vector.
      */
-    void setbVecNext(const VectorF& bVecNext);
+    void setbVecNext(const Vec2& bVecNext);
 
     /**
      * @brief Sets the bisector vector with respect to the next segment.
@@ -190,7 +190,7 @@ public:
      * @brief Gets the bisector vector with respect to the next segment.
      * @return The bisector vector.
      */
-    const VectorF& bVecNext() const;
+    const Vec2& bVecNext() const;
 
     /**
      * @brief Calculates and sets the segment attributes (length, tVec, nVec).
@@ -0,0 +1,140 @@
+/**
+ * @file SegmentArrays.h
+ * @brief Structure-of-arrays copy of the segment attributes of a Plan.
+ *
+ * A Plan stores its segments as a QVector<Segment>, each Segment being a pimpl holding two Waypt objects.
+ * Loops that visit every segment of a plan (edge event search, sector search, arc-length lookups) have to chase
+ * several pointers per segment that way. SegmentArrays gathers the same attributes once into contiguous arrays of
+ * doubles, one array per component, so that such loops stream through memory instead.
+ *
+ * The arrays are a read-only snapshot. They have to be rebuilt with set() if the source plan changes.
+ *
+ * @see Plan.h, Segment.h
+ * @authors Enric Xargay Mata, ycw
+ * @date 2024-03-18
+ */
+
+#ifndef RRTPLANNER_LIB_SEGMENTARRAYS_H
+#define RRTPLANNER_LIB_SEGMENTARRAYS_H
+
+#include <RrtPlannerLib/RrtPlannerLibGlobal.h>
+#include <RrtPlannerLib/framework/Vec2.h>
+#include <QVector>
+
+RRTPLANNER_FRAMEWORK_BEGIN_NAMESPACE
+
+class Plan;
+
+/**
+ * @class SegmentArrays
+ * @brief Structure-of-arrays copy of the segment attributes of a Plan.
+ *
+ * Element i of each array belongs to segment i of the source plan. Accessors are inline so that they compile down
+ * to plain array reads in the calling loops.
+ */
+class RRTPLANNER_LIB_EXPORT SegmentArrays
+{
+public:
+    /**
+     * @brief Default constructor. Constructs empty arrays.
+     */
+    SegmentArrays();
+
+    /**
+     * @brief Constructs the arrays from the segments of the given plan.
+     * @param plan The source plan.
+     */
+    explicit SegmentArrays(const Plan& plan);
+
+    /**
+     * @brief Destructor.
+     */
+    ~SegmentArrays();
+
+    /**
+     * @brief (Re)builds the arrays from the segments of the given plan.
+     * @param plan The source plan.
+     */
+    void set(const Plan& plan);
+
+    /**
+     * @brief Clears all arrays.
+     */
+    void clear();
+
+    /**
+     * @brief Number of segments.
+     */
+    int size() const { return(m_length.size()); }
+
+    /**
+     * @brief Cross track of the source plan [m].
+     */
+    double crossTrack() const { return(m_crossTrack); }
+
+    /**
+     * @brief Coordinate of the previous waypt of segment i.
+     */
+    Vec2 nodePrev(int i) const { return(Vec2(m_nodePrevN[i], m_nodePrevE[i])); }
+
+    /**
+     * @brief Coordinate of the next waypt of segment i.
+     */
+    Vec2 nodeNext(int i) const { return(Vec2(m_nodeNextN[i], m_nodeNextE[i])); }
+
+    /**
+     * @brief Unit tangent vector of segment i.
+     */
+    Vec2 tVec(int i) const { return(Vec2(m_tN[i], m_tE[i])); }
+
+    /**
+     * @brief Unit normal vector of segment i.
+     */
+    Vec2 nVec(int i) const { return(Vec2(m_nN[i], m_nE[i])); }
+
+    /**
+     * @brief Bisector at the previous waypt of segment i.
+     */
+    Vec2 bVecPrev(int i) const { return(Vec2(m_bPrevN[i], m_bPrevE[i])); }
+
+    /**
+     * @brief Bisector at the next waypt of segment i.
+     */
+    Vec2 bVecNext(int i) const { return(Vec2(m_bNextN[i], m_bNextE[i])); }
+
+    /**
+     * @brief Length of segment i [m].
+     */
+    double length(int i) const { return(m_length[i]); }
+
+    /**
+     * @brief Cumulative length up to and including segment i [m].
+     */
+    double lengthCumulative(int i) const { return(m_lengthCumulative[i]); }
+
+    /**
+     * @brief Cumulative length up to the start of segment i [m], i.e., 0 for the first segment.
+     */
+    double lengthCumulativePrev(int i) const { return(i > 0? m_lengthCumulative[i - 1] : 0.0); }
+
+private:
+    QVector<double> m_nodePrevN;
+    QVector<double> m_nodePrevE;
+    QVector<double> m_nodeNextN;
+    QVector<double> m_nodeNextE;
+    QVector<double> m_tN;
+    QVector<double> m_tE;
+    QVector<double> m_nN;
+    QVector<double> m_nE;
+    QVector<double> m_bPrevN;
+    QVector<double> m_bPrevE;
+    QVector<double> m_bNextN;
+    QVector<double> m_bNextE;
+    QVector<double> m_length;
+    QVector<double> m_lengthCumulative;
+    double m_crossTrack{};
+};
+
+RRTPLANNER_FRAMEWORK_END_NAMESPACE
+
+#endif // RRTPLANNER_LIB_SEGMENTARRAYS_H
@@ -0,0 +1,139 @@
+/**
+ * @file Vec2.h
+ * @brief Fixed-size 2D vector used to store coordinates or vectors in the hot paths of this library.
+ *
+ * Unlike VectorF, which wraps a heap allocated boost::numeric::ublas::vector<double> behind a shared data pointer,
+ * Vec2 is a trivially-copyable value type of two doubles. Constructing, copying and doing arithmetic with it
+ * never allocates, which makes it suitable for the inner loops of the GJK algorithm and ell map queries.
+ *
+ * Element indexing follows the convention of VectorF, i.e., index IDX_NORTHING (0) and IDX_EASTING (1).
+ * VectorF can be implicitly converted to and from Vec2 for compatibility with existing code.
+ *
+ * @see VectorF.h
+ * @authors Enric Xargay Mata, ycw
+ * @date 2024-03-18
+ */
+
+#ifndef RRTPLANNER_LIB_VEC2_H
+#define RRTPLANNER_LIB_VEC2_H
+
+#include <RrtPlannerLib/RrtPlannerLibGlobal.h>
+#include <QDebug>
+#include <QtGlobal>
+#include <cmath>
+#include <type_traits>
+
+RRTPLANNER_FRAMEWORK_BEGIN_NAMESPACE
+
+/**
+ * @class Vec2
+ * @brief Trivially-copyable 2D vector with constexpr arithmetic.
+ */
+class Vec2
+{
+public:
+    /**
+     * @brief Default constructor. Constructs a zero vector.
+     */
+    constexpr Vec2() = default;
+
+    /**
+     * @brief Constructs a Vec2 from its two elements.
+     * @param v0 Element at index 0 (northing).
+     * @param v1 Element at index 1 (easting).
+     */
+    constexpr Vec2(double v0, double v1)
+        :m_data{v0, v1}
+    {}
+
+    /**
+     * @brief Returns the size of the vector. Always 2.
+     */
+    static constexpr int size() { return(2); }
+
+    /**
+     * @brief Returns value of the element at the specified index.
+     * @param idx The index of the element. Either 0 or 1.
+     */
+    constexpr double at(int idx) const { return(m_data[idx]); }
+
+    /**
+     * @brief Returns value of the element at the specified index using the array subscript operator.
+     * @param idx The index of the element. Either 0 or 1.
+     */
+    constexpr double operator[](int idx) const { return(m_data[idx]); }
+
+    /**
+     * @brief Returns a reference to the element at the specified index using the array subscript operator.
+     * @param idx The index of the element. Either 0 or 1.
+     */
+    constexpr double& operator[](int idx) { return(m_data[idx]); }
+
+    /**
+     * @brief Returns a pointer to the two contiguous elements.
+     */
+    constexpr const double* data() const { return(m_data); }
+
+    //==========
+    //arithmetic
+    //==========
+    constexpr Vec2 operator-() const { return(Vec2(-m_data[0], -m_data[1])); }
+    constexpr Vec2& operator+=(const Vec2& rhs) { m_data[0] += rhs.m_data[0]; m_data[1] += rhs.m_data[1]; return(*this); }
+    constexpr Vec2& operator-=(const Vec2& rhs) { m_data[0] -= rhs.m_data[0]; m_data[1] -= rhs.m_data[1]; return(*this); }
+    constexpr Vec2& operator*=(double scalar) { m_data[0] *= scalar; m_data[1] *= scalar; return(*this); }
+    friend constexpr Vec2 operator+(const Vec2& lhs, const Vec2& rhs) { return(Vec2(lhs.m_data[0] + rhs.m_data[0], lhs.m_data[1] + rhs.m_data[1])); }
+    friend constexpr Vec2 operator-(const Vec2& lhs, const Vec2& rhs) { return(Vec2(lhs.m_data[0] - rhs.m_data[0], lhs.m_data[1] - rhs.m_data[1])); }
+    friend constexpr Vec2 operator*(const Vec2& vec, double scalar) { return(Vec2(vec.m_data[0] * scalar, vec.m_data[1] * scalar)); }
+    friend constexpr Vec2 operator*(double scalar, const Vec2& vec) { return(vec * scalar); }
+    friend constexpr bool operator==(const Vec2& lhs, const Vec2& rhs) { return(lhs.m_data[0] == rhs.m_data[0] && lhs.m_data[1] == rhs.m_data[1]); }
+    friend constexpr bool operator!=(const Vec2& lhs, const Vec2& rhs) { return(!(lhs == rhs)); }
+
+    /**
+     * @brief Dot product. this dot rhs.
+     */
+    constexpr double dot(const Vec2& rhs) const { return(m_data[0]*rhs.m_data[0] + m_data[1]*rhs.m_data[1]); }
+
+    /**
+     * @brief z value of the cross product between two 2d vectors. this cross rhs.
+     */
+    constexpr double cross_zVal(const Vec2& rhs) const { return(m_data[0]*rhs.m_data[1] - m_data[1]*rhs.m_data[0]); }
+
+    /**
+     * @brief Cross product with the z-vector [0; 0; 1], trimmed to 2d. Same as VectorFHelper::vec2D_cross_z().
+     */
+    constexpr Vec2 cross_z() const { return(Vec2(m_data[1], -m_data[0])); }
+
+    /**
+     * @brief Square of the Euclidean norm.
+     */
+    constexpr double norm2_square() const { return(dot(*this)); }
+
+    /**
+     * @brief Euclidean norm (L2 norm).
+     */
+    double norm2() const { return(std::sqrt(norm2_square())); }
+
+    /**
+     * @brief Returns true if norm_2 of the difference between this and rhs is smaller or equal to tol_small.
+     */
+    bool compare(const Vec2& rhs, double tol_small) const { return((*this - rhs).norm2() <= tol_small); }
+
+    /**
+     * @brief Overloads the << operator to output the Vec2 object to the QDebug.
+     */
+    friend QDebug operator<<(QDebug debug, const RRTPLANNER_NAMESPACE::framework::Vec2& data)
+    {
+        QDebugStateSaver saver(debug);
+        debug.nospace() << "(" << data.m_data[0] << "," << data.m_data[1] << ")";
+        return debug;
+    }
+
+private:
+    double m_data[2]{0.0, 0.0};
+};
+
+static_assert(std::is_trivially_copyable<Vec2>::value, "Vec2 is expected to be trivially copyable");
+
+RRTPLANNER_FRAMEWORK_END_NAMESPACE
+
+#endif
@@ -0,0 +1,70 @@
+/**
+ * @file Vec2Helper.h
+ * @brief Helper class with small 2D geometry kernels operating on Vec2.
+ *
+ * The functions here are header-only and do not allocate, so that they can be used in the inner loops of the
+ * ell map construction. They replace the general UblasHelper routines where the problem is known to be 2x2.
+ *
+ * @see Vec2.h, UblasHelper.h
+ * @authors Enric Xargay Mata, ycw
+ * @date 2024-03-18
+ */
+
+#ifndef RRTPLANNER_LIB_VEC2HELPER_H
+#define RRTPLANNER_LIB_VEC2HELPER_H
+
+#include <RrtPlannerLib/RrtPlannerLibGlobal.h>
+#include <RrtPlannerLib/framework/Vec2.h>
+#include <cmath>
+
+RRTPLANNER_FRAMEWORK_BEGIN_NAMESPACE
+
+/**
+ * @class Vec2Helper
+ * @brief Helper class with small 2D geometry kernels operating on Vec2.
+ */
+class Vec2Helper
+{
+public:
+    /**
+     * @brief Solves the 2x2 linear system [col0 col1] * x = y with Cramer's rule.
+     * @param[in] col0 First column of the matrix.
+     * @param[in] col1 Second column of the matrix.
+     * @param[in] y Right hand side.
+     * @param[in] tol_small The system is treated as singular if |det| <= tol_small. Same check as UblasHelper::solve().
+     * @param[out] x Solution. Not modified if the system is singular.
+     * @return bool True if solved. False if singular.
+     */
+    static bool solve(const Vec2& col0, const Vec2& col1, const Vec2& y, double tol_small, Vec2& x)
+    {
+        double det = col0.cross_zVal(col1);
+        bool ok = std::abs(det) > tol_small;
+        if(ok){
+            double invDet = 1.0/det;
+            x = Vec2(y.cross_zVal(col1) * invDet,
+                     col0.cross_zVal(y) * invDet);
+        }
+        return(ok);
+    }
+
+    /**
+     * @brief Intersection of two lines, each given by a point and a direction, p0 + s0*d0 = p1 + s1*d1.
+     * @param[in] p0 Point on the first line.
+     * @param[in] d0 Direction of the first line.
+     * @param[in] p1 Point on the second line.
+     * @param[in] d1 Direction of the second line.
+     * @param[in] tol_small Lines are treated as parallel if |d0 x d1| <= tol_small.
+     * @param[out] s Line parameters [s0, s1] at the intersection. Not modified if the lines are parallel.
+     * @return bool True if the lines intersect. False if parallel.
+     */
+    static bool intersectLines(const Vec2& p0, const Vec2& d0,
+                               const Vec2& p1, const Vec2& d1,
+                               double tol_small, Vec2& s)
+    {
+        return(solve(d0, -d1, p1 - p0, tol_small, s));
+    }
+};
+
+RRTPLANNER_FRAMEWORK_END_NAMESPACE
+
+#endif // RRTPLANNER_LIB_VEC2HELPER_H
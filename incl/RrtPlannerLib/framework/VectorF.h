@@ -16,6 +16,7 @@
 #define RRTPLANNER_LIB_VECTOR_F_H
 
 #include <RrtPlannerLib/RrtPlannerLibGlobal.h>
+#include <RrtPlannerLib/framework/Vec2.h>
 #include <QSharedDataPointer>
 #include <QDebug>
 #include <initializer_list>
@@ -52,6 +53,12 @@ public:
      */
     explicit VectorF(const boost::numeric::ublas::vector<double>& data);
 
+    /**
+     * @brief Constructs a VectorF object of size 2 from a Vec2. Implicit for compatibility with code that still takes VectorF.
+     * @param vec The Vec2 used to initialize the vector.
+     */
+    VectorF(const Vec2& vec);
+
     /**
      * @brief Destructor.
      */
@@ -119,6 +126,12 @@ public:
      */
     boost::numeric::ublas::vector<double>& data();
 
+    /**
+     * @brief Converts to Vec2. Implicit for compatibility with code that has moved to Vec2.
+     * @note Q_ASSERT if the vector is not of dim 2.
+     */
+    operator Vec2() const;
+
     /**
      * @brief Overloads the << operator to output the VectorF object to the QDebug.
      * @param debug The QDebug object.
@@ -11,6 +11,7 @@
 #define RRTPLANNER_LIB_WAYPT_H
 
 #include <RrtPlannerLib/RrtPlannerLibGlobal.h>
+#include <RrtPlannerLib/framework/Vec2.h>
 #include <RrtPlannerLib/framework/VectorF.h>
 #include <QSharedDataPointer>
 
@@ -44,7 +45,7 @@ public:
      * @param lon0_deg The reference longitude in degrees.
      * @param id The waypt id.
      */
-    Waypt(const VectorF& coord, double lon0_deg = 0.0, int id = -1);
+    Waypt(const Vec2& coord, double lon0_deg = 0.0, int id = -1);
 
     /**
      * @brief Destructor.
@@ -76,7 +77,7 @@ public:
      * @param lon0_deg The reference longitude in degrees. Default = 0.0.
      * @param id The waypt id. Default = -1.
      */
-    void set(const VectorF& coord, double lon0_deg = 0.0, int id = -1);
+    void set(const Vec2& coord, double lon0_deg = 0.0, int id = -1);
 
     /**
      * @brief Sets the northing value of the waypoint.
@@ -130,13 +131,14 @@ public:
      * @brief Sets the coordinate of the waypoint using the given coordinate vector.
      * @param coord The coordinate vector containing the northing and easting values.
      */
-    void setCoord(const VectorF& coord);
+    void setCoord(const Vec2& coord);
 
     /**
      * @brief Gets a constant reference to the coordinate vector of the waypoint.
      * @return The constant reference to the coordinate vector.
+     * @note Stored as Vec2, which converts implicitly to VectorF where the latter is still expected.
      */
-    const VectorF& coord_const_ref() const;
+    const Vec2& coord_const_ref() const;
 
     // Overloading the << operator
     friend RRTPLANNER_LIB_EXPORT QDebug operator<<(QDebug debug, const RRTPLANNER_NAMESPACE::framework::Waypt &data);
@@ -0,0 +1,142 @@
+/**
+ * @file CSpaceObstacleSet.h
+ * @brief Definition of the CSpaceObstacleSet class, configuration space obstacles of a fixed vessel footprint.
+ *
+ * The footprint at pose (p, h) intersects obstacle O if and only if p lies in the Minkowski sum O + (-R(h) F), where
+ * F is the footprint in vessel coordinates and R(h) maps it to (northing, easting) as GjkPose::toWorld(). The sum is
+ * the configuration space (C-space) obstacle of O. CSpaceObstacleSet precomputes it for each obstacle and each of
+ * nHeadingBucket() heading buckets, so that checking a pose is a point-in-convex-polygon test instead of a GJK run.
+ * A hashed uniform grid over the obstacle bounding boxes, inflated by the reach of the footprint, lists the
+ * candidate obstacles of a position, so a query only looks at the obstacles near it.
+ *
+ * To cover all headings of a bucket [h0, h1], each footprint vertex is replaced by its positions at h0 and h1 and by
+ * the intersection of the tangents of its arc there, which together enclose the arc. The check is conservative: it
+ * reports every intersecting pose, and may report poses whose footprint is up to 2 rMax sin((h1 - h0)/2) away from
+ * the obstacle, with rMax the largest distance of a footprint vertex from the vessel coordinates origin.
+ *
+ * @see GjkPose.h, ObstacleSet.h
+ * @authors Enric Xargay Mata, ycw
+ * @date 2024-03-18
+ */
+
+#ifndef RRTPLANNERLIB_FRAMEWORK_ALGORITHM_GJK_CSPACEOBSTACLESET_H
+#define RRTPLANNERLIB_FRAMEWORK_ALGORITHM_GJK_CSPACEOBSTACLESET_H
+
+#include <RrtPlannerLib/RrtPlannerLibGlobal.h>
+#include <RrtPlannerLib/framework/Vec2.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/GjkDefines.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/GjkPose.h>
+#include <QSharedDataPointer>
+#include <QVector>
+
+
+RRTPLANNER_FRAMEWORK_ALGORITHM_GJK_BEGIN_NAMESPACE
+
+class CSpaceObstacleSetPrivate;
+class Polygon;
+
+/**
+ * @brief The CSpaceObstacleSet class holds the C-space obstacles of convex obstacles for a fixed footprint and
+ * checks vessel poses against all of them.
+ * @details Each obstacle is the convex hull of its vertices, as for Polygon. Obstacles are identified by the index
+ * returned by append(), in insertion order. Changing the footprint means building a new set.
+ */
+class RRTPLANNER_LIB_EXPORT CSpaceObstacleSet
+{
+public:
+    /**
+     * @brief Default constructor. Constructs an empty set for a point footprint at the vessel coordinates origin.
+     */
+    CSpaceObstacleSet();
+
+    /**
+     * @brief Constructs an empty set for a footprint.
+     * @param footprint Vertices of the footprint in vessel coordinates (u, v), e.g., from VesRectangle::polygon().
+     * The footprint is their convex hull.
+     * @param nHeadingBucket Number of heading buckets over 360 deg, at least 4.
+     */
+    explicit CSpaceObstacleSet(const QVector<Vec2>& footprint, int nHeadingBucket = CSPACE_HEADING_BUCKETS);
+
+    /**
+     * @brief Copy constructor.
+     * @param other The CSpaceObstacleSet object to copy from.
+     */
+    CSpaceObstacleSet(const CSpaceObstacleSet& other);
+
+    /**
+     * @brief Assignment operator.
+     * @param other The CSpaceObstacleSet object to assign from.
+     * @return A reference to this CSpaceObstacleSet object after the assignment.
+     */
+    CSpaceObstacleSet& operator=(const CSpaceObstacleSet& other);
+
+    /**
+     * @brief Destructor.
+     */
+    ~CSpaceObstacleSet();
+
+    /**
+     * @brief Adds a convex obstacle and computes its C-space obstacle for every heading bucket.
+     * @param vertexList Vertices of the obstacle in (northing, easting), at least one.
+     * @return Index of the obstacle.
+     */
+    int append(const QVector<Vec2>& vertexList);
+
+    /**
+     * @brief Adds a convex obstacle.
+     * @param polygon The obstacle.
+     * @return Index of the obstacle.
+     */
+    int append(const Polygon& polygon);
+
+    /**
+     * @brief Removes all obstacles. The footprint is kept.
+     */
+    void clear();
+
+    /**
+     * @brief Number of obstacles.
+     */
+    int size() const;
+
+    /**
+     * @brief Number of heading buckets over 360 deg.
+     */
+    int nHeadingBucket() const;
+
+    /**
+     * @brief Heading bucket of a heading.
+     * @param heading [deg] Clockwise from north, any value.
+     * @return Bucket index in [0, nHeadingBucket()).
+     */
+    int headingBucket(double heading) const;
+
+    /**
+     * @brief C-space obstacle of obstacle idx for heading bucket iBucket, counter-clockwise as for ConvexPolygon.
+     */
+    QVector<Vec2> cObstacle(int idx, int iBucket) const;
+
+    /**
+     * @brief Check a pose against all obstacles, stopping at the first hit.
+     * @param pose Pose of the footprint.
+     * @return True if the footprint at pose may intersect some obstacle, see the file description.
+     */
+    bool chkIntersect(const GjkPose& pose) const;
+
+    /**
+     * @brief Check a pose against all obstacles.
+     * @param[in] pose Pose of the footprint.
+     * @param[out] hitIdxList Cleared, then filled with the ascending indices of the obstacles the footprint at pose
+     * may intersect.
+     * @return Number of hits.
+     */
+    int chkIntersect(const GjkPose& pose, QVector<int>& hitIdxList) const;
+
+private:
+    QSharedDataPointer<CSpaceObstacleSetPrivate> d_ptr;
+};
+
+
+RRTPLANNER_FRAMEWORK_ALGORITHM_GJK_END_NAMESPACE
+
+#endif
@@ -0,0 +1,158 @@
+/**
+ * @file ConvexPolygon.h
+ * @brief Definition of the ConvexPolygon class, a convex polygon shape with sub-linear support queries.
+ *
+ * Polygon::support() scans all vertices. Obstacle hulls from chart data have hundreds of vertices and GJK queries
+ * the support of each shape once per iteration, so the scan dominates. ConvexPolygon checks at construction that
+ * its vertices form a strictly convex polygon and then answers support queries by
+ *   - hill-climbing along the boundary from the vertex returned by the previous query. GJK search directions change
+ *     little between iterations, so this usually takes a step or two.
+ *   - binary search over the edge directions, O(log n), when the hill-climb does not settle within a few steps.
+ *     Small polygons scan their vertices instead, which is cheaper than the atan2 of the search.
+ *
+ * @authors Enric Xargay Mata, ycw
+ * @date 2024-03-18
+ */
+
+#ifndef RRTPLANNERLIB_FRAMEWORK_ALGORITHM_GJK_CONVEXPOLYGON_H
+#define RRTPLANNERLIB_FRAMEWORK_ALGORITHM_GJK_CONVEXPOLYGON_H
+
+#include <RrtPlannerLib/RrtPlannerLibGlobal.h>
+#include <RrtPlannerLib/framework/Vec2.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/IShape.h>
+#include <QString>
+#include <QVector>
+#include <QSharedDataPointer>
+
+
+RRTPLANNER_FRAMEWORK_ALGORITHM_GJK_BEGIN_NAMESPACE
+
+class ConvexPolygonPrivate;
+
+/**
+ * @brief The ConvexPolygon class represents a convex polygon shape.
+ * @details The vertices may be given in either orientation and may repeat the first vertex at the end. Repeated
+ * and collinear vertices are dropped, and the remaining ones are stored counter-clockwise in (northing, easting),
+ * i.e., with a positive cross_zVal() between consecutive edges. Vertex i is adjacent to vertices i-1 and i+1
+ * (modulo size()).
+ *
+ * If the vertices do not form a convex polygon, isConvex() is false, the vertices are kept as given and support()
+ * falls back to the linear scan of Polygon.
+ *
+ * The vertex of the last support query is remembered in the object, not in the shared data. Concurrent queries on
+ * the same object are therefore not safe. Give each thread its own copy (copies share the vertex data).
+ *
+ * The class is final so that the templated GJK kernel in GjkKernel.h can call support() without a virtual call.
+ */
+class RRTPLANNER_LIB_EXPORT ConvexPolygon final : public IShape
+{
+public:
+    /**
+     * @brief Default constructor. Constructs an empty polygon.
+     */
+    ConvexPolygon();
+
+    /**
+     * @brief Constructor with a list of vertices.
+     * @param vertexList Vertices of the polygon.
+     */
+    explicit ConvexPolygon(const QVector<Vec2>& vertexList);
+
+    /**
+     * @brief Constructor with an initializer list of vertices.
+     * @param list An initializer list of Vec2 representing the vertices of the polygon.
+     */
+    ConvexPolygon(const std::initializer_list<Vec2>& list);
+
+    /**
+     * @brief Copy constructor.
+     * @param other The ConvexPolygon object to copy from.
+     */
+    ConvexPolygon(const ConvexPolygon& other);
+
+    /**
+     * @brief Assignment operator.
+     * @param other The ConvexPolygon object to assign from.
+     * @return A reference to this ConvexPolygon object after the assignment.
+     */
+    ConvexPolygon& operator=(const ConvexPolygon& other);
+
+    /**
+     * @brief Virtual destructor.
+     */
+    virtual ~ConvexPolygon();
+
+    /**
+     * @brief Create a deep copy of the ConvexPolygon object.
+     * @return A pointer to a new ConvexPolygon object that is a copy of this ConvexPolygon.
+     * @details The caller is responsible for managing the memory of the returned object.
+     */
+    virtual ConvexPolygon* clone() const override;
+
+    /**
+     * @brief Get the centroid (vertex average) of the ConvexPolygon. Computed at construction.
+     * @return The centroid of the ConvexPolygon as a Vec2 object.
+     */
+    virtual Vec2 centroid() const override;
+
+    /**
+     * @brief Get the support point of the ConvexPolygon in a given direction.
+     * @param dir The input search direction vector.
+     * @return The support point of the ConvexPolygon in the given input direction as a Vec2 object.
+     */
+    virtual Vec2 support(const Vec2& dir) const override;
+
+    /**
+     * @brief True if the vertices form a strictly convex polygon with at least 3 vertices.
+     */
+    bool isConvex() const;
+
+    /**
+     * @brief Get the number of vertices in the ConvexPolygon.
+     * @return The number of vertices in the ConvexPolygon.
+     */
+    int size() const;
+
+    /**
+     * @brief Get the vertex at a specific index.
+     * @param i The index of the vertex to retrieve.
+     * @return A constant reference to the Vec2 representing the vertex at the specified index.
+     */
+    const Vec2& at(int i) const;
+
+    /**
+     * @brief Get a constant reference to the list of vertices of the ConvexPolygon.
+     * @return A constant reference to the QVector of Vec2 representing the vertices of the ConvexPolygon.
+     */
+    const QVector<Vec2>& vertexList_const_ref() const;
+
+protected:
+    /**
+     * @brief Generate a debug string representation of the ConvexPolygon.
+     * @return A QString containing a debug string representation of the ConvexPolygon.
+     */
+    virtual QString debugPrint() const override;
+
+    /**
+     * @brief detach Detach this class's private QSharedDataPointer during cloning.
+     */
+    void detach();
+
+private:
+    /**
+     * @brief Moves from vertex idx to the neighbour with the larger projection on dir until neither is larger.
+     * @param[in,out] idx Start vertex in, support vertex out.
+     * @param[in] dir Search direction.
+     * @param[in] nStepMax Maximum number of steps.
+     * @return True if idx is the support vertex, false if nStepMax was reached first.
+     */
+    bool hillClimb(int& idx, const Vec2& dir, int nStepMax) const;
+
+    QSharedDataPointer<ConvexPolygonPrivate> d_ptr;
+    mutable int m_idxLast{};    //support vertex of the previous query
+};
+
+
+RRTPLANNER_FRAMEWORK_ALGORITHM_GJK_END_NAMESPACE
+
+#endif
@@ -10,6 +10,10 @@
 #define RRTPLANNERLIB_FRAMEWORK_ALGORITHM_GJK_GJK_H
 
 #include <RrtPlannerLib/RrtPlannerLibGlobal.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/GjkCache.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/GjkContact.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/GjkDefines.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/GjkPose.h>
 #include <RrtPlannerLib/framework/algorithm/gjk/IShape.h>
 #include <QScopedPointer>
 
@@ -58,6 +62,66 @@ public:
                               double& distance,
                               bool& isValidDistance) = 0;
 
+    /**
+     * @brief Check for intersection between two shapes, warm-started from the previous query of the same pair.
+     * @details Starts from the search direction stored in cache for pairId instead of the centroid difference, and
+     *          stores the final one for the next query. For slowly moving shapes that are apart this usually takes a
+     *          single support query on each shape. The result is the same as for GjkType::Basic and does not depend
+     *          on the cache. The same for all GjkType.
+     * @param shape1 The first shape.
+     * @param shape2 The second shape.
+     * @param cache Search directions of previous queries (input and output parameter).
+     * @param pairId Id of the pair (shape1, shape2) in cache, chosen by the caller.
+     * @return True if the shapes intersect, false otherwise.
+     */
+    bool chkIntersectCached(const IShape& shape1, const IShape& shape2, GjkCache& cache, quint64 pairId);
+
+    /**
+     * @brief Check for intersection between two shapes and get their contact information.
+     * @param shape1 The first shape.
+     * @param shape2 The second shape.
+     * @param contact Distance or penetration depth, contact normal and witness points (output parameter).
+     *                GjkType::MinDist computes the witness points of shapes apart, GjkType::Epa also the
+     *                penetration depth of intersecting shapes. The default implementation fills contact.distance
+     *                from chkIntersect() if valid and leaves contact.isValid false.
+     * @return True if the shapes intersect, false otherwise.
+     */
+    virtual bool chkContact(const IShape& shape1, const IShape& shape2, GjkContact& contact);
+
+    /**
+     * @brief Check whether two shapes are further apart than a required clearance.
+     * @details The distance iteration stops as soon as the distance is known to exceed distanceMin, which saves
+     *          most iterations for shapes far apart. The same for all GjkType.
+     * @param shape1 The first shape.
+     * @param shape2 The second shape.
+     * @param distanceMin The required clearance [m].
+     * @param contact If the iteration converged (contact.isValid), the distance, contact normal and witness points.
+     *                If it stopped early, contact.distance is a lower bound of the distance larger than
+     *                distanceMin. Zero if the shapes intersect (output parameter).
+     * @return True if the distance between the shapes is larger than distanceMin, false otherwise.
+     */
+    bool chkSeparation(const IShape& shape1, const IShape& shape2, double distanceMin, GjkContact& contact);
+
+    /**
+     * @brief Continuous collision check of a footprint moving from poseStart to poseEnd against a static obstacle.
+     * @details Position and heading are interpolated linearly (GjkPose::interpolate()). Conservative advancement on
+     *          the GJK distance: each step moves the footprint as far as it provably can without touching the
+     *          obstacle, so the check costs a handful of distance queries and does not miss thin obstacles as
+     *          sampled poses can. The same for all GjkType.
+     * @param footprint The moving shape in vessel coordinates (u aft, v starboard), e.g., from VesRectangle::polygon().
+     * @param poseStart Pose of the footprint at time 0.
+     * @param poseEnd Pose of the footprint at time 1.
+     * @param obstacle The static obstacle in (northing, easting).
+     * @param timeContact Time of first contact in [0, 1], as a fraction of the way from poseStart to poseEnd.
+     *                    1 if there is none (output parameter).
+     * @param contact At contact, the closest points of the footprint at timeContact and the obstacle
+     *                (output parameter).
+     * @param distanceTol [m] Distance taken as contact (default is defined in GjkDefines.h).
+     * @return True if the footprint touches the obstacle on the way, false otherwise.
+     */
+    bool chkSweep(const IShape& footprint, const GjkPose& poseStart, const GjkPose& poseEnd, const IShape& obstacle,
+                  double& timeContact, GjkContact& contact, double distanceTol = SWEEP_DISTANCE_TOL);
+
     //==============
     //Gjk parameters
     //==============
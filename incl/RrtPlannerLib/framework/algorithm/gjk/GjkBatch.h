@@ -0,0 +1,139 @@
+/**
+ * @file GjkBatch.h
+ * @brief Definition of the GjkBatch class, GJK over many independent shape pairs in lockstep lanes.
+ *
+ * After the broad phase, thousands of small convex pairs per cycle go through GJK one by one. GjkBatch stores the
+ * pairs and runs them GJK_BATCH_LANES at a time: the vertices of each group of pairs are packed structure-of-arrays
+ * (vertex j of all lanes adjacent) when the pairs are appended, all lanes compute their support points together, and
+ * each lane then updates its own simplex. Lanes that terminate are masked out until the whole group is done.
+ *
+ * The support step (SupportLanes.h) is written with AVX2 intrinsics when its file is compiled with AVX2 enabled
+ * (RRTPLANNER_GJK_AVX2), with SSE2 intrinsics otherwise on x86-64, and as plain loops over the lanes elsewhere. All
+ * perform the same operations as GjkBasic and GjkMinDist, so the results are identical, as long as the compiler
+ * does not contract the dot products into fused multiply-adds differently in the code paths.
+ *
+ * @authors Enric Xargay Mata, ycw
+ * @date 2024-03-18
+ */
+
+#ifndef RRTPLANNERLIB_FRAMEWORK_ALGORITHM_GJK_GJKBATCH_H
+#define RRTPLANNERLIB_FRAMEWORK_ALGORITHM_GJK_GJKBATCH_H
+
+#include <RrtPlannerLib/RrtPlannerLibGlobal.h>
+#include <RrtPlannerLib/framework/Vec2.h>
+#include <QSharedDataPointer>
+#include <QVector>
+
+
+RRTPLANNER_FRAMEWORK_ALGORITHM_GJK_BEGIN_NAMESPACE
+
+class GjkBatchPrivate;
+class Polygon;
+
+/**
+ * @brief The GjkBatch class checks many independent pairs of convex shapes for intersection.
+ * @details Each shape is the convex hull of its vertices, as for Polygon. Pairs are identified by the index returned
+ * by append(), in insertion order. Pairs of similar vertex counts waste fewer lanes, since the vertices of a group
+ * are padded to its largest shape.
+ */
+class RRTPLANNER_LIB_EXPORT GjkBatch
+{
+public:
+    /**
+     * @brief Default constructor. Constructs an empty batch.
+     */
+    GjkBatch();
+
+    /**
+     * @brief Copy constructor.
+     * @param other The GjkBatch object to copy from.
+     */
+    GjkBatch(const GjkBatch& other);
+
+    /**
+     * @brief Assignment operator.
+     * @param other The GjkBatch object to assign from.
+     * @return A reference to this GjkBatch object after the assignment.
+     */
+    GjkBatch& operator=(const GjkBatch& other);
+
+    /**
+     * @brief Destructor.
+     */
+    ~GjkBatch();
+
+    /**
+     * @brief Adds a pair of convex shapes.
+     * @param vertexList1 Vertices of the first shape, at least one.
+     * @param vertexList2 Vertices of the second shape, at least one.
+     * @return Index of the pair.
+     */
+    int append(const QVector<Vec2>& vertexList1, const QVector<Vec2>& vertexList2);
+
+    /**
+     * @brief Adds a pair of polygons.
+     * @return Index of the pair.
+     */
+    int append(const Polygon& shape1, const Polygon& shape2);
+
+    /**
+     * @brief Removes all pairs.
+     */
+    void clear();
+
+    /**
+     * @brief Number of pairs.
+     */
+    int size() const;
+
+    /**
+     * @brief Check all pairs for intersection, same results as GjkBasic::chkIntersect() on each pair.
+     * @param[out] isIntersectList Resized to size(), true for the pairs that intersect.
+     */
+    void chkIntersect(QVector<bool>& isIntersectList) const;
+
+    /**
+     * @brief Check all pairs for intersection and get the distance of the others, same results as
+     * GjkMinDist::chkIntersect() on each pair.
+     * @param[out] isIntersectList Resized to size(), true for the pairs that intersect.
+     * @param[out] distanceList Resized to size(), the distance of each pair if valid, 0 otherwise.
+     * @param[out] isValidDistanceList Resized to size(), true if the distance of the pair was computed.
+     */
+    void chkIntersect(QVector<bool>& isIntersectList, QVector<double>& distanceList,
+                      QVector<bool>& isValidDistanceList) const;
+
+    /**
+     * @brief Set the tolerance to determine if a support point is on the origin or simplex.
+     * @param eps_square The tolerance value (default is defined in GjkDefines.h).
+     */
+    void set_eps_square(double eps_square);
+
+    /**
+     * @brief Get the current tolerance value for determining if a support point is on the origin or simplex.
+     */
+    double eps_square() const;
+
+    /**
+     * @brief Set the maximum number of iterations to run the GJK algorithm.
+     * @param max_iteration The maximum number of iterations (default is defined in GjkDefines.h).
+     */
+    void set_max_iteration(int max_iteration);
+
+    /**
+     * @brief Get the current maximum number of iterations for the GJK algorithm.
+     */
+    int max_iteration() const;
+
+    /**
+     * @brief True if the support step was compiled with AVX2 intrinsics, false for SSE2 or plain lane loops.
+     */
+    static bool isAvx2();
+
+private:
+    QSharedDataPointer<GjkBatchPrivate> d_ptr;
+};
+
+
+RRTPLANNER_FRAMEWORK_ALGORITHM_GJK_END_NAMESPACE
+
+#endif
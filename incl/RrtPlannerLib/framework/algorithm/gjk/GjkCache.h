@@ -0,0 +1,96 @@
+/**
+ * @file GjkCache.h
+ * @brief Definition of the GjkCache class, per-pair search directions to warm-start Gjk::chkIntersectCached().
+ *
+ * Between two control ticks the vessel barely moves and the same vessel-obstacle pairs are checked again. GJK
+ * starts from the centroid difference each time and needs a few iterations to find a separating direction or to
+ * enclose the origin. The direction GJK ended with for a pair is almost always still valid at the next tick, so
+ * seeding the next query with it settles a separated pair with a single support query on each shape.
+ *
+ * @authors Enric Xargay Mata, ycw
+ * @date 2024-03-18
+ */
+
+#ifndef RRTPLANNERLIB_FRAMEWORK_ALGORITHM_GJK_GJKCACHE_H
+#define RRTPLANNERLIB_FRAMEWORK_ALGORITHM_GJK_GJKCACHE_H
+
+#include <RrtPlannerLib/RrtPlannerLibGlobal.h>
+#include <RrtPlannerLib/framework/Vec2.h>
+#include <QSharedDataPointer>
+#include <QtGlobal>
+
+
+RRTPLANNER_FRAMEWORK_ALGORITHM_GJK_BEGIN_NAMESPACE
+
+class GjkCachePrivate;
+
+/**
+ * @brief The GjkCache class stores the last GJK search direction of each shape pair.
+ * @details Pairs are identified by an id chosen by the caller, e.g., vessel id and obstacle id packed into 64 bits.
+ * The id has to refer to the same two shapes, in the same order, in every query. Entries are never evicted; call
+ * remove() or clear() when obstacles go away.
+ *
+ * Not thread-safe: give each thread its own cache.
+ */
+class RRTPLANNER_LIB_EXPORT GjkCache
+{
+public:
+    /**
+     * @brief Default constructor. Constructs an empty cache.
+     */
+    GjkCache();
+
+    /**
+     * @brief Copy constructor.
+     * @param other The GjkCache object to copy from.
+     */
+    GjkCache(const GjkCache& other);
+
+    /**
+     * @brief Assignment operator.
+     * @param other The GjkCache object to assign from.
+     * @return A reference to this GjkCache object after the assignment.
+     */
+    GjkCache& operator=(const GjkCache& other);
+
+    /**
+     * @brief Destructor.
+     */
+    ~GjkCache();
+
+    /**
+     * @brief Get the search direction stored for a pair.
+     * @param[in] pairId Id of the pair.
+     * @param[out] searchDir The stored direction, untouched if there is none.
+     * @return True if the pair has a stored direction.
+     */
+    bool searchDir(quint64 pairId, Vec2& searchDir) const;
+
+    /**
+     * @brief Store the search direction of a pair, replacing any previous one.
+     */
+    void setSearchDir(quint64 pairId, const Vec2& searchDir);
+
+    /**
+     * @brief Remove the entry of a pair.
+     */
+    void remove(quint64 pairId);
+
+    /**
+     * @brief Remove all entries.
+     */
+    void clear();
+
+    /**
+     * @brief Number of pairs with a stored direction.
+     */
+    int size() const;
+
+private:
+    QSharedDataPointer<GjkCachePrivate> d_ptr;
+};
+
+
+RRTPLANNER_FRAMEWORK_ALGORITHM_GJK_END_NAMESPACE
+
+#endif
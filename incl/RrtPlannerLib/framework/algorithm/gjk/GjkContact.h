@@ -0,0 +1,37 @@
+/**
+ * @file GjkContact.h
+ * @brief Contact information between two convex shapes, filled by Gjk::chkContact().
+ *
+ * @authors Enric Xargay Mata, ycw
+ * @date 2024-03-18
+ */
+
+#ifndef RRTPLANNERLIB_FRAMEWORK_ALGORITHM_GJK_GJKCONTACT_H
+#define RRTPLANNERLIB_FRAMEWORK_ALGORITHM_GJK_GJKCONTACT_H
+
+#include <RrtPlannerLib/RrtPlannerLibGlobal.h>
+#include <RrtPlannerLib/framework/Vec2.h>
+
+RRTPLANNER_FRAMEWORK_ALGORITHM_GJK_BEGIN_NAMESPACE
+
+/**
+ * @brief Closest or deepest points of two convex shapes.
+ *
+ * normal always points from shape1 towards shape2:
+ *   - shapes apart:       witness2 - witness1 = distance * normal, witness1/2 are the closest points.
+ *   - shapes intersect:   witness1 - witness2 = depth * normal, i.e., translating shape2 by depth * normal leaves
+ *                         the shapes touching. witness1/2 are the deepest points of each shape inside the other.
+ */
+struct GjkContact
+{
+    double distance{};  ///< [m] Separation if the shapes do not intersect, 0 otherwise.
+    double depth{};     ///< [m] Penetration depth if the shapes intersect, 0 otherwise.
+    Vec2 normal;        ///< Unit contact normal, from shape1 towards shape2.
+    Vec2 witness1;      ///< Witness point on shape1.
+    Vec2 witness2;      ///< Witness point on shape2.
+    bool isValid{false};///< True if all of the above were computed.
+};
+
+RRTPLANNER_FRAMEWORK_ALGORITHM_GJK_END_NAMESPACE
+
+#endif // RRTPLANNERLIB_FRAMEWORK_ALGORITHM_GJK_GJKCONTACT_H
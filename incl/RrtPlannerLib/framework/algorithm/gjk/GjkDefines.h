@@ -3,5 +3,10 @@
 
 #define MAX_ITER 1000 //Max allowable iterations in Gjk.
 #define EPS_SQUARE 1e-6 //For determining if a support point is on origin or simplex.
+#define EPA_MAX_VERTEX 64 //Max number of polytope vertices in the Epa expansion.
+#define SWEEP_DISTANCE_TOL 1e-2 //[m] Distance taken as contact in the swept collision check.
+#define GJK_BATCH_LANES 4 //Shape pairs evaluated in lockstep by GjkBatch, one AVX2 register of doubles.
+#define CSPACE_HEADING_BUCKETS 72 //Heading buckets of CSpaceObstacleSet, 5 deg each.
+#define SDF_MAX_NODE (1 << 24) //Max nodes of a SignedDistanceGrid, 64 MB of floats.
 
 #endif
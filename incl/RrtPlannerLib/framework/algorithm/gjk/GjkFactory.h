@@ -32,13 +32,14 @@ public:
      */
     enum class GjkType {
         Basic,    /**< Just checking for intersection. */
-        MinDist   /**< Checking for intersection and min dist between two shapes if they do not intersect. */
+        MinDist,  /**< Checking for intersection and min dist between two shapes if they do not intersect. */
+        Epa       /**< As MinDist, plus penetration depth, contact normal and witness points from chkContact(). */
     };
     Q_ENUM(GjkType);
 
     /**
      * @brief Get the Gjk algorithm based on the specified GjkType.
-     * @param gjkType The type of Gjk algorithm to create (Basic or MinDist).
+     * @param gjkType The type of Gjk algorithm to create (Basic, MinDist or Epa).
      * @return A pointer to the Gjk object.
      *
      * The caller is responsible for managing the memory of the returned Gjk object.
@@ -0,0 +1,597 @@
+/**
+ * @file GjkKernel.h
+ * @brief Header-only GJK with compile-time shape dispatch.
+ *
+ * Gjk::chkIntersect() takes two IShape references, so every support point costs two virtual calls, and the simplex
+ * and support steps are virtual as well. intersect() and intersectMinDist() below run the same iterations as
+ * GjkBasic and GjkMinDist, but are templates over the two shape types: any type with
+ *   Vec2 support(const Vec2& dir) const;
+ *   Vec2 centroid() const;
+ * can be used, and with a concrete shape type the support functions inline into the loop. The simplex lives in a
+ * fixed size array on the stack (SimplexKernel.h), so a call allocates nothing.
+ *
+ * intersectWarmStart() is intersect() seeded with the search direction of a previous query, see GjkCache.
+ *
+ * closestPoints() is the GJK distance iteration with the witness points on both shapes and an early stop once the
+ * shapes are known to be further apart than a given distance, used by isSeparated() for clearance queries.
+ * intersectContact() adds the penetration depth of intersecting shapes from an Expanding Polytope Algorithm (EPA)
+ * stage seeded with the terminating GJK simplex. sweepContact() finds the first contact of a footprint moving
+ * between two poses by conservative advancement on closestPoints().
+ *
+ * PointView and ConvexView are such shapes, non-owning and with the centroid computed once at construction. They
+ * suit the hot collision checks: point vs sector quad, rectangle hull vs convex obstacle. IShape references work
+ * too (through virtual calls), which is how GjkBasic and GjkMinDist use these kernels.
+ *
+ * @see Gjk.h, SimplexKernel.h
+ * @authors Enric Xargay Mata, ycw
+ * @date 2024-03-18
+ */
+
+#ifndef RRTPLANNERLIB_FRAMEWORK_ALGORITHM_GJK_GJKKERNEL_H
+#define RRTPLANNERLIB_FRAMEWORK_ALGORITHM_GJK_GJKKERNEL_H
+
+#include <RrtPlannerLib/RrtPlannerLibGlobal.h>
+#include <RrtPlannerLib/framework/Vec2.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/GjkContact.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/GjkDefines.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/GjkPose.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/internal/SimplexKernel.h>
+#include <QDebug>
+#include <QtGlobal>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+RRTPLANNER_FRAMEWORK_ALGORITHM_GJK_BEGIN_NAMESPACE
+
+/**
+ * @brief Point shape for the GJK kernel.
+ */
+class PointView
+{
+public:
+    explicit PointView(const Vec2& pt)
+        :m_pt(pt)
+    {}
+
+    Vec2 centroid() const { return(m_pt); }
+    Vec2 support(const Vec2&) const { return(m_pt); }
+
+private:
+    Vec2 m_pt;
+};
+
+/**
+ * @brief Convex polygon shape for the GJK kernel, viewing vertices owned by the caller.
+ *
+ * The vertices have to outlive the view. They can be in any order, the support is the maximum over all of them.
+ * The centroid is computed at construction unless given.
+ */
+class ConvexView
+{
+public:
+    ConvexView(const Vec2* vertexList, int nVertex)
+        :m_vertexList(vertexList),
+          m_nVertex(nVertex)
+    {
+        Q_ASSERT(nVertex > 0);
+        for(int i = 0; i < nVertex; ++i){
+            m_centroid += vertexList[i];
+        }
+        m_centroid *= 1.0/nVertex;
+    }
+
+    ConvexView(const Vec2* vertexList, int nVertex, const Vec2& centroid)
+        :m_vertexList(vertexList),
+          m_nVertex(nVertex),
+          m_centroid(centroid)
+    {
+        Q_ASSERT(nVertex > 0);
+    }
+
+    Vec2 centroid() const { return(m_centroid); }
+
+    Vec2 support(const Vec2& dir) const
+    {
+        int iMax = 0;
+        double maxVal = -std::numeric_limits<double>::max();
+        for(int i = 0; i < m_nVertex; ++i){
+            double val = m_vertexList[i].dot(dir);
+            if(val > maxVal){
+                maxVal = val;
+                iMax = i;
+            }
+        }
+        return(m_vertexList[iMax]);
+    }
+
+    int size() const { return(m_nVertex); }
+    const Vec2& at(int i) const { return(m_vertexList[i]); }
+
+private:
+    const Vec2* m_vertexList;
+    int m_nVertex;
+    Vec2 m_centroid;
+};
+
+/**
+ * @brief Shape in vessel coordinates (u, v) placed at a pose, for the GJK kernel.
+ *
+ * Views the shape, which has to outlive the view. Support and centroid are those of the shape mapped by
+ * GjkPose::toWorld().
+ */
+template<class Shape>
+class PoseView
+{
+public:
+    PoseView(const Shape& shape, const GjkPose& pose)
+        :m_shape(shape),
+          m_position(pose.position)
+    {
+        double theta = pose.heading * M_PI / 180.0;
+        m_cos = std::cos(theta);
+        m_sin = std::sin(theta);
+    }
+
+    Vec2 centroid() const { return(toWorld(m_shape.centroid())); }
+
+    Vec2 support(const Vec2& dir) const
+    {
+        return(toWorld(m_shape.support(Vec2(-dir[0]*m_cos - dir[1]*m_sin, -dir[0]*m_sin + dir[1]*m_cos))));
+    }
+
+private:
+    Vec2 toWorld(const Vec2& uv) const
+    {
+        return(m_position + Vec2(-uv[0]*m_cos - uv[1]*m_sin, -uv[0]*m_sin + uv[1]*m_cos));
+    }
+
+    const Shape& m_shape;
+    Vec2 m_position;
+    double m_cos;
+    double m_sin;
+};
+
+/**
+ * @brief Intersection test of two convex shapes starting from a given search direction.
+ *
+ * A direction that separated the shapes in a previous query, e.g., from a GjkCache, usually still does and then
+ * settles the query with one support point on each shape.
+ * @param[in] shape1 The first shape.
+ * @param[in] shape2 The second shape.
+ * @param[in,out] searchDir In: initial search direction, the centroid difference if zero. Out: the last search
+ * direction, a separating direction of the shapes if they do not intersect.
+ * @param[in] eps_square Tolerance to determine if a support point is on the origin or simplex.
+ * @param[in] maxIter Maximum number of iterations.
+ * @return True if the shapes intersect, false otherwise.
+ */
+template<class ShapeA, class ShapeB>
+inline bool intersectWarmStart(const ShapeA& shape1, const ShapeB& shape2, Vec2& searchDir,
+                               double eps_square = EPS_SQUARE, int maxIter = MAX_ITER)
+{
+    if(searchDir.norm2_square() <= 0.0){
+        searchDir = shape2.centroid() - shape1.centroid(); //arbitrary search dir
+    }
+    Vec2 spp = shape2.support(searchDir) - shape1.support(-searchDir);
+    if(spp.norm2_square() < eps_square){
+        return(true); //support on origin
+    }
+    double spp_dot_v = spp.dot(searchDir);
+    if(spp_dot_v < 0 && spp_dot_v*spp_dot_v > eps_square*searchDir.norm2_square()){
+        return(false); //support short of origin
+    }
+
+    SimplexBasicKernel simplex(eps_square);
+    Vec2 v;
+    simplex.update(spp, v);
+    bool isIntersect{false};
+    int k = 0;
+    while(k++ < maxIter){
+        spp = shape2.support(v) - shape1.support(-v);
+        if(spp.norm2_square() < eps_square){
+            isIntersect = true;
+            break;
+        }
+        spp_dot_v = spp.dot(v);
+        if(spp_dot_v < 0 && spp_dot_v*spp_dot_v > eps_square*v.norm2_square()){
+            break;
+        }
+        isIntersect = simplex.update(spp, v);
+        if(isIntersect){
+            break;
+        }
+    }
+    if(k > maxIter - 1){
+        qWarning() << "[gjk::intersect] Maximum iteration reached while searching for origin in simplex. Results may not be accurate!";
+    }
+    if(v.norm2_square() > 0.0){
+        searchDir = v;
+    }
+    return(isIntersect);
+}
+
+/**
+ * @brief Intersection test of two convex shapes, same results as GjkBasic::chkIntersect().
+ * @param shape1 The first shape.
+ * @param shape2 The second shape.
+ * @param eps_square Tolerance to determine if a support point is on the origin or simplex.
+ * @param maxIter Maximum number of iterations.
+ * @return True if the shapes intersect, false otherwise.
+ */
+template<class ShapeA, class ShapeB>
+inline bool intersect(const ShapeA& shape1, const ShapeB& shape2,
+                      double eps_square = EPS_SQUARE, int maxIter = MAX_ITER)
+{
+    Vec2 searchDir = shape2.centroid() - shape1.centroid(); //arbitrary search dir
+    return(intersectWarmStart(shape1, shape2, searchDir, eps_square, maxIter));
+}
+
+/**
+ * @brief Intersection test of two convex shapes with the distance between them if they do not intersect, same
+ * results as GjkMinDist::chkIntersect().
+ * @param[in] shape1 The first shape.
+ * @param[in] shape2 The second shape.
+ * @param[out] distance The minimum distance between the shapes if they do not intersect.
+ * @param[out] isValidDistance True if distance was computed, i.e., the shapes do not intersect and the iteration
+ * converged.
+ * @param[in] eps_square Tolerance to determine if a support point is on the origin or simplex.
+ * @param[in] maxIter Maximum number of iterations.
+ * @return True if the shapes intersect, false otherwise.
+ */
+template<class ShapeA, class ShapeB>
+inline bool intersectMinDist(const ShapeA& shape1, const ShapeB& shape2,
+                             double& distance, bool& isValidDistance,
+                             double eps_square = EPS_SQUARE, int maxIter = MAX_ITER)
+{
+    distance = 0.0;
+    isValidDistance = false;
+    Vec2 searchDir = shape2.centroid() - shape1.centroid(); //arbitrary search dir
+    Vec2 spp = shape2.support(searchDir) - shape1.support(-searchDir);
+    if(spp.norm2_square() < eps_square){
+        return(true); //support on origin
+    }
+
+    SimplexMinDistKernel simplex(eps_square);
+    simplex.update(spp, searchDir);
+    bool isIntersect{false};
+    int k = 0;
+    while(k++ < maxIter){
+        spp = shape2.support(searchDir) - shape1.support(-searchDir);
+        if(spp.norm2_square() < eps_square){
+            isIntersect = true;
+            break;
+        }
+        double s = (spp + searchDir).dot(searchDir);
+        if(s*s < eps_square*searchDir.norm2_square()){ //no progress towards the origin => searchDir is the distance
+            distance = searchDir.norm2();
+            isValidDistance = true;
+            break;
+        }
+        isIntersect = simplex.update(spp, searchDir);
+        if(isIntersect){
+            break;
+        }
+    }
+    if(k > maxIter - 1){
+        qWarning() << "[gjk::intersectMinDist] Maximum iteration reached while searching for origin in simplex. Results may not be accurate!";
+    }
+    return(isIntersect);
+}
+
+/**
+ * @brief Penetration depth of two intersecting convex shapes by the Expanding Polytope Algorithm.
+ *
+ * The polytope starts from the GJK simplex, blown up to a triangle if GJK stopped on an edge or a vertex (touching
+ * shapes), and grows by the support point in the normal of its edge closest to the origin until that support point
+ * is no further out than the edge. The polytope lives in fixed size arrays of EPA_MAX_VERTEX vertices on the stack.
+ * @param[in] shape1 The first shape.
+ * @param[in] shape2 The second shape.
+ * @param[in] simplex Simplex of shape2 - shape1 at which GJK found the intersection.
+ * @param[out] contact Depth, normal and witness points, see GjkContact.
+ * @param[in] eps_square Square of the tolerance on the depth.
+ * @param[in] maxIter Maximum number of iterations.
+ */
+template<class ShapeA, class ShapeB>
+inline void expandPolytope(const ShapeA& shape1, const ShapeB& shape2, const SimplexWitnessKernel& simplex,
+                           GjkContact& contact, double eps_square = EPS_SQUARE, int maxIter = MAX_ITER)
+{
+    Vec2 vertex[EPA_MAX_VERTEX];
+    Vec2 support1[EPA_MAX_VERTEX];
+    Vec2 support2[EPA_MAX_VERTEX];
+    int n = simplex.size();
+    for(int i = 0; i < n; ++i){
+        vertex[i] = simplex.at(i);
+        support1[i] = simplex.support1(i);
+        support2[i] = simplex.support2(i);
+    }
+    auto append = [&](const Vec2& dir){
+        support1[n] = shape1.support(-dir);
+        support2[n] = shape2.support(dir);
+        vertex[n] = support2[n] - support1[n];
+        ++n;
+    };
+
+    //blow up to a triangle. The origin is then inside or on its boundary.
+    const Vec2 axisList[4] = {Vec2(1.0, 0.0), Vec2(-1.0, 0.0), Vec2(0.0, 1.0), Vec2(0.0, -1.0)};
+    for(int i = 0; i < 4 && n == 1; ++i){
+        append(axisList[i]);
+        if((vertex[1] - vertex[0]).norm2_square() <= eps_square){
+            --n;
+        }
+    }
+    if(n == 2){
+        Vec2 perp = (vertex[1] - vertex[0]).cross_z();
+        for(double sign: {1.0, -1.0}){
+            append(perp * sign);
+            double offset = perp.dot(vertex[2] - vertex[0]);
+            if(offset*offset > eps_square * perp.norm2_square()){
+                break;
+            }
+            --n;
+        }
+    }
+    if(n < 3){ //flat Minkowski difference, e.g., two segments: the shapes touch
+        Vec2 dir = n == 2? (vertex[1] - vertex[0]).cross_z() : Vec2(1.0, 0.0);
+        contact.depth = 0.0;
+        contact.normal = dir * (1.0/dir.norm2());
+        contact.witness1 = support1[0];
+        contact.witness2 = support2[0];
+        contact.isValid = true;
+        return;
+    }
+    if((vertex[1] - vertex[0]).cross_zVal(vertex[2] - vertex[0]) < 0.0){ //counter-clockwise
+        std::swap(vertex[1], vertex[2]);
+        std::swap(support1[1], support1[2]);
+        std::swap(support2[1], support2[2]);
+    }
+
+    bool isConverged{false};
+    int iEdge = 0;
+    double depth = 0.0;
+    Vec2 normal;
+    int k = 0;
+    while(k++ < maxIter){
+        //edge closest to the origin, with its outward normal
+        depth = std::numeric_limits<double>::max();
+        for(int i = 0; i < n; ++i){
+            Vec2 e = vertex[i + 1 == n? 0 : i + 1] - vertex[i];
+            double length = e.norm2();
+            if(length <= 0.0){
+                continue;
+            }
+            Vec2 nrm = e.cross_z() * (1.0/length);
+            double d = nrm.dot(vertex[i]);
+            if(d < depth){
+                depth = d;
+                normal = nrm;
+                iEdge = i;
+            }
+        }
+
+        Vec2 spp1 = shape1.support(-normal);
+        Vec2 spp2 = shape2.support(normal);
+        double gap = (spp2 - spp1).dot(normal) - depth;
+        if(gap < 0.0 || gap*gap < eps_square){
+            isConverged = true;
+            break;
+        }
+        if(n == EPA_MAX_VERTEX){
+            break;
+        }
+
+        //insert the support point between the vertices of the edge
+        for(int i = n; i > iEdge + 1; --i){
+            vertex[i] = vertex[i - 1];
+            support1[i] = support1[i - 1];
+            support2[i] = support2[i - 1];
+        }
+        support1[iEdge + 1] = spp1;
+        support2[iEdge + 1] = spp2;
+        vertex[iEdge + 1] = spp2 - spp1;
+        ++n;
+    }
+    if(!isConverged){
+        qWarning() << "[gjk::expandPolytope] Maximum iteration or polytope size reached while expanding. Results may not be accurate!";
+    }
+
+    //witness points from the projection of the origin on the closest edge
+    int jEdge = iEdge + 1 == n? 0 : iEdge + 1;
+    Vec2 e = vertex[jEdge] - vertex[iEdge];
+    double t = std::min(std::max((normal * depth - vertex[iEdge]).dot(e) / e.norm2_square(), 0.0), 1.0);
+    contact.depth = std::max(depth, 0.0);
+    contact.normal = -normal; //the Minkowski difference is shape2 - shape1
+    contact.witness1 = support1[iEdge] + (support1[jEdge] - support1[iEdge]) * t;
+    contact.witness2 = support2[iEdge] + (support2[jEdge] - support2[iEdge]) * t;
+    contact.isValid = isConverged;
+}
+
+/**
+ * @brief Outcome of closestPoints().
+ */
+enum class ClosestPointsResult {
+    Intersect,      /**< The shapes intersect. */
+    Converged,      /**< Distance and witness points computed. */
+    BeyondMax       /**< Stopped early, the distance is larger than the requested maximum. */
+};
+
+/**
+ * @brief GJK distance iteration on the Minkowski difference shape2 - shape1, keeping the witness points.
+ *
+ * Each iteration gives an upper bound |v| and, from the support point w in direction -v, a lower bound v.w/|v| of
+ * the distance. The iteration stops once the bounds are within sqrt(eps_square), or as soon as the lower bound
+ * exceeds distanceMax.
+ * @param[in] shape1 The first shape.
+ * @param[in] shape2 The second shape.
+ * @param[in] distanceMax [m] Stop as soon as the distance is known to be larger than this.
+ * @param[out] simplex Final simplex, e.g., to seed expandPolytope() if the shapes intersect.
+ * @param[out] contact Converged: distance, normal and witness points. BeyondMax: distance is the lower bound.
+ * Intersect: untouched apart from reset.
+ * @param[in] eps_square Square of the tolerance on the distance.
+ * @param[in] maxIter Maximum number of iterations.
+ */
+template<class ShapeA, class ShapeB>
+inline ClosestPointsResult closestPoints(const ShapeA& shape1, const ShapeB& shape2, double distanceMax,
+                                         SimplexWitnessKernel& simplex, GjkContact& contact,
+                                         double eps_square = EPS_SQUARE, int maxIter = MAX_ITER)
+{
+    contact = GjkContact();
+    Vec2 searchDir = shape2.centroid() - shape1.centroid(); //arbitrary search dir
+    if(searchDir.norm2_square() <= 0.0){
+        searchDir = Vec2(1.0, 0.0);
+    }
+    simplex.reset();
+    simplex.add(shape1.support(-searchDir), shape2.support(searchDir));
+    Vec2 v; //point of the simplex closest to the origin
+    simplex.reduce(v);
+
+    int k = 0;
+    while(k++ < maxIter){
+        double vSquare = v.norm2_square();
+        if(vSquare < eps_square){ //origin on the simplex
+            return(ClosestPointsResult::Intersect);
+        }
+        Vec2 spp1 = shape1.support(v);
+        Vec2 spp2 = shape2.support(-v);
+        double v_dot_w = v.dot(spp2 - spp1);
+        if(v_dot_w > 0.0 && v_dot_w*v_dot_w > distanceMax*distanceMax*vSquare){ //lower bound beyond distanceMax
+            contact.distance = v_dot_w / std::sqrt(vSquare);
+            return(ClosestPointsResult::BeyondMax);
+        }
+        double gap = vSquare - v_dot_w; //|v| * (upper - lower bound of the distance)
+        if(gap < 0.0 || gap*gap < eps_square*vSquare){
+            contact.distance = std::sqrt(vSquare);
+            contact.normal = v * (1.0/contact.distance);
+            simplex.witness(contact.witness1, contact.witness2);
+            contact.isValid = true;
+            return(ClosestPointsResult::Converged);
+        }
+        simplex.add(spp1, spp2);
+        if(simplex.reduce(v)){
+            return(ClosestPointsResult::Intersect);
+        }
+    }
+    qWarning() << "[gjk::closestPoints] Maximum iteration reached while searching for origin in simplex. Results may not be accurate!";
+    contact.distance = v.norm2();
+    contact.normal = v * (1.0/contact.distance);
+    simplex.witness(contact.witness1, contact.witness2);
+    return(ClosestPointsResult::Converged);
+}
+
+/**
+ * @brief Intersection test of two convex shapes with their contact information.
+ *
+ * If the shapes do not intersect, the closest points follow from closestPoints(). Otherwise expandPolytope() gives
+ * the penetration depth, continuing from the simplex at which GJK stopped.
+ * @param[in] shape1 The first shape.
+ * @param[in] shape2 The second shape.
+ * @param[out] contact Distance or depth, normal and witness points, see GjkContact.
+ * @param[in] eps_square Square of the tolerance on distance and depth.
+ * @param[in] maxIter Maximum number of iterations, of GJK and of EPA each.
+ * @return True if the shapes intersect, false otherwise.
+ */
+template<class ShapeA, class ShapeB>
+inline bool intersectContact(const ShapeA& shape1, const ShapeB& shape2, GjkContact& contact,
+                             double eps_square = EPS_SQUARE, int maxIter = MAX_ITER)
+{
+    SimplexWitnessKernel simplex;
+    ClosestPointsResult result = closestPoints(shape1, shape2, std::numeric_limits<double>::max(), simplex, contact,
+                                               eps_square, maxIter);
+    if(result == ClosestPointsResult::Intersect){
+        expandPolytope(shape1, shape2, simplex, contact, eps_square, maxIter);
+        return(true);
+    }
+    return(false);
+}
+
+/**
+ * @brief Clearance test of two convex shapes: true if they are further apart than distanceMin.
+ *
+ * The distance iteration stops as soon as its lower bound exceeds distanceMin, so shapes far apart cost one or two
+ * support queries each.
+ * @param[in] shape1 The first shape.
+ * @param[in] shape2 The second shape.
+ * @param[in] distanceMin [m] Required clearance.
+ * @param[out] contact If the iteration converged, i.e., the distance is at most about distanceMin, the distance,
+ * normal and witness points (contact.isValid). If it stopped early, contact.distance is a lower bound of the
+ * distance, larger than distanceMin. Zero if the shapes intersect.
+ * @param[in] eps_square Square of the tolerance on the distance.
+ * @param[in] maxIter Maximum number of iterations.
+ * @return True if the distance between the shapes is larger than distanceMin.
+ */
+template<class ShapeA, class ShapeB>
+inline bool isSeparated(const ShapeA& shape1, const ShapeB& shape2, double distanceMin, GjkContact& contact,
+                        double eps_square = EPS_SQUARE, int maxIter = MAX_ITER)
+{
+    SimplexWitnessKernel simplex;
+    ClosestPointsResult result = closestPoints(shape1, shape2, distanceMin, simplex, contact, eps_square, maxIter);
+    return(result == ClosestPointsResult::BeyondMax ||
+           (result == ClosestPointsResult::Converged && contact.distance > distanceMin));
+}
+
+/**
+ * @brief First contact of a footprint moving from poseStart to poseEnd with a static obstacle.
+ *
+ * The footprint moves along GjkPose::interpolate() for t in [0, 1]. Conservative advancement: at time t with
+ * distance d and normal n (from closestPoints()), no point of the footprint approaches the separating line faster
+ * than mu = (end - start).n + |heading change| * rMax per unit t, where rMax bounds the distance of the footprint
+ * from its vessel coordinates origin. So t can advance by d / mu without missing a contact, however thin the
+ * obstacle. The iteration stops when d is within distanceTol (contact), when mu <= 0 or t > 1 (no contact).
+ * @param[in] footprint The moving shape, in vessel coordinates (u, v).
+ * @param[in] poseStart Pose at t = 0.
+ * @param[in] poseEnd Pose at t = 1.
+ * @param[in] obstacle The static shape, in (northing, easting).
+ * @param[out] timeContact Time of first contact in [0, 1], 1 if none.
+ * @param[out] contact If in contact, closest points at timeContact as from closestPoints() with the footprint
+ * as shape1. Zero distance and not valid if the shapes intersect there, e.g., already at t = 0.
+ * @param[in] distanceTol [m] Distance taken as contact. Larger than sqrt(eps_square).
+ * @param[in] eps_square Square of the tolerance on the distance.
+ * @param[in] maxIter Maximum number of iterations, of the advancement and of each GJK.
+ * @return True if the footprint touches the obstacle for some t in [0, 1].
+ */
+template<class ShapeA, class ShapeB>
+inline bool sweepContact(const ShapeA& footprint, const GjkPose& poseStart, const GjkPose& poseEnd,
+                         const ShapeB& obstacle, double& timeContact, GjkContact& contact,
+                         double distanceTol = SWEEP_DISTANCE_TOL,
+                         double eps_square = EPS_SQUARE, int maxIter = MAX_ITER)
+{
+    //bounding box of the footprint in vessel coordinates => bound of its distance from the origin
+    double uMax = std::max(std::abs(footprint.support(Vec2(1.0, 0.0))[0]), std::abs(footprint.support(Vec2(-1.0, 0.0))[0]));
+    double vMax = std::max(std::abs(footprint.support(Vec2(0.0, 1.0))[1]), std::abs(footprint.support(Vec2(0.0, -1.0))[1]));
+    double rotationBound = std::abs(GjkPose::headingChange(poseStart, poseEnd)) * M_PI / 180.0 * std::sqrt(uMax*uMax + vMax*vMax);
+    Vec2 translation = poseEnd.position - poseStart.position;
+
+    SimplexWitnessKernel simplex;
+    double t = 0.0;
+    int k = 0;
+    while(k++ < maxIter){
+        PoseView<ShapeA> moved(footprint, GjkPose::interpolate(poseStart, poseEnd, t));
+        ClosestPointsResult result = closestPoints(moved, obstacle, std::numeric_limits<double>::max(), simplex, contact,
+                                                   eps_square, maxIter);
+        if(result == ClosestPointsResult::Intersect || contact.distance <= distanceTol){
+            if(result == ClosestPointsResult::Intersect){
+                contact.distance = 0.0;
+            }
+            timeContact = t;
+            return(true);
+        }
+        double closingSpeed = translation.dot(contact.normal) + rotationBound;
+        if(closingSpeed <= 0.0){
+            break;
+        }
+        t += contact.distance / closingSpeed;
+        if(t > 1.0){
+            break;
+        }
+    }
+    if(k > maxIter){
+        qWarning() << "[gjk::sweepContact] Maximum iteration reached while advancing the footprint. Assuming contact.";
+        timeContact = t;
+        return(true);
+    }
+    timeContact = 1.0;
+    return(false);
+}
+
+RRTPLANNER_FRAMEWORK_ALGORITHM_GJK_END_NAMESPACE
+
+#endif // RRTPLANNERLIB_FRAMEWORK_ALGORITHM_GJK_GJKKERNEL_H
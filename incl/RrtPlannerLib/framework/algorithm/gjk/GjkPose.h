@@ -0,0 +1,68 @@
+/**
+ * @file GjkPose.h
+ * @brief Planar pose of a vessel footprint, used by Gjk::chkSweep().
+ *
+ * @authors Enric Xargay Mata, ycw
+ * @date 2024-03-18
+ */
+
+#ifndef RRTPLANNERLIB_FRAMEWORK_ALGORITHM_GJK_GJKPOSE_H
+#define RRTPLANNERLIB_FRAMEWORK_ALGORITHM_GJK_GJKPOSE_H
+
+#include <RrtPlannerLib/RrtPlannerLibGlobal.h>
+#include <RrtPlannerLib/framework/Vec2.h>
+#include <cmath>
+#include <math.h> //for M_PI
+
+RRTPLANNER_FRAMEWORK_ALGORITHM_GJK_BEGIN_NAMESPACE
+
+/**
+ * @brief Position and heading of the vessel coordinates in (northing, easting).
+ *
+ * A footprint is given in vessel coordinates as VesShape: origin at the boat center, u-axis towards aft, v-axis
+ * towards starboard, e.g., VesRectangle::polygon(). At heading 0 the bow points north.
+ */
+struct GjkPose
+{
+    Vec2 position;      ///< [m] (northing, easting) of the vessel coordinates origin.
+    double heading{};   ///< [deg] Clockwise from north.
+
+    /**
+     * @brief Maps a point from vessel coordinates (u, v) to (northing, easting).
+     */
+    Vec2 toWorld(const Vec2& uv) const
+    {
+        double theta = heading * M_PI / 180.0;
+        double cosTheta = std::cos(theta);
+        double sinTheta = std::sin(theta);
+        return(position + Vec2(-uv[0]*cosTheta - uv[1]*sinTheta, -uv[0]*sinTheta + uv[1]*cosTheta));
+    }
+
+    /**
+     * @brief Pose at fraction t of the way from start to end: linear in position, and in heading along the shorter
+     * turn.
+     */
+    static GjkPose interpolate(const GjkPose& start, const GjkPose& end, double t)
+    {
+        GjkPose ret;
+        ret.position = start.position + t * (end.position - start.position);
+        ret.heading = start.heading + t * headingChange(start, end);
+        return(ret);
+    }
+
+    /**
+     * @brief [deg] Heading change from start to end along the shorter turn, in [-180, 180).
+     */
+    static double headingChange(const GjkPose& start, const GjkPose& end)
+    {
+        double ret = std::fmod(end.heading - start.heading + 180.0, 360.0);
+        if(ret < 0.0){
+            ret += 360.0;
+        }
+        return(ret - 180.0);
+    }
+};
+
+RRTPLANNER_FRAMEWORK_ALGORITHM_GJK_END_NAMESPACE
+
+#endif // RRTPLANNERLIB_FRAMEWORK_ALGORITHM_GJK_GJKPOSE_H
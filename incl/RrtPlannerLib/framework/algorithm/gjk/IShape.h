@@ -11,7 +11,7 @@
 #define RRTPLANNERLIB_FRAMEWORK_ALGORITHM_GJK_SHAPE_H
 
 #include <RrtPlannerLib/RrtPlannerLibGlobal.h>
-#include <RrtPlannerLib/framework/VectorF.h>
+#include <RrtPlannerLib/framework/Vec2.h>
 #include <QDebug>
 
 /**
@@ -61,16 +61,16 @@ public:
 
     /**
      * @brief Get the centroid of the shape.
-     * @return The centroid of the shape as a VectorF object.
+     * @return The centroid of the shape as a Vec2 object.
      */
-    virtual VectorF centroid() const = 0;
+    virtual Vec2 centroid() const = 0;
 
     /**
      * @brief Get the support point of the shape in a given direction.
      * @param dir The input search direction vector.
-     * @return The support point of the shape in the given input direction as a VectorF object.
+     * @return The support point of the shape in the given input direction as a Vec2 object.
      */
-    virtual VectorF support(const VectorF& dir) const = 0;
+    virtual Vec2 support(const Vec2& dir) const = 0;
 
     /**
      * @brief Generate a debug string representation of the shape.
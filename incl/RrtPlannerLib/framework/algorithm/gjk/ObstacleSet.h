@@ -0,0 +1,110 @@
+/**
+ * @file ObstacleSet.h
+ * @brief Definition of the ObstacleSet class, a collection of convex obstacles for one-vs-many collision queries.
+ *
+ * Checking a footprint against N obstacles with Gjk::chkIntersect() costs N GJK runs, each recomputing both
+ * centroids. ObstacleSet stores the obstacle vertices contiguously with their centroids and axis-aligned bounding
+ * boxes (AABB). A query computes the AABB of the query shape once (4 support calls), rejects the obstacles whose
+ * AABB does not overlap with 4 compares each, and runs the GJK kernel (GjkKernel.h) only on the survivors.
+ *
+ * @authors Enric Xargay Mata, ycw
+ * @date 2024-03-18
+ */
+
+#ifndef RRTPLANNERLIB_FRAMEWORK_ALGORITHM_GJK_OBSTACLESET_H
+#define RRTPLANNERLIB_FRAMEWORK_ALGORITHM_GJK_OBSTACLESET_H
+
+#include <RrtPlannerLib/RrtPlannerLibGlobal.h>
+#include <RrtPlannerLib/framework/Vec2.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/IShape.h>
+#include <QSharedDataPointer>
+#include <QVector>
+
+
+RRTPLANNER_FRAMEWORK_ALGORITHM_GJK_BEGIN_NAMESPACE
+
+class ObstacleSetPrivate;
+class Polygon;
+
+/**
+ * @brief The ObstacleSet class holds convex obstacles and checks a query shape against all of them.
+ * @details Each obstacle is the convex hull of its vertices, as for Polygon. Obstacles are identified by the index
+ * returned by append(), in insertion order.
+ */
+class RRTPLANNER_LIB_EXPORT ObstacleSet
+{
+public:
+    /**
+     * @brief Default constructor. Constructs an empty set.
+     */
+    ObstacleSet();
+
+    /**
+     * @brief Copy constructor.
+     * @param other The ObstacleSet object to copy from.
+     */
+    ObstacleSet(const ObstacleSet& other);
+
+    /**
+     * @brief Assignment operator.
+     * @param other The ObstacleSet object to assign from.
+     * @return A reference to this ObstacleSet object after the assignment.
+     */
+    ObstacleSet& operator=(const ObstacleSet& other);
+
+    /**
+     * @brief Destructor.
+     */
+    ~ObstacleSet();
+
+    /**
+     * @brief Adds a convex obstacle.
+     * @param vertexList Vertices of the obstacle, at least one.
+     * @return Index of the obstacle.
+     */
+    int append(const QVector<Vec2>& vertexList);
+
+    /**
+     * @brief Adds a convex obstacle.
+     * @param polygon The obstacle.
+     * @return Index of the obstacle.
+     */
+    int append(const Polygon& polygon);
+
+    /**
+     * @brief Removes all obstacles.
+     */
+    void clear();
+
+    /**
+     * @brief Number of obstacles.
+     */
+    int size() const;
+
+    /**
+     * @brief Vertices of obstacle idx, there are vertexCount(idx) of them.
+     */
+    const Vec2* vertexData(int idx) const;
+    int vertexCount(int idx) const;
+
+    /**
+     * @brief Check a shape against all obstacles.
+     * @param[in] shape The query shape, e.g., a vessel footprint.
+     * @param[out] hitIdxList Cleared, then filled with the ascending indices of the obstacles intersecting the shape,
+     * or closer to it than distanceMax.
+     * @param[out] p_distanceList If not null, cleared, then filled with the distance of each obstacle in hitIdxList
+     * to the shape. 0 for intersecting obstacles.
+     * @param[in] distanceMax [m] Obstacles closer than this count as hits. 0 reports intersecting obstacles only.
+     * @return Number of hits.
+     */
+    int chkIntersect(const IShape& shape, QVector<int>& hitIdxList,
+                     QVector<double>* p_distanceList = nullptr, double distanceMax = 0.0) const;
+
+private:
+    QSharedDataPointer<ObstacleSetPrivate> d_ptr;
+};
+
+
+RRTPLANNER_FRAMEWORK_ALGORITHM_GJK_END_NAMESPACE
+
+#endif
@@ -14,7 +14,7 @@
 #define RRTPLANNERLIB_FRAMEWORK_ALGORITHM_GJK_POINTSHAPE_H
 
 #include <RrtPlannerLib/RrtPlannerLibGlobal.h>
-#include <RrtPlannerLib/framework/VectorF.h>
+#include <RrtPlannerLib/framework/Vec2.h>
 #include <RrtPlannerLib/framework/algorithm/gjk/IShape.h>
 #include <QSharedDataPointer>
 
@@ -36,7 +36,7 @@ public:
     /**
      * @brief Constructor.
      */
-    PointShape(const VectorF& pt);
+    PointShape(const Vec2& pt);
 
     /**
      * @brief Copy constructor to create a PointShape object as a copy of another PointShape.
@@ -58,15 +58,15 @@ public:
 
     /**
      * @brief Get the point of the shape.
-     * @return A const reference to the point as a VectorF object.
+     * @return A const reference to the point as a Vec2 object.
      */
-    const VectorF& pt() const;
+    const Vec2& pt() const;
 
     /**
      * @brief Set the point of the shape.
-     * @param pt The new point to set as a VectorF object.
+     * @param pt The new point to set as a Vec2 object.
      */
-    void setPt(const VectorF& pt);
+    void setPt(const Vec2& pt);
 
     /**
      * @brief Create a clone of the shape.
@@ -77,16 +77,16 @@ public:
 
     /**
      * @brief Get the centroid of the shape.
-     * @return The centroid of the shape as a VectorF object.
+     * @return The centroid of the shape as a Vec2 object.
      */
-    virtual VectorF centroid() const override;
+    virtual Vec2 centroid() const override;
 
     /**
      * @brief Get the support point of the shape in a given direction.
      * @param dir The input search direction vector.
-     * @return The support point of the shape in the given input direction as a VectorF object.
+     * @return The support point of the shape in the given input direction as a Vec2 object.
      */
-    virtual VectorF support(const VectorF& dir) const override;
+    virtual Vec2 support(const Vec2& dir) const override;
 
 protected:
     /**
@@ -15,7 +15,7 @@
 #define RRTPLANNERLIB_FRAMEWORK_ALGORITHM_GJK_POLYGON_H
 
 #include <RrtPlannerLib/RrtPlannerLibGlobal.h>
-#include <RrtPlannerLib/framework/VectorF.h>
+#include <RrtPlannerLib/framework/Vec2.h>
 #include <RrtPlannerLib/framework/algorithm/gjk/IShape.h>
 #include <QString>
 #include <QVector>
@@ -41,9 +41,9 @@ public:
 
     /**
      * @brief Constructor with an initializer list of vertices.
-     * @param list An initializer list of VectorF representing the vertices of the polygon.
+     * @param list An initializer list of Vec2 representing the vertices of the polygon.
      */
-    Polygon(const std::initializer_list<VectorF>& list);
+    Polygon(const std::initializer_list<Vec2>& list);
 
     /**
      * @brief Copy constructor.
@@ -72,17 +72,17 @@ public:
 
     /**
      * @brief Get the centroid of the Polygon.
-     * @return The centroid of the Polygon as a VectorF object.
+     * @return The centroid of the Polygon as a Vec2 object.
      */
-    virtual VectorF centroid() const override;
+    virtual Vec2 centroid() const override;
 
     /**
      * @brief Get the support point of the Polygon in a given direction.
      * @param dir The input direction vector.
-     * @return The support point of the Polygon in the given input direction as a VectorF object.
+     * @return The support point of the Polygon in the given input direction as a Vec2 object.
      * @details The input direction vector (dir) does not need to be a unit vector.
      */
-    virtual VectorF support(const VectorF& dir) const override;
+    virtual Vec2 support(const Vec2& dir) const override;
 
     /**
      * @brief Get the number of vertices in the Polygon.
@@ -93,28 +93,28 @@ public:
     /**
      * @brief Get the vertex at a specific index.
      * @param i The index of the vertex to retrieve.
-     * @return A constant reference to the VectorF representing the vertex at the specified index.
+     * @return A constant reference to the Vec2 representing the vertex at the specified index.
      */
-    const VectorF& at(int i) const;
+    const Vec2& at(int i) const;
 
     /**
      * @brief Get the vertex at a specific index for modification.
      * @param i The index of the vertex to retrieve.
-     * @return A reference to the VectorF representing the vertex at the specified index.
+     * @return A reference to the Vec2 representing the vertex at the specified index.
      */
-    VectorF& operator[](int i);
+    Vec2& operator[](int i);
 
     /**
      * @brief Get a constant reference to the list of vertices of the Polygon.
-     * @return A constant reference to the QVector of VectorF representing the vertices of the Polygon.
+     * @return A constant reference to the QVector of Vec2 representing the vertices of the Polygon.
      */
-    const QVector<VectorF>& vertexList_const_ref() const;
+    const QVector<Vec2>& vertexList_const_ref() const;
 
     /**
      * @brief Get a reference to the list of vertices of the Polygon for modification.
-     * @return A reference to the QVector of VectorF representing the vertices of the Polygon.
+     * @return A reference to the QVector of Vec2 representing the vertices of the Polygon.
      */
-    QVector<VectorF>& vertexList();
+    QVector<Vec2>& vertexList();
 
 protected:
     /**
@@ -0,0 +1,143 @@
+/**
+ * @file SignedDistanceGrid.h
+ * @brief Definition of the SignedDistanceGrid class, a rasterised signed distance field of static obstacles.
+ *
+ * Static obstacles (coastline, charted wrecks, exclusion polygons) do not change during a mission, yet a clearance
+ * query through ObstacleSet runs the GJK distance against every obstacle near the query. SignedDistanceGrid samples
+ * the signed distance to the obstacles once, on a uniform grid over a rectangle, e.g., EllMap::boundingBox(), and
+ * stores it as floats. A query then interpolates the 4 surrounding nodes bilinearly in O(1).
+ *
+ * The value at a node is the distance to the nearest obstacle outside all obstacles, and minus the largest
+ * penetration depth into a single obstacle inside them, truncated to [-distanceMax, distanceMax]. The field is
+ * 1-Lipschitz, so inside the grid the bilinear value differs from it by at most errorBound(), about sqrt(2)
+ * resolution.
+ * A sample whose value is further than errorBound() from the clearance of interest is decided by the grid alone.
+ * Only the samples near the boundary need the exact check with ObstacleSet.
+ *
+ * @see ObstacleSet.h, EllMap.h
+ * @authors Enric Xargay Mata, ycw
+ * @date 2024-03-18
+ */
+
+#ifndef RRTPLANNERLIB_FRAMEWORK_ALGORITHM_GJK_SIGNEDDISTANCEGRID_H
+#define RRTPLANNERLIB_FRAMEWORK_ALGORITHM_GJK_SIGNEDDISTANCEGRID_H
+
+#include <RrtPlannerLib/RrtPlannerLibGlobal.h>
+#include <RrtPlannerLib/framework/Vec2.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/GjkDefines.h>
+#include <QSharedDataPointer>
+
+
+RRTPLANNER_FRAMEWORK_ALGORITHM_GJK_BEGIN_NAMESPACE
+
+class SignedDistanceGridPrivate;
+class ObstacleSet;
+
+/**
+ * @brief The SignedDistanceGrid class samples the signed distance to the obstacles of an ObstacleSet on a uniform
+ * grid and interpolates it.
+ * @details Node (i, j) is at origin() + (i, j) resolution in (northing, easting), for i in [0, nN()) and j in
+ * [0, nE()). Each obstacle is the convex hull of its vertices, as for ObstacleSet. Copies share the grid until one
+ * of them is rebuilt.
+ */
+class RRTPLANNER_LIB_EXPORT SignedDistanceGrid
+{
+public:
+    /**
+     * @brief Default constructor. Constructs an empty grid.
+     */
+    SignedDistanceGrid();
+
+    /**
+     * @brief Copy constructor.
+     * @param other The SignedDistanceGrid object to copy from.
+     */
+    SignedDistanceGrid(const SignedDistanceGrid& other);
+
+    /**
+     * @brief Assignment operator.
+     * @param other The SignedDistanceGrid object to assign from.
+     * @return A reference to this SignedDistanceGrid object after the assignment.
+     */
+    SignedDistanceGrid& operator=(const SignedDistanceGrid& other);
+
+    /**
+     * @brief Destructor.
+     */
+    ~SignedDistanceGrid();
+
+    /**
+     * @brief Samples the signed distance to the obstacles over a rectangle.
+     * @param obstacleSet The obstacles.
+     * @param minNE [m] Minimum [Northing, Easting] of the rectangle, the first node.
+     * @param maxNE [m] Maximum [Northing, Easting] of the rectangle. The last nodes are at or beyond it.
+     * @param resolution [m] Spacing of the nodes, positive.
+     * @param distanceMax [m] Truncation of the signed distance, positive. Only the nodes within distanceMax of the
+     * bounding box of an obstacle are computed, so it bounds the build time as well.
+     * @return False if the input is invalid or the grid would exceed SDF_MAX_NODE nodes, the grid is then empty.
+     */
+    bool build(const ObstacleSet& obstacleSet, const Vec2& minNE, const Vec2& maxNE,
+               double resolution, double distanceMax);
+
+    /**
+     * @brief Empties the grid.
+     */
+    void clear();
+
+    /**
+     * @brief True if the grid is not built.
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief Number of nodes along northing and easting.
+     */
+    int nN() const;
+    int nE() const;
+
+    /**
+     * @brief [m] Position of node (0, 0), spacing of the nodes and truncation of the signed distance.
+     */
+    Vec2 origin() const;
+    double resolution() const;
+    double distanceMax() const;
+
+    /**
+     * @brief [m] Bound of the error of distance() inside the grid, sqrt(2) resolution plus the float rounding.
+     */
+    double errorBound() const;
+
+    /**
+     * @brief True if posNE is inside the rectangle spanned by the nodes.
+     */
+    bool contains(const Vec2& posNE) const;
+
+    /**
+     * @brief Signed distance at a node.
+     */
+    double nodeDistance(int i, int j) const;
+
+    /**
+     * @brief Bilinear signed distance at a position.
+     * @param posNE [m] Position [Northing, Easting]. Positions outside the grid are clamped to it.
+     * @return [m] Signed distance, negative inside an obstacle, distanceMax() if the grid is empty.
+     */
+    double distance(const Vec2& posNE) const;
+
+    /**
+     * @brief Bilinear signed distance and its gradient at a position.
+     * @param[in] posNE [m] Position [Northing, Easting]. Positions outside the grid are clamped to it.
+     * @param[out] gradient Gradient of the bilinear interpolant [d/dNorthing, d/dEasting], pointing away from the
+     * obstacles. Zero where the 4 surrounding nodes are truncated, or if the grid is empty.
+     * @return [m] Signed distance, as distance().
+     */
+    double distance(const Vec2& posNE, Vec2& gradient) const;
+
+private:
+    QSharedDataPointer<SignedDistanceGridPrivate> d_ptr;
+};
+
+
+RRTPLANNER_FRAMEWORK_ALGORITHM_GJK_END_NAMESPACE
+
+#endif
@@ -0,0 +1,61 @@
+/**
+ * @file ConvexHull.h
+ * @brief Convex hull of a point set, shared by the classes that precompute geometry of the obstacles.
+ *
+ * The obstacles of ObstacleSet and Polygon are the convex hull of unordered vertices. CSpaceObstacleSet and
+ * SignedDistanceGrid need the hull itself, as an ordered vertex list, which convexHull() provides.
+ *
+ * @see CSpaceObstacleSet.h, SignedDistanceGrid.h
+ * @authors Enric Xargay Mata, ycw
+ * @date 2024-03-18
+ */
+
+#ifndef RRTPLANNERLIB_FRAMEWORK_ALGORITHM_GJK_CONVEX_HULL_H
+#define RRTPLANNERLIB_FRAMEWORK_ALGORITHM_GJK_CONVEX_HULL_H
+
+#include <RrtPlannerLib/RrtPlannerLibGlobal.h>
+#include <RrtPlannerLib/framework/Vec2.h>
+#include <QVector>
+#include <algorithm>
+
+RRTPLANNER_FRAMEWORK_ALGORITHM_GJK_BEGIN_NAMESPACE
+
+/**
+ * @brief Convex hull by the monotone chain, counter-clockwise without collinear vertices, starting at the
+ * lexicographically smallest vertex (smallest northing, then easting).
+ * @param pts Points, any order, duplicates allowed.
+ * @return Hull vertices. 1 or 2 vertices if the points do not span an area.
+ */
+inline QVector<Vec2> convexHull(QVector<Vec2> pts)
+{
+    std::sort(pts.begin(), pts.end(), [](const Vec2& a, const Vec2& b){
+        return(a[0] < b[0] || (a[0] == b[0] && a[1] < b[1]));
+    });
+    pts.erase(std::unique(pts.begin(), pts.end(), [](const Vec2& a, const Vec2& b){
+        return(a[0] == b[0] && a[1] == b[1]);
+    }), pts.end());
+    if(pts.size() < 3){
+        return(pts);
+    }
+
+    QVector<Vec2> ret(2 * pts.size());
+    int k = 0;
+    for(int i = 0; i < pts.size(); ++i){ //lower chain
+        while(k >= 2 && (ret.at(k - 1) - ret.at(k - 2)).cross_zVal(pts.at(i) - ret.at(k - 2)) <= 0.0){
+            --k;
+        }
+        ret[k++] = pts.at(i);
+    }
+    for(int i = pts.size() - 2, kLower = k + 1; i >= 0; --i){ //upper chain
+        while(k >= kLower && (ret.at(k - 1) - ret.at(k - 2)).cross_zVal(pts.at(i) - ret.at(k - 2)) <= 0.0){
+            --k;
+        }
+        ret[k++] = pts.at(i);
+    }
+    ret.resize(k - 1); //last vertex repeats the first
+    return(ret);
+}
+
+RRTPLANNER_FRAMEWORK_ALGORITHM_GJK_END_NAMESPACE
+
+#endif
@@ -16,12 +16,9 @@
 #include <RrtPlannerLib/RrtPlannerLibGlobal.h>
 #include <RrtPlannerLib/framework/algorithm/gjk/Gjk.h>
 #include <RrtPlannerLib/framework/algorithm/gjk/IShape.h>
-#include <QScopedPointer>
 
 RRTPLANNER_FRAMEWORK_ALGORITHM_GJK_BEGIN_NAMESPACE
 
-class GjkBasicPrivate;
-
 /**
  * @brief The GjkBasic class provides a basic implementation of the GJK algorithm for collision detection.
  * @details This class is derived from the Gjk abstract class and represents a basic implementation of the
@@ -60,9 +57,6 @@ public:
      * @return True if the shapes intersect, false otherwise.
      */
     bool chkIntersect(const IShape& shape1, const IShape& shape2, double& distance, bool& isValidDistance);
-
-private:
-    QScopedPointer<GjkBasicPrivate> d_ptr;
 };
 
 RRTPLANNER_FRAMEWORK_ALGORITHM_GJK_END_NAMESPACE
@@ -0,0 +1,71 @@
+/**
+ * @file GjkEpa.h
+ * @brief Definition of the GjkEpa class, a GJK-based algorithm with penetration depth for intersecting shapes.
+ *
+ * This header file defines the GjkEpa class, which is derived from the Gjk abstract class. chkIntersect() is the
+ * same as GjkMinDist. chkContact() also returns the witness points and, for intersecting shapes, the penetration
+ * depth and contact normal from an Expanding Polytope Algorithm (EPA) stage seeded with the terminating GJK simplex.
+ *
+ * @see Gjk, GjkContact, GjkKernel.h
+ * @authors Enric Xargay Mata, ycw
+ * @date 2024-03-18
+ */
+#ifndef RRTPLANNERLIB_FRAMEWORK_ALGORITHM_GJK_GJKEPA_H
+#define RRTPLANNERLIB_FRAMEWORK_ALGORITHM_GJK_GJKEPA_H
+
+#include <RrtPlannerLib/RrtPlannerLibGlobal.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/Gjk.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/IShape.h>
+
+RRTPLANNER_FRAMEWORK_ALGORITHM_GJK_BEGIN_NAMESPACE
+
+/**
+ * @brief The GjkEpa class provides a GJK-based algorithm for the contact between two shapes, intersecting or not.
+ *
+ * @see Gjk, IShape
+ */
+class RRTPLANNER_LIB_EXPORT_FOR_BUILDTEST GjkEpa : public Gjk
+{
+public:
+    /**
+     * @brief Default constructor.
+     */
+    GjkEpa();
+
+    /**
+     * @brief Virtual destructor.
+     */
+    virtual ~GjkEpa();
+
+    /**
+     * @brief Copy constructor (deleted to make the class non-copyable).
+     * @param other The GjkEpa object to copy from.
+     */
+    GjkEpa(const GjkEpa& other) = delete;
+
+    /**
+     * @brief Check for intersection between two shapes and calculate the minimum distance, as GjkMinDist.
+     * @param shape1 The first shape.
+     * @param shape2 The second shape.
+     * @param distance The minimum distance between the shapes if they do not intersect (output parameter).
+     * @param isValidDistance A flag indicating whether the calculated distance is valid (output parameter).
+     * @return True if the shapes intersect, false otherwise.
+     */
+    bool chkIntersect(const IShape& shape1, const IShape& shape2, double& distance, bool& isValidDistance) override;
+
+    /**
+     * @brief Check for intersection between two shapes and get their contact information.
+     * @param shape1 The first shape.
+     * @param shape2 The second shape.
+     * @param contact Distance or penetration depth, contact normal and witness points (output parameter).
+     * @return True if the shapes intersect, false otherwise.
+     */
+    bool chkContact(const IShape& shape1, const IShape& shape2, GjkContact& contact) override;
+};
+
+/**
+ * @brief The namespace for the Gjk algorithm in the RRTPlanner framework.
+ */
+RRTPLANNER_FRAMEWORK_ALGORITHM_GJK_END_NAMESPACE
+
+#endif
@@ -16,12 +16,9 @@
 #include <RrtPlannerLib/RrtPlannerLibGlobal.h>
 #include <RrtPlannerLib/framework/algorithm/gjk/Gjk.h>
 #include <RrtPlannerLib/framework/algorithm/gjk/IShape.h>
-#include <QScopedPointer>
 
 RRTPLANNER_FRAMEWORK_ALGORITHM_GJK_BEGIN_NAMESPACE
 
-class GjkMinDistPrivate;
-
 /**
  * @brief The GjkMinDist class provides a GJK-based algorithm for checking if shapes intersect,
  *   and for finding the minimum distance between shapes if they do not intersect.
@@ -59,8 +56,15 @@ public:
      */
     bool chkIntersect(const IShape& shape1, const IShape& shape2, double& distance, bool& isValidDistance);
 
-private:
-    QScopedPointer<GjkMinDistPrivate> d_ptr;
+    /**
+     * @brief Check for intersection between two shapes and get their closest points if they do not intersect.
+     * @param shape1 The first shape.
+     * @param shape2 The second shape.
+     * @param contact Distance, contact normal and witness points if the shapes do not intersect (output
+     *                parameter). contact.isValid is false for intersecting shapes, use GjkType::Epa for their depth.
+     * @return True if the shapes intersect, false otherwise.
+     */
+    bool chkContact(const IShape& shape1, const IShape& shape2, GjkContact& contact) override;
 };
 
 /**
@@ -11,7 +11,7 @@
 #define RRTPLANNERLIB_FRAMEWORK_ALGORITHM_GJK_SIMPLEX_H
 
 #include <RrtPlannerLib/RrtPlannerLibGlobal.h>
-#include <RrtPlannerLib/framework/VectorF.h>
+#include <RrtPlannerLib/framework/Vec2.h>
 #include <QScopedPointer>
 
 
@@ -63,7 +63,7 @@ public:
      * @param[out] v The vector along the next search direction (un-normalized) used during the GJK algorithm.
      * @return True if the origin is in the simplex, false otherwise.
      */
-    [[nodiscard]] virtual bool update(const VectorF& vertex, VectorF& v) = 0;
+    [[nodiscard]] virtual bool update(const Vec2& vertex, Vec2& v) = 0;
 
 public:
     /**
@@ -10,7 +10,7 @@
 
 #include <RrtPlannerLib/RrtPlannerLibGlobal.h>
 #include <RrtPlannerLib/framework/algorithm/gjk/internal/Simplex.h>
-#include <RrtPlannerLib/framework/VectorF.h>
+#include <RrtPlannerLib/framework/Vec2.h>
 #include <QScopedPointer>
 
 RRTPLANNER_FRAMEWORK_ALGORITHM_GJK_BEGIN_NAMESPACE
@@ -61,7 +61,7 @@ public:
      * @param[out] v The vector along the next search direction (un-normalized).
      * @return True if the origin is in the simplex, false otherwise.
      */
-    [[nodiscard]] virtual bool update(const VectorF& vertex, VectorF& v) override;
+    [[nodiscard]] virtual bool update(const Vec2& vertex, Vec2& v) override;
 
 private:
     QScopedPointer<SimplexBasicPrivate> d_ptr;
@@ -0,0 +1,399 @@
+/**
+ * @file SimplexKernel.h
+ * @brief Stack allocated simplex classes used by the header-only GJK kernel in GjkKernel.h.
+ *
+ * SimplexBasicKernel and SimplexMinDistKernel follow the same case analysis as SimplexBasic and SimplexMinDist,
+ * vertex for vertex, but hold their (at most 3) vertices in a fixed array and have no virtual functions, so that
+ * the whole GJK iteration inlines into the caller.
+ *
+ * SimplexWitnessKernel also keeps the support points of both shapes behind each vertex and the barycentric
+ * coordinates of the point closest to the origin, from which the witness points on the shapes follow.
+ *
+ * @see GjkKernel.h, SimplexBasic.h, SimplexMinDist.h
+ * @authors Enric Xargay Mata, ycw
+ * @date 2024-03-18
+ */
+
+#ifndef RRTPLANNERLIB_FRAMEWORK_ALGORITHM_GJK_SIMPLEX_KERNEL_H
+#define RRTPLANNERLIB_FRAMEWORK_ALGORITHM_GJK_SIMPLEX_KERNEL_H
+
+#include <RrtPlannerLib/RrtPlannerLibGlobal.h>
+#include <RrtPlannerLib/framework/Vec2.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/GjkDefines.h>
+#include <QtGlobal>
+#include <algorithm>
+
+RRTPLANNER_FRAMEWORK_ALGORITHM_GJK_BEGIN_NAMESPACE
+
+/**
+ * @brief Stack allocated counterpart of SimplexBasic.
+ */
+class SimplexBasicKernel
+{
+public:
+    explicit SimplexBasicKernel(double eps_square = EPS_SQUARE)
+        :m_eps_square(eps_square)
+    {}
+
+    void reset() { m_n = 0; }
+    int size() const { return(m_n); }
+    const Vec2& at(int i) const { return(m_vertex[i]); }
+
+    /**
+     * @brief Adds a vertex and reduces the simplex to the feature closest to the origin.
+     * @param[in] vertex New support point.
+     * @param[out] v Next search direction.
+     * @return True if the origin is in the simplex.
+     */
+    bool update(const Vec2& vertex, Vec2& v)
+    {
+        m_vertex[m_n++] = vertex;
+        switch(m_n){
+        case 3:
+            return(handle2D(v));
+        case 2:
+            return(handle1D(v));
+        default:
+            v = -m_vertex[0];
+            return(false);
+        }
+    }
+
+private:
+    bool handle2D(Vec2& v)
+    {
+        bool originInSimplex{false};
+        v = Vec2{0.0, 0.0};
+
+        const Vec2 c = m_vertex[0];
+        const Vec2 b = m_vertex[1];
+        const Vec2 a = m_vertex[2];
+        Vec2 ab = b - a;
+        Vec2 ac = c - a;
+        Vec2 ao = -a;
+
+        double zVal = ab.cross_zVal(ac); //z-value of ab cross ac
+        Vec2 ac_perp = Vec2{-ac[1], ac[0]} * zVal;
+        Vec2 ab_perp = Vec2{ab[1], -ab[0]} * zVal;
+
+        //check origin on edge ac and ab
+        double ao_dot_ac_perp = ao.dot(ac_perp);
+        double ao_dot_ab_perp = ao.dot(ab_perp);
+        originInSimplex = ao_dot_ac_perp*ao_dot_ac_perp < m_eps_square * ac_perp.norm2_square() ||
+                ao_dot_ab_perp*ao_dot_ab_perp < m_eps_square * ab_perp.norm2_square();
+
+        //check for region RAC and RAB
+        if(!originInSimplex){
+            if(ac_perp.dot(ao) > 0){ //in region RAC
+                if(ac.dot(ao) > 0){
+                    m_vertex[0] = c;
+                    m_vertex[1] = a;
+                    m_n = 2;
+                }
+                else{
+                    m_vertex[0] = a;
+                    m_n = 1;
+                }
+                v = ac_perp;
+            }
+            else if(ab_perp.dot(ao) > 0){ //in region RAB
+                if(ab.dot(ao) > 0){
+                    m_vertex[0] = b;
+                    m_vertex[1] = a;
+                    m_n = 2;
+                }
+                else{
+                    m_vertex[0] = a;
+                    m_n = 1;
+                }
+                v = ab_perp;
+            }
+            else{ //neither in RAC nor RAB
+                originInSimplex = true;
+            }
+        }
+        return(originInSimplex);
+    }
+
+    bool handle1D(Vec2& v)
+    {
+        const Vec2& b = m_vertex[0];
+        const Vec2& a = m_vertex[1];
+        Vec2 ab = b - a;
+        Vec2 ao = -a;
+
+        double scalar = ao.cross_zVal(ab);
+        v = Vec2{ab[1], -ab[0]} * scalar;
+
+        //check origin on line AB
+        double ao_dot_v = ao.dot(v);
+        return(ao_dot_v*ao_dot_v < m_eps_square * v.norm2_square());
+    }
+
+    Vec2 m_vertex[3];
+    int m_n{};
+    double m_eps_square;
+};
+
+/**
+ * @brief Stack allocated counterpart of SimplexMinDist.
+ *
+ * The search direction v returned by update() points from the point of the simplex closest to the origin towards
+ * the origin, so |v| is the distance of the simplex to the origin.
+ */
+class SimplexMinDistKernel
+{
+public:
+    explicit SimplexMinDistKernel(double eps_square = EPS_SQUARE)
+        :m_eps_square(eps_square)
+    {}
+
+    void reset() { m_n = 0; }
+    int size() const { return(m_n); }
+    const Vec2& at(int i) const { return(m_vertex[i]); }
+
+    /**
+     * @brief Adds a vertex and reduces the simplex to the feature closest to the origin.
+     * @param[in] vertex New support point.
+     * @param[out] v Next search direction, from the simplex towards the origin.
+     * @return True if the origin is in the simplex.
+     */
+    bool update(const Vec2& vertex, Vec2& v)
+    {
+        m_vertex[m_n++] = vertex;
+        switch(m_n){
+        case 3:
+            return(handle2D(v));
+        case 2:
+            return(handle1D(v));
+        default:
+            v = -m_vertex[0];
+            return(false);
+        }
+    }
+
+private:
+    bool handle2D(Vec2& v)
+    {
+        bool originInSimplex{false};
+
+        const Vec2 oc = m_vertex[0];
+        const Vec2 ob = m_vertex[1];
+        const Vec2 oa = m_vertex[2];
+        Vec2 ab = ob - oa;
+        Vec2 ca = oa - oc;
+        Vec2 ao = -oa;
+
+        double z_val = ca.cross_zVal(ab); //z value of ca x ab (up-vector)
+        double sign_z = z_val < 0.0? -1.0 : 1.0;
+        Vec2 ab_perp = ab.cross_z() * z_val; //ab x (ca x ab)
+        Vec2 ca_perp = ca.cross_z() * z_val; //ca x (ca x ab)
+        double up_ca = oa.dot(ca);
+        double vp_ca = -oc.dot(ca);
+        double up_ab = ob.dot(ab);
+        double vp_ab = ao.dot(ab);
+        double wp_ab = oa.cross_zVal(ob) * sign_z;
+        double wp_ca = oc.cross_zVal(oa) * sign_z;
+        auto dot_square = [](const Vec2& a, const Vec2& b){
+            double val = a.dot(b);
+            return(val*val);
+        };
+
+        if(up_ca <= 0 && vp_ab <= 0){ //origin in RA
+            v = ao;
+            m_vertex[0] = oa;
+            m_n = 1;
+        }
+        else if(vp_ab > 0 && up_ab > 0 && dot_square(ao, ab_perp) < m_eps_square * ab_perp.norm2_square()){ //origin on segment AB
+            originInSimplex = true;
+        }
+        else if(wp_ab < 0 && vp_ab > 0){ //origin in RAB exclude line AB
+            v = ao - ab * (vp_ab/ab.norm2_square());
+            m_vertex[0] = ob;
+            m_vertex[1] = oa;
+            m_n = 2;
+        }
+        else if(up_ca > 0 && vp_ca > 0 && dot_square(oa, ca_perp) < m_eps_square * ca_perp.norm2_square()){ //origin on segment CA
+            originInSimplex = true;
+        }
+        else if(wp_ca < 0 && up_ca > 0){ //origin in RCA exclude line CA
+            v = ca * (up_ca/ca.norm2_square()) - oa;
+            m_vertex[0] = oc;
+            m_vertex[1] = oa;
+            m_n = 2;
+        }
+        else{
+            originInSimplex = true;
+        }
+        return(originInSimplex);
+    }
+
+    bool handle1D(Vec2& v)
+    {
+        const Vec2 b = m_vertex[0];
+        const Vec2 a = m_vertex[1];
+        Vec2 ab = b - a;
+        Vec2 ao = -a;
+
+        double ao_dot_ab = ao.dot(ab);
+        if(ao_dot_ab <= 0.0){ //origin in RA
+            m_vertex[0] = a;
+            m_n = 1;
+            v = ao;
+            return(false);
+        }
+        v = ao - ab * (ao_dot_ab/ab.norm2_square()); //origin in RAB
+        return(v.norm2_square() < m_eps_square);
+    }
+
+    Vec2 m_vertex[3];
+    int m_n{};
+    double m_eps_square;
+};
+
+/**
+ * @brief Simplex of the Minkowski difference shape2 - shape1 that keeps the support points of both shapes.
+ *
+ * Vertex i is support2(i) - support1(i). reduce() drops the vertices not needed for the point closest to the
+ * origin and keeps the barycentric coordinates of that point, so that witness() returns the corresponding points on
+ * shape1 and shape2.
+ */
+class SimplexWitnessKernel
+{
+public:
+    void reset() { m_n = 0; }
+    int size() const { return(m_n); }
+    const Vec2& at(int i) const { return(m_vertex[i]); }
+    const Vec2& support1(int i) const { return(m_support1[i]); }
+    const Vec2& support2(int i) const { return(m_support2[i]); }
+
+    /**
+     * @brief Adds the vertex support2 - support1.
+     */
+    void add(const Vec2& support1, const Vec2& support2)
+    {
+        Q_ASSERT(m_n < 3);
+        m_support1[m_n] = support1;
+        m_support2[m_n] = support2;
+        m_vertex[m_n] = support2 - support1;
+        m_lambda[m_n] = 0.0;
+        ++m_n;
+    }
+
+    /**
+     * @brief Reduces the simplex to the vertices spanning its point closest to the origin.
+     * @param[out] v The point of the simplex closest to the origin.
+     * @return True if the origin is strictly inside the simplex (a triangle). v is then the origin.
+     */
+    bool reduce(Vec2& v)
+    {
+        switch(m_n){
+        case 3:
+            return(reduce2D(v));
+        case 2:
+            reduceSegment(0, 1, v);
+            return(false);
+        default:
+            m_lambda[0] = 1.0;
+            v = m_vertex[0];
+            return(false);
+        }
+    }
+
+    /**
+     * @brief Points on shape1 and shape2 corresponding to the last point returned by reduce().
+     */
+    void witness(Vec2& pt1, Vec2& pt2) const
+    {
+        pt1 = Vec2();
+        pt2 = Vec2();
+        for(int i = 0; i < m_n; ++i){
+            pt1 += m_support1[i] * m_lambda[i];
+            pt2 += m_support2[i] * m_lambda[i];
+        }
+    }
+
+private:
+    bool reduce2D(Vec2& v)
+    {
+        const Vec2& a = m_vertex[0];
+        const Vec2& b = m_vertex[1];
+        const Vec2& c = m_vertex[2];
+        double area = (b - a).cross_zVal(c - a);
+        if(area != 0.0){
+            double lambdaA = b.cross_zVal(c) / area; //barycentric coordinates of the origin
+            double lambdaB = c.cross_zVal(a) / area;
+            double lambdaC = a.cross_zVal(b) / area;
+            if(lambdaA > 0.0 && lambdaB > 0.0 && lambdaC > 0.0){
+                m_lambda[0] = lambdaA;
+                m_lambda[1] = lambdaB;
+                m_lambda[2] = lambdaC;
+                v = Vec2(0.0, 0.0);
+                return(true);
+            }
+        }
+
+        //origin outside (or the triangle is flat): closest point is on one of the edges
+        const int edgeList[3][2] = {{0, 1}, {1, 2}, {2, 0}};
+        int iMin = 0;
+        double distSquareMin = distSquareSegment(0, 1);
+        for(int i = 1; i < 3; ++i){
+            double distSquare = distSquareSegment(edgeList[i][0], edgeList[i][1]);
+            if(distSquare < distSquareMin){
+                distSquareMin = distSquare;
+                iMin = i;
+            }
+        }
+        reduceSegment(edgeList[iMin][0], edgeList[iMin][1], v);
+        return(false);
+    }
+
+    double segmentParam(int i, int j) const
+    {
+        Vec2 e = m_vertex[j] - m_vertex[i];
+        double eSquare = e.norm2_square();
+        return(eSquare > 0.0? std::min(std::max(-m_vertex[i].dot(e) / eSquare, 0.0), 1.0) : 0.0);
+    }
+
+    double distSquareSegment(int i, int j) const
+    {
+        return((m_vertex[i] + (m_vertex[j] - m_vertex[i]) * segmentParam(i, j)).norm2_square());
+    }
+
+    void reduceSegment(int i, int j, Vec2& v)
+    {
+        double t = segmentParam(i, j);
+        const Vec2 vertex[2] = {m_vertex[i], m_vertex[j]};
+        const Vec2 support1[2] = {m_support1[i], m_support1[j]};
+        const Vec2 support2[2] = {m_support2[i], m_support2[j]};
+        if(t <= 0.0 || t >= 1.0){ //a vertex
+            int k = t <= 0.0? 0 : 1;
+            m_vertex[0] = vertex[k];
+            m_support1[0] = support1[k];
+            m_support2[0] = support2[k];
+            m_lambda[0] = 1.0;
+            m_n = 1;
+            v = m_vertex[0];
+            return;
+        }
+        for(int k = 0; k < 2; ++k){
+            m_vertex[k] = vertex[k];
+            m_support1[k] = support1[k];
+            m_support2[k] = support2[k];
+        }
+        m_lambda[0] = 1.0 - t;
+        m_lambda[1] = t;
+        m_n = 2;
+        v = vertex[0] + (vertex[1] - vertex[0]) * t;
+    }
+
+    Vec2 m_vertex[3];
+    Vec2 m_support1[3];
+    Vec2 m_support2[3];
+    double m_lambda[3]{};
+    int m_n{};
+};
+
+RRTPLANNER_FRAMEWORK_ALGORITHM_GJK_END_NAMESPACE
+
+#endif // RRTPLANNERLIB_FRAMEWORK_ALGORITHM_GJK_SIMPLEX_KERNEL_H
@@ -11,7 +11,7 @@
 #define RRTPLANNERLIB_FRAMEWORK_ALGORITHM_GJK_SUPPORT_H
 
 #include <RrtPlannerLib/RrtPlannerLibGlobal.h>
-#include <RrtPlannerLib/framework/VectorF.h>
+#include <RrtPlannerLib/framework/Vec2.h>
 #include <QScopedPointer>
 #include <QObject> //for Q_GADGET
 
@@ -85,8 +85,8 @@ public:
      * @return The result flag indicating the relationship of the support point with respect to the simplex and origin.
      */
     virtual Support::ResultFlag support(const IShape* shape1, const IShape* shape2,
-                                         const VectorF& v, bool isDirFromSupport2Origin,
-                                         VectorF& spp) = 0;
+                                         const Vec2& v, bool isDirFromSupport2Origin,
+                                         Vec2& spp) = 0;
 
 public:
     /**
@@ -0,0 +1,39 @@
+/**
+ * @file SupportLanes.h
+ * @brief Support step of GjkBatch, the only code of the library compiled with AVX2 when RRTPLANNER_GJK_AVX2 is on.
+ *
+ * SupportLanes.cpp is built with its own instruction set flags, so it must not share any inline function with the
+ * rest of the library: the linker keeps one copy of each inline function, and an AVX2 copy could then be called on
+ * a CPU without AVX2. This header and SupportLanes.cpp therefore include the intrinsics and the GJK defines only,
+ * not RrtPlannerLibGlobal.h (Qt) nor Vec2.h, and the namespace is spelled out instead of using the namespace macros.
+ *
+ * @see GjkBatch.h
+ * @authors Enric Xargay Mata, ycw
+ * @date 2024-03-18
+ */
+
+#ifndef RRTPLANNERLIB_FRAMEWORK_ALGORITHM_GJK_SUPPORT_LANES_H
+#define RRTPLANNERLIB_FRAMEWORK_ALGORITHM_GJK_SUPPORT_LANES_H
+
+#include <RrtPlannerLib/framework/algorithm/gjk/GjkDefines.h>
+
+namespace rrtplanner::framework::algorithm::gjk{
+
+/**
+ * @brief Support point of each of the GJK_BATCH_LANES lanes in its direction (dx[l], dy[l]), with the same operations
+ * and tie breaking (first vertex wins) as Polygon::support().
+ * @param x, y Vertices, structure-of-arrays: vertex j of lane l at [j*GJK_BATCH_LANES + l].
+ * @param n Number of vertices of each lane.
+ * @param dx, dy Direction of each lane.
+ * @param sx, sy Returns the support point of each lane.
+ */
+void supportLanes(const double* x, const double* y, int n, const double* dx, const double* dy, double* sx, double* sy);
+
+/**
+ * @brief True if supportLanes() was compiled with AVX2 intrinsics.
+ */
+bool isSupportLanesAvx2();
+
+};
+
+#endif
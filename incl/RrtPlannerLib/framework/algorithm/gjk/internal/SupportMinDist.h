@@ -9,7 +9,7 @@
 
 #include <RrtPlannerLib/RrtPlannerLibGlobal.h>
 #include <RrtPlannerLib/framework/algorithm/gjk/internal/Support.h>
-#include <RrtPlannerLib/framework/VectorF.h>
+#include <RrtPlannerLib/framework/Vec2.h>
 
 
 RRTPLANNER_FRAMEWORK_ALGORITHM_GJK_BEGIN_NAMESPACE
@@ -65,8 +65,8 @@ public:
      * @return The result flag indicating the relationship of the support point with respect to the simplex and origin.
      */
     virtual Support::ResultFlag support(const IShape* shape1, const IShape* shape2,
-                                         const VectorF& v, bool isDirFromSupport2Origin,
-                                         VectorF& spp) override;
+                                         const Vec2& v, bool isDirFromSupport2Origin,
+                                         Vec2& spp) override;
 };
 
 /**
@@ -0,0 +1,395 @@
+/**
+ * @file KdTree.h
+ * @brief Header-only incremental kd-tree for the nearest neighbour queries of tree planners.
+ *
+ * Every RRT iteration looks up the nearest node of a sample and the nodes within the rewiring radius of the new
+ * node. Over all the nodes, both are O(n) and the tree stalls after a few thousand nodes. KdTree keeps the nodes in a
+ * kd-tree that stays balanced while it grows: it is a scapegoat tree, a subtree is rebuilt around its median once one
+ * of its children holds more than RRT_KD_ALPHA of its points. Insertion is then amortised O(log n), and so are the
+ * nearest and k-nearest queries on well spread points.
+ *
+ * The keys are points of Dim coordinates, e.g.:
+ * - {dx, ell}, the curvilinear coordinates of EllMap::getRootData() (crosstrack, arclength along the offset plan);
+ * - {dx, ell, N, E} to also split on the position;
+ * - {dx, ell, t}, with a weight on t that converts time to metres, e.g. a nominal speed.
+ *
+ * The metric is a template parameter, any type with
+ *   double distance(const Point& a, const Point& b) const;
+ *   double axisDistance(int axis, double diff) const;
+ * where axisDistance() is non-decreasing in |diff| and a lower bound of distance() between points whose coordinates
+ * along axis differ by diff. It prunes the subtrees beyond the split planes. WeightedEuclidean is the default.
+ *
+ * Queries are const and allocate nothing beyond their output lists, so threads may query a tree concurrently as long
+ * as nobody inserts. Many identical keys cannot be split and degrade the tree towards a list, which tree planners
+ * avoid anyway by rejecting samples on top of existing nodes.
+ *
+ * @see RrtStar.h, EllMap.h
+ * @authors Enric Xargay Mata, ycw
+ * @date 2024-03-18
+ */
+
+#ifndef RRTPLANNERLIB_FRAMEWORK_ALGORITHM_RRT_KDTREE_H
+#define RRTPLANNERLIB_FRAMEWORK_ALGORITHM_RRT_KDTREE_H
+
+#include <RrtPlannerLib/RrtPlannerLibGlobal.h>
+#include <RrtPlannerLib/framework/algorithm/rrt/RrtDefines.h>
+#include <QVector>
+#include <QtGlobal>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+RRTPLANNER_FRAMEWORK_ALGORITHM_RRT_BEGIN_NAMESPACE
+
+/**
+ * @brief Euclidean distance with a weight per axis, sqrt(sum (w_i (a_i - b_i))^2). Unit weights by default.
+ */
+template<int Dim>
+class WeightedEuclidean
+{
+public:
+    using Point = std::array<double, Dim>;
+
+    WeightedEuclidean()
+    {
+        m_weight.fill(1.0);
+    }
+
+    explicit WeightedEuclidean(const Point& weight)
+        :m_weight(weight)
+    {}
+
+    const Point& weight() const { return(m_weight); }
+
+    double distance(const Point& a, const Point& b) const
+    {
+        double sum{};
+        for(int i = 0; i < Dim; ++i){
+            double diff = m_weight[i] * (a[i] - b[i]);
+            sum += diff * diff;
+        }
+        return(std::sqrt(sum));
+    }
+
+    double axisDistance(int axis, double diff) const { return(m_weight[axis] * std::abs(diff)); }
+
+private:
+    Point m_weight;
+};
+
+/**
+ * @class KdTree
+ * @brief Incremental kd-tree over points of Dim coordinates, balanced by partial rebuilds.
+ *
+ * The points are numbered in insertion order, which is how tree planners number their nodes.
+ */
+template<int Dim, class Metric = WeightedEuclidean<Dim>>
+class KdTree
+{
+    static_assert(Dim > 0, "KdTree needs at least one dimension");
+
+public:
+    using Point = std::array<double, Dim>;
+
+    explicit KdTree(const Metric& metric = Metric())
+        :m_metric(metric)
+    {}
+
+    /**
+     * @brief Reserves room for n points, so that inserting up to n points does not reallocate.
+     */
+    void reserve(int n)
+    {
+        m_point.reserve(n);
+        m_left.reserve(n);
+        m_right.reserve(n);
+        m_size.reserve(n);
+        m_axis.reserve(n);
+        m_path.reserve(n);
+        m_rebuild.reserve(n);
+    }
+
+    /**
+     * @brief Removes all the points, keeping the capacity.
+     */
+    void clear()
+    {
+        m_point.clear();
+        m_left.clear();
+        m_right.clear();
+        m_size.clear();
+        m_axis.clear();
+        m_root = -1;
+    }
+
+    int size() const { return(m_point.size()); }
+    bool isEmpty() const { return(m_point.isEmpty()); }
+    const Point& point(int idx) const { return(m_point.at(idx)); }
+    const Metric& metric() const { return(m_metric); }
+
+    /**
+     * @brief Sets the metric. The splits do not depend on it, so it may change while the tree holds points.
+     */
+    void setMetric(const Metric& metric) { m_metric = metric; }
+
+    /**
+     * @brief Number of levels below the root, 0 for a single point, -1 if empty.
+     */
+    int depth() const { return(depthFrom(m_root)); }
+
+    /**
+     * @brief Inserts a point.
+     * @return Its index, size() - 1.
+     */
+    int insert(const Point& pt)
+    {
+        int idx = m_point.size();
+        m_point.append(pt);
+        m_left.append(-1);
+        m_right.append(-1);
+        m_size.append(1);
+        m_axis.append(0);
+        if(m_root < 0){
+            m_root = idx;
+            return(idx);
+        }
+
+        //descend to a leaf, left strictly below the split, counting the new point on the way
+        m_path.clear();
+        int node = m_root;
+        while(node >= 0){
+            m_path.append(node);
+            ++m_size[node];
+            int axis = m_axis.at(node);
+            int& child = pt[axis] < m_point.at(node)[axis]? m_left[node] : m_right[node];
+            if(child < 0){
+                child = idx;
+                m_axis[idx] = (axis + 1) % Dim;
+                break;
+            }
+            node = child;
+        }
+
+        //too deep: rebuild below the lowest ancestor whose child on the path outweighs RRT_KD_ALPHA of it
+        int depthNew = m_path.size();
+        if(depthNew > std::floor(std::log(static_cast<double>(size())) / -std::log(RRT_KD_ALPHA))){
+            int child = idx;
+            for(int k = m_path.size() - 1; k >= 0; --k){
+                int ancestor = m_path.at(k);
+                if(m_size.at(child) > RRT_KD_ALPHA * m_size.at(ancestor)){
+                    int parent = k > 0? m_path.at(k - 1) : -1;
+                    int rebuilt = rebuild(ancestor);
+                    if(parent < 0){
+                        m_root = rebuilt;
+                    }
+                    else{
+                        (m_left.at(parent) == ancestor? m_left[parent] : m_right[parent]) = rebuilt;
+                    }
+                    break;
+                }
+                child = ancestor;
+            }
+        }
+        return(idx);
+    }
+
+    /**
+     * @brief Nearest point of query.
+     * @param[out] p_dist If not null, its distance.
+     * @return Its index, -1 if the tree is empty.
+     */
+    int nearest(const Point& query, double* p_dist = nullptr) const
+    {
+        int best = -1;
+        double bestDist = std::numeric_limits<double>::max();
+        nearestFrom(m_root, query, best, bestDist);
+        if(p_dist){
+            *p_dist = bestDist;
+        }
+        return(best);
+    }
+
+    /**
+     * @brief k nearest points of query.
+     * @param[out] idxList min(k, size()) indices, nearest first.
+     * @param[out] p_distList If not null, their distances.
+     */
+    void kNearest(const Point& query, int k, QVector<int>& idxList, QVector<double>* p_distList = nullptr) const
+    {
+        idxList.clear();
+        QVector<double> distListTmp;
+        QVector<double>& distList = p_distList? *p_distList : distListTmp;
+        distList.clear();
+        if(k > 0){
+            kNearestFrom(m_root, query, k, idxList, distList);
+        }
+    }
+
+    /**
+     * @brief Points within radius of query, boundary included.
+     * @param[out] idxList Their indices, in no particular order, the same for the same tree and query.
+     * @param[out] p_distList If not null, their distances.
+     */
+    void radius(const Point& query, double radius, QVector<int>& idxList, QVector<double>* p_distList = nullptr) const
+    {
+        idxList.clear();
+        if(p_distList){
+            p_distList->clear();
+        }
+        radiusFrom(m_root, query, radius, idxList, p_distList);
+    }
+
+private:
+    int depthFrom(int node) const
+    {
+        if(node < 0){
+            return(-1);
+        }
+        return(1 + std::max(depthFrom(m_left.at(node)), depthFrom(m_right.at(node))));
+    }
+
+    //rebuilds the subtree of node around medians, returns its new root
+    int rebuild(int node)
+    {
+        m_rebuild.clear();
+        m_path.clear();
+        m_path.append(node);
+        while(!m_path.isEmpty()){
+            int idx = m_path.takeLast();
+            m_rebuild.append(idx);
+            if(m_left.at(idx) >= 0){
+                m_path.append(m_left.at(idx));
+            }
+            if(m_right.at(idx) >= 0){
+                m_path.append(m_right.at(idx));
+            }
+        }
+        return(build(0, m_rebuild.size()));
+    }
+
+    //balanced subtree of m_rebuild[begin, end), split on the axis of widest spread
+    int build(int begin, int end)
+    {
+        if(begin >= end){
+            return(-1);
+        }
+        Point lo = m_point.at(m_rebuild.at(begin));
+        Point hi = lo;
+        for(int k = begin + 1; k < end; ++k){
+            const Point& pt = m_point.at(m_rebuild.at(k));
+            for(int i = 0; i < Dim; ++i){
+                lo[i] = std::min(lo[i], pt[i]);
+                hi[i] = std::max(hi[i], pt[i]);
+            }
+        }
+        int axis = 0;
+        for(int i = 1; i < Dim; ++i){
+            if(hi[i] - lo[i] > hi[axis] - lo[axis]){
+                axis = i;
+            }
+        }
+
+        //as in insert(), the left side holds the keys strictly below the split, so the split point is the first
+        //of the keys equal to the median
+        int mid = begin + (end - begin) / 2;
+        auto first = m_rebuild.begin() + begin;
+        auto less = [this, axis](int a, int b){ return(m_point.at(a)[axis] < m_point.at(b)[axis]); };
+        std::nth_element(first, m_rebuild.begin() + mid, m_rebuild.begin() + end, less);
+        double split = m_point.at(m_rebuild.at(mid))[axis];
+        mid = static_cast<int>(std::partition(first, m_rebuild.begin() + mid,
+                                              [this, axis, split](int a){ return(m_point.at(a)[axis] < split); })
+                               - m_rebuild.begin());
+        std::nth_element(m_rebuild.begin() + mid, m_rebuild.begin() + mid, m_rebuild.begin() + end, less);
+
+        int node = m_rebuild.at(mid);
+        m_axis[node] = axis;
+        m_size[node] = end - begin;
+        m_left[node] = build(begin, mid);
+        m_right[node] = build(mid + 1, end);
+        return(node);
+    }
+
+    void nearestFrom(int node, const Point& query, int& best, double& bestDist) const
+    {
+        if(node < 0){
+            return;
+        }
+        double dist = m_metric.distance(query, m_point.at(node));
+        if(dist < bestDist){
+            bestDist = dist;
+            best = node;
+        }
+        int axis = m_axis.at(node);
+        double diff = query[axis] - m_point.at(node)[axis];
+        int nearSide = diff < 0.0? m_left.at(node) : m_right.at(node);
+        int farSide = diff < 0.0? m_right.at(node) : m_left.at(node);
+        nearestFrom(nearSide, query, best, bestDist);
+        if(m_metric.axisDistance(axis, diff) < bestDist){
+            nearestFrom(farSide, query, best, bestDist);
+        }
+    }
+
+    void kNearestFrom(int node, const Point& query, int k, QVector<int>& idxList, QVector<double>& distList) const
+    {
+        if(node < 0){
+            return;
+        }
+        //idxList is kept sorted by distance, k is small
+        double dist = m_metric.distance(query, m_point.at(node));
+        if(idxList.size() < k || dist < distList.last()){
+            if(idxList.size() == k){
+                idxList.removeLast();
+                distList.removeLast();
+            }
+            int pos = static_cast<int>(std::upper_bound(distList.begin(), distList.end(), dist) - distList.begin());
+            idxList.insert(pos, node);
+            distList.insert(pos, dist);
+        }
+        int axis = m_axis.at(node);
+        double diff = query[axis] - m_point.at(node)[axis];
+        int nearSide = diff < 0.0? m_left.at(node) : m_right.at(node);
+        int farSide = diff < 0.0? m_right.at(node) : m_left.at(node);
+        kNearestFrom(nearSide, query, k, idxList, distList);
+        if(idxList.size() < k || m_metric.axisDistance(axis, diff) < distList.last()){
+            kNearestFrom(farSide, query, k, idxList, distList);
+        }
+    }
+
+    void radiusFrom(int node, const Point& query, double radius, QVector<int>& idxList, QVector<double>* p_distList) const
+    {
+        if(node < 0){
+            return;
+        }
+        double dist = m_metric.distance(query, m_point.at(node));
+        if(dist <= radius){
+            idxList.append(node);
+            if(p_distList){
+                p_distList->append(dist);
+            }
+        }
+        int axis = m_axis.at(node);
+        double diff = query[axis] - m_point.at(node)[axis];
+        int nearSide = diff < 0.0? m_left.at(node) : m_right.at(node);
+        int farSide = diff < 0.0? m_right.at(node) : m_left.at(node);
+        radiusFrom(nearSide, query, radius, idxList, p_distList);
+        if(m_metric.axisDistance(axis, diff) <= radius){
+            radiusFrom(farSide, query, radius, idxList, p_distList);
+        }
+    }
+
+private:
+    Metric m_metric;
+    int m_root{-1};
+    QVector<Point> m_point;
+    QVector<int> m_left;
+    QVector<int> m_right;
+    QVector<int> m_size;            //points in the subtree
+    QVector<int> m_axis;            //split axis
+    QVector<int> m_path;            //scratch of insert() and rebuild()
+    QVector<int> m_rebuild;         //scratch of rebuild()
+};
+
+RRTPLANNER_FRAMEWORK_ALGORITHM_RRT_END_NAMESPACE
+
+#endif
@@ -0,0 +1,169 @@
+/**
+ * @file ParallelRrt.h
+ * @brief Definition of the ParallelRrt class, a root-parallel RRT* planner over the sampling volume of an SMap.
+ *
+ * ParallelRrt grows one RrtStar tree per thread from the vessel position, each with its own random generator, and
+ * keeps the cheapest path found by any of them. The trees share the SMap, the EllMap and the ObstacleSet read-only
+ * (their queries are reentrant, see EllMap.h and ObstacleSet.h) and nothing else, so the threads never wait for
+ * each other and the throughput scales with the number of cores.
+ *
+ * The seed of tree i is derived from setSeed() and i, so a solve() is reproducible for the same problem, budget,
+ * seed and thread count, unless stopped by the time budget. With one thread, ParallelRrt runs the same as an RrtStar
+ * seeded with treeSeed(seed, 0).
+ *
+ * @see RrtStar.h
+ * @authors Enric Xargay Mata, ycw
+ * @date 2024-03-18
+ */
+
+#ifndef RRTPLANNERLIB_FRAMEWORK_ALGORITHM_RRT_PARALLELRRT_H
+#define RRTPLANNERLIB_FRAMEWORK_ALGORITHM_RRT_PARALLELRRT_H
+
+#include <RrtPlannerLib/RrtPlannerLibGlobal.h>
+#include <RrtPlannerLib/framework/Vec2.h>
+#include <RrtPlannerLib/framework/Plan.h>
+#include <RrtPlannerLib/framework/SMap.h>
+#include <RrtPlannerLib/framework/vessel.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/ObstacleSet.h>
+#include <RrtPlannerLib/framework/algorithm/rrt/RrtStar.h>
+#include <QSharedDataPointer>
+#include <QString>
+
+
+RRTPLANNER_FRAMEWORK_ALGORITHM_RRT_BEGIN_NAMESPACE
+
+class ParallelRrtPrivate;
+
+/**
+ * @brief The ParallelRrt class runs RrtStar trees on several threads and merges their results.
+ * @details The problem and tuning setters are those of RrtStar and apply to every tree. The iteration budget is per
+ * tree, so n threads run n times as many iterations in about the same time. The result is the cheapest solved tree,
+ * the one of lowest index among equal costs.
+ *
+ * Copies share the problem and the trees until one of them is modified.
+ */
+class RRTPLANNER_LIB_EXPORT ParallelRrt
+{
+public:
+    /**
+     * @brief Default constructor. No SMap is set, one tree per ideal thread.
+     */
+    ParallelRrt();
+
+    /**
+     * @brief Copy constructor.
+     * @param other The ParallelRrt object to copy from.
+     */
+    ParallelRrt(const ParallelRrt& other);
+
+    /**
+     * @brief Assignment operator.
+     * @param other The ParallelRrt object to assign from.
+     * @return A reference to this ParallelRrt object after the assignment.
+     */
+    ParallelRrt& operator=(const ParallelRrt& other);
+
+    /**
+     * @brief Destructor.
+     */
+    ~ParallelRrt();
+
+    //---Problem, budget and tuning, see RrtStar----------------
+    void setSMap(const SMap& sMap);
+    void setVessel(const Vessel& vessel);
+    void setObstacleSet(const gjk::ObstacleSet& obstacleSet);
+    void setGoal(const Vec2& posNE, double radius);
+    void clearGoal();
+    void setMaxIteration(int maxIteration);
+    int maxIteration() const;
+    void setTimeBudget_ms(qint64 timeBudget_ms);
+    qint64 timeBudget_ms() const;
+    void setStepMax(double stepMax);
+    double stepMax() const;
+    void setGoalBias(double goalBias);
+    double goalBias() const;
+    void setClearance(double clearance);
+    double clearance() const;
+    void setSeed(quint32 seed);
+    quint32 seed() const;
+    void setInformed(bool informed);
+    bool isInformed() const;
+
+    /**
+     * @brief Sets the number of threads, one tree each. 0 (default) => QThread::idealThreadCount().
+     */
+    void setThreadCount(int nThread);
+    int threadCount() const;
+
+    /**
+     * @brief Seed of tree idx for the given seed of the planner.
+     */
+    static quint32 treeSeed(quint32 seed, int idx);
+
+    //---Run----------------
+    /**
+     * @brief Grows the trees concurrently, the calling thread growing the last one.
+     * @param resultsDesc Optional pointer to return the description of the result.
+     * @return True if any tree reaches the goal.
+     */
+    bool solve(QString* resultsDesc = nullptr);
+
+    /**
+     * @brief True if the last solve() reached the goal.
+     */
+    bool isSolved() const;
+
+    /**
+     * @brief [m] Length of the best path to the goal, or -1.0 if not solved.
+     */
+    double cost() const;
+
+    /**
+     * @brief Gets the best path to the goal, see RrtStar::path().
+     */
+    bool path(Plan& plan, QString* resultsDesc = nullptr) const;
+
+    //---Trees and throughput----------------
+    /**
+     * @brief Number of trees of the last solve().
+     */
+    int nTree() const;
+
+    /**
+     * @brief Tree idx of the last solve().
+     */
+    const RrtStar& tree(int idx) const;
+
+    /**
+     * @brief Index of the tree holding the best path, -1 if not solved.
+     */
+    int bestTree() const;
+
+    /**
+     * @brief Number of nodes of all trees.
+     */
+    int nNode() const;
+
+    /**
+     * @brief Number of iterations of all trees.
+     */
+    int nIteration() const;
+
+    /**
+     * @brief [ms] Wall time of the last solve().
+     */
+    double elapsed_ms() const;
+
+    /**
+     * @brief [1/s] Nodes added per second of wall time by the last solve(), over all trees.
+     */
+    double nodeRate() const;
+
+private:
+    QSharedDataPointer<ParallelRrtPrivate> d_ptr;
+};
+
+
+RRTPLANNER_FRAMEWORK_ALGORITHM_RRT_END_NAMESPACE
+
+#endif
@@ -0,0 +1,11 @@
+#ifndef RRTPLANNERLIB_FRAMEWORK_ALGORITHM_RRT_RRTDEFINES_H
+#define RRTPLANNERLIB_FRAMEWORK_ALGORITHM_RRT_RRTDEFINES_H
+
+#define RRT_MAX_ITERATION 2000 //Default iteration budget of a tree planner, also the size of its node pool.
+#define RRT_GOAL_BIAS 0.05 //Default probability of steering towards the goal instead of a sample.
+#define RRT_STEP_FRACTION 0.1 //Default max edge length, as a fraction of the SMap arclength horizon.
+#define RRT_SAMPLE_ATTEMPT_MAX 64 //Rejection sampling attempts per informed sample, see RrtStar::setInformed().
+#define RRT_TURN_STEP_DEG 10.0 //[deg] Heading step between the footprint copies checked while the vessel turns at the root.
+#define RRT_KD_ALPHA 0.7 //KdTree balance: a subtree is rebuilt once a child holds more than this fraction of its points.
+
+#endif
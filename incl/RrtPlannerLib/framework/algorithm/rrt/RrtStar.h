@@ -0,0 +1,229 @@
+/**
+ * @file RrtStar.h
+ * @brief Definition of the RrtStar class, an RRT* planner over the sampling volume of an SMap.
+ *
+ * The SMap describes where a replan may go: the sectors of an EllMap, up to an arclength horizon ahead of the
+ * vessel, weighted by the time span in which the vessel can reach each point between the min and max speeds. The
+ * SMap volume is that weight integrated over the corridor, and vol_cum is its cumulative distribution over the
+ * crosstrack. RrtStar draws the tree samples from this distribution, grows the tree from the vessel position with
+ * edges checked against an ObstacleSet, rewires it (RRT*) and returns the cheapest path to the goal as a Plan.
+ *
+ * The nodes are kept in a pool sized once per solve() from setMaxIteration(), so the tree never reallocates while it
+ * grows, and solve() stops at the iteration or the time budget, whichever comes first.
+ *
+ * @see SMap.h, EllMap.h, ObstacleSet.h
+ * @authors Enric Xargay Mata, ycw
+ * @date 2024-03-18
+ */
+
+#ifndef RRTPLANNERLIB_FRAMEWORK_ALGORITHM_RRT_RRTSTAR_H
+#define RRTPLANNERLIB_FRAMEWORK_ALGORITHM_RRT_RRTSTAR_H
+
+#include <RrtPlannerLib/RrtPlannerLibGlobal.h>
+#include <RrtPlannerLib/framework/Vec2.h>
+#include <RrtPlannerLib/framework/Plan.h>
+#include <RrtPlannerLib/framework/SMap.h>
+#include <RrtPlannerLib/framework/vessel.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/ObstacleSet.h>
+#include <RrtPlannerLib/framework/algorithm/rrt/RrtDefines.h>
+#include <QSharedDataPointer>
+#include <QString>
+
+
+RRTPLANNER_FRAMEWORK_ALGORITHM_RRT_BEGIN_NAMESPACE
+
+class RrtStarPrivate;
+
+/**
+ * @brief The RrtStar class plans a path from the vessel position through the SMap corridor, avoiding obstacles.
+ * @details
+ * - Sampling: with probability goalBias() the sample is the goal. Otherwise (crosstrack, arclength, time) is drawn
+ *   from the SMap volume by an SMapSampler, without rejection, and the sample is the position of (crosstrack,
+ *   arclength), see SMapSampler::posNE().
+ * - Growth: the nearest node is steered towards the sample by at most stepMax(). The new node must be inside the
+ *   EllMap, and the edge must clear the obstacles by clearance(): the footprint of the vessel, aligned with the
+ *   edge, is swept along it. On the edges from the root, the footprint must also clear them while it turns in
+ *   place from the vessel heading to the edge. The turns at the other nodes are not checked, the footprint only
+ *   takes the heading of each edge along it.
+ * - Rewiring: the new node takes the cheapest valid parent among the nodes within the RRT* radius, then becomes the
+ *   parent of those it makes cheaper. The cost is the path length.
+ * - The nearest and the near nodes are looked up in a KdTree of the node positions.
+ * - Informed sampling (Informed RRT*, optional): once a path to the goal is known, only the points within the ellipse
+ *   of foci the vessel and the goal, whose paths through them may be cheaper, can improve it. The samples are then
+ *   drawn uniformly from that ellipse, and kept if inside the EllMap, i.e., between its limit plans. While the ellipse
+ *   is larger than the SMap corridor, or mostly outside the EllMap, the samples are still drawn from the SMap.
+ *
+ * Copies share the problem and the tree until one of them is modified.
+ */
+class RRTPLANNER_LIB_EXPORT RrtStar
+{
+public:
+    /**
+     * @brief Default constructor. No SMap is set, the budget is RRT_MAX_ITERATION iterations.
+     */
+    RrtStar();
+
+    /**
+     * @brief Copy constructor.
+     * @param other The RrtStar object to copy from.
+     */
+    RrtStar(const RrtStar& other);
+
+    /**
+     * @brief Assignment operator.
+     * @param other The RrtStar object to assign from.
+     * @return A reference to this RrtStar object after the assignment.
+     */
+    RrtStar& operator=(const RrtStar& other);
+
+    /**
+     * @brief Destructor.
+     */
+    ~RrtStar();
+
+    //---Problem----------------
+    /**
+     * @brief Sets the SMap to sample from. It must have been reset() at the vessel position.
+     */
+    void setSMap(const SMap& sMap);
+
+    /**
+     * @brief Sets the vessel: the root of the tree is at its position and heading, and the footprint is its
+     * VesRectangle, if any, else the vessel is a point.
+     */
+    void setVessel(const Vessel& vessel);
+
+    /**
+     * @brief Sets the obstacles. Empty by default.
+     */
+    void setObstacleSet(const gjk::ObstacleSet& obstacleSet);
+
+    /**
+     * @brief Sets the goal region, a disc.
+     * @param posNE [m] Centre [Northing, Easting].
+     * @param radius [m] Radius, positive.
+     */
+    void setGoal(const Vec2& posNE, double radius);
+
+    /**
+     * @brief Unsets the goal region. solve() then aims at the nominal plan, at the arclength horizon of the SMap
+     * ahead of the vessel, within stepMax()/2.
+     */
+    void clearGoal();
+
+    //---Budget and tuning----------------
+    /**
+     * @brief Sets the iteration budget of solve(), which sizes the node pool. RRT_MAX_ITERATION by default.
+     */
+    void setMaxIteration(int maxIteration);
+    int maxIteration() const;
+
+    /**
+     * @brief Sets the time budget of solve() [ms], 0 for none (default).
+     */
+    void setTimeBudget_ms(qint64 timeBudget_ms);
+    qint64 timeBudget_ms() const;
+
+    /**
+     * @brief Sets the max edge length [m]. 0 (default) => RRT_STEP_FRACTION of the SMap arclength horizon.
+     */
+    void setStepMax(double stepMax);
+    double stepMax() const;
+
+    /**
+     * @brief Sets the probability of sampling the goal. RRT_GOAL_BIAS by default.
+     */
+    void setGoalBias(double goalBias);
+    double goalBias() const;
+
+    /**
+     * @brief Sets the clearance between the footprint and the obstacles [m]. 0 by default.
+     */
+    void setClearance(double clearance);
+    double clearance() const;
+
+    /**
+     * @brief Sets the seed of the sampler. solve() runs the same for the same problem, budget and seed, unless
+     * stopped by the time budget.
+     */
+    void setSeed(quint32 seed);
+    quint32 seed() const;
+
+    /**
+     * @brief Sets the informed sampling mode, off by default. The samples are the same as without it until a path
+     * is found.
+     */
+    void setInformed(bool informed);
+    bool isInformed() const;
+
+    //---Run----------------
+    /**
+     * @brief Grows a new tree from the vessel position until the iteration or time budget is spent.
+     * @param resultsDesc Optional pointer to return the description of the result.
+     * @return True if the goal is reached.
+     */
+    bool solve(QString* resultsDesc = nullptr);
+
+    /**
+     * @brief True if the last solve() reached the goal.
+     */
+    bool isSolved() const;
+
+    /**
+     * @brief [m] Length of the best path to the goal, or -1.0 if not solved.
+     */
+    double cost() const;
+
+    /**
+     * @brief Gets the best path to the goal.
+     * @param[out] plan Waypoints from the vessel position to the goal node, with the longitude of the vessel.
+     * @param resultsDesc Optional pointer to return the description of the result.
+     * @return False if not solved, plan is then unchanged.
+     */
+    bool path(Plan& plan, QString* resultsDesc = nullptr) const;
+
+    //---Tree----------------
+    /**
+     * @brief Number of nodes of the tree, the root is node 0.
+     */
+    int nNode() const;
+
+    /**
+     * @brief Number of iterations run by the last solve().
+     */
+    int nIteration() const;
+
+    /**
+     * @brief Number of samples of the last solve() drawn from the informed ellipse.
+     */
+    int nInformedSample() const;
+
+    /**
+     * @brief Number of samples of the last solve() drawn from the SMap although a path was known: the informed
+     * ellipse was not smaller than the SMap corridor, or RRT_SAMPLE_ATTEMPT_MAX draws in it were out of the EllMap.
+     */
+    int nInformedFallback() const;
+
+    /**
+     * @brief [m] Position [Northing, Easting] of a node.
+     */
+    Vec2 nodePosNE(int idx) const;
+
+    /**
+     * @brief Parent of a node, -1 for the root.
+     */
+    int nodeParent(int idx) const;
+
+    /**
+     * @brief [m] Length of the path from the root to a node.
+     */
+    double nodeCost(int idx) const;
+
+private:
+    QSharedDataPointer<RrtStarPrivate> d_ptr;
+};
+
+
+RRTPLANNER_FRAMEWORK_ALGORITHM_RRT_END_NAMESPACE
+
+#endif
@@ -0,0 +1,43 @@
+/**
+ * @file InformedSampling.h
+ * @brief Sampling step of the informed mode of RrtStar (Informed RRT*).
+ *
+ * A path cheaper than the best one ends in the goal disc, so its points are within the ellipse of foci the root and
+ * the goal centre, of transverse diameter the best cost plus the goal radius. sampleInformed() draws uniformly from
+ * that ellipse and keeps the draws within the EllMap. It holds no state, the random generator is the caller's.
+ *
+ * @see RrtStar.h
+ * @authors Enric Xargay Mata, ycw
+ * @date 2024-03-18
+ */
+
+#ifndef RRTPLANNERLIB_FRAMEWORK_ALGORITHM_RRT_INFORMED_SAMPLING_H
+#define RRTPLANNERLIB_FRAMEWORK_ALGORITHM_RRT_INFORMED_SAMPLING_H
+
+#include <RrtPlannerLib/RrtPlannerLibGlobal.h>
+#include <RrtPlannerLib/framework/Vec2.h>
+#include <RrtPlannerLib/framework/EllMap.h>
+#include <random>
+
+RRTPLANNER_FRAMEWORK_ALGORITHM_RRT_BEGIN_NAMESPACE
+
+/**
+ * @brief Draws a position of the EllMap uniformly within the informed ellipse of a path of cost costBest.
+ * @param rootNE, goalNE [m] Foci, the root of the tree and the centre of the goal disc [Northing, Easting].
+ * @param goalRadius [m] Radius of the goal disc.
+ * @param costBest [m] Cost of the best path to the goal.
+ * @param areaMax [m^2] The ellipse must be smaller, else the caller is better off sampling the SMap.
+ * @param ellMap EllMap the sample must be in.
+ * @param planIdx, segIdx Sector of the root, where EllMap::locateSector() starts its walk.
+ * @param rng Random generator, RRT_SAMPLE_ATTEMPT_MAX draws at most.
+ * @param[out] posNE [m] The sample [Northing, Easting].
+ * @return False if the ellipse is not smaller than areaMax or RRT_SAMPLE_ATTEMPT_MAX draws were outside the EllMap,
+ * posNE is then unchanged.
+ */
+RRTPLANNER_LIB_EXPORT bool sampleInformed(const Vec2& rootNE, const Vec2& goalNE, double goalRadius, double costBest,
+                                          double areaMax, const EllMap& ellMap, int planIdx, int segIdx,
+                                          std::mt19937& rng, Vec2& posNE);
+
+RRTPLANNER_FRAMEWORK_ALGORITHM_RRT_END_NAMESPACE
+
+#endif
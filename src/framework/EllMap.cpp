@@ -1,44 +1,79 @@
 #include <RrtPlannerLib/framework/EllMap.h>
 #include <RrtPlannerLib/framework/FrameworkDefines.h> //for EPS_DX, TOL_SMALL
 #include <RrtPlannerLib/framework/PlanHelper.h>
+#include <RrtPlannerLib/framework/SectorGrid.h>
+#include <RrtPlannerLib/framework/SectorTable.h>
+#include <RrtPlannerLib/framework/SegmentArrays.h>
+#include <RrtPlannerLib/framework/Vec2.h>
 #include <RrtPlannerLib/framework/VectorF.h>
-#include <RrtPlannerLib/framework/VectorFHelper.h>
 #include <RrtPlannerLib/framework/UtilHelper.h>
-#include <RrtPlannerLib/framework/algorithm/gjk/PointShape.h>
-#include <RrtPlannerLib/framework/algorithm/gjk/Polygon.h>
-#include <RrtPlannerLib/framework/algorithm/gjk/Gjk.h>
-#include <RrtPlannerLib/framework/algorithm/gjk/GjkFactory.h>
 #include <QList>
+#include <QThread>
+#include <QPair>
+#include <QVarLengthArray>
 #include <QSharedPointer>
 #include <QString>
 #include <QtGlobal>
 #include <QDebug>
+#include <algorithm>
 
 RRTPLANNER_FRAMEWORK_BEGIN_NAMESPACE
 
-using namespace algorithm::gjk;
+namespace {
+    //[m] sector bounding boxes in the grid are inflated by this. Only adds candidates, the exact test is
+    //SectorTable::contains().
+    const double SECTOR_GRID_MARGIN = 1.0;
+    //max number of sectors visited by the warm start walk before falling back to the grid search
+    const int SECTOR_WALK_STEPS_MAX = 4;
+    //min number of positions per thread in the batch getRootData. Below this, starting a thread costs more than
+    //the work it takes over.
+    const int ROOT_DATA_BATCH_CHUNK_MIN = 512;
+
+    //curvilinear transform of a sector, relative to its reference plan, i.e., the bounding plan closer to the
+    //nominal plan. The offset plan at crosstrack dx_ref from the reference plan has nodes
+    //node + dx_ref * w, as in PlanHelper::getCrossTrackPlan, and cumulative lengths linear in dx_ref.
+    struct SectorCoeffs
+    {
+        Vec2 nodePrev;          //reference plan nodes of the segment
+        Vec2 nodeNext;
+        Vec2 nVec;              //reference plan segment normal
+        Vec2 wPrev;             //node offset per metre of crosstrack, bVec / dot(bVec, nVec)
+        Vec2 wNext;
+        double crossTrack;      //crosstrack of the reference plan
+        double cumPrev;         //reference plan cumulative length at the start of the segment
+        double cumPrevSlope;    //d(cumPrev)/d(dx_ref), from the cumulative lengths of both bounding plans
+    };
+}
 
 class EllMapPrivate : public QSharedData
 {
 public:
-    EllMapPrivate()
-        :mp_gjk(GjkFactory::getGjk(GjkFactory::GjkType::Basic))
-    {}
+    EllMapPrivate() = default;
     ~EllMapPrivate() = default;
     EllMapPrivate(const EllMapPrivate& rhs);
 
     bool buildEllMap(Plan planNominal, //make a copy because we want to ensure some settings of property flags inside the function.
                      double crossTrackHorizon,
                      QString* results_desc);
-    bool locateSector(const VectorF& posNE, //usv pos
+    bool locateSector(const Vec2& posNE, //usv pos
                       int planIdx_0, int segIdx_0, //initial planIdx and segIdx to start searching
                       int& planIdx, int& segIdx //located sector's associated planIdx and segIdx
                       ) const;
     Plan planNominal() const; //get nominal plan
+    int searchRank(int planIdx, int segIdx, int planIdx_0, int segIdx_0) const;
+    int walkSector(const Vec2& posNE, int planIdx_0, int segIdx_0) const;
+    void buildSectorCoeffs();
+    void rootCoords(int sectorIdx, const Vec2& posNE, double& dx, double& ell, double& L, double& f_ell) const;
+    bool posNE(double dx, double ell, Vec2& posNE) const;
+    int getRootData(const Vec2* posNE, int nPos,
+                    double* dx, double* ell, double* L, double* f_ell, int* planIdx, int* segIdx) const;
 
 public:
     QList<Plan> m_planList; //plan id to be same as plan idx
-    QScopedPointer<Gjk> mp_gjk;
+    QVector<SegmentArrays> m_segArraysList; //contiguous segment attributes of each plan in m_planList, same idx
+    SectorTable m_sectorTable; //vertices and half-planes of the sectors between consecutive plans
+    SectorGrid m_sectorGrid; //spatial index of the sectors
+    QVector<SectorCoeffs> m_sectorCoeffsList; //curvilinear transform of each sector, by sectorIdx
     int m_idxNominal{-1};
     bool m_ellMapReady{};
 };
@@ -47,7 +82,10 @@ public:
 EllMapPrivate::EllMapPrivate(const EllMapPrivate& rhs)
     : QSharedData(rhs),
       m_planList(rhs.m_planList),
-      mp_gjk(GjkFactory::getGjk(GjkFactory::GjkType::Basic)),
+      m_segArraysList(rhs.m_segArraysList),
+      m_sectorTable(rhs.m_sectorTable),
+      m_sectorGrid(rhs.m_sectorGrid),
+      m_sectorCoeffsList(rhs.m_sectorCoeffsList),
       m_idxNominal(rhs.m_idxNominal),
       m_ellMapReady(rhs.m_ellMapReady)
 {
@@ -84,6 +122,21 @@ bool EllMapPrivate::buildEllMap(Plan planNominal,
         }
     }
 
+    //build the contiguous segment arrays used by the queries
+    m_segArraysList.clear();
+    m_segArraysList.reserve(m_planList.size());
+    for(const Plan& plan: m_planList){
+        m_segArraysList.append(SegmentArrays(plan));
+    }
+    m_sectorTable.clear();
+    m_sectorGrid.clear();
+    m_sectorCoeffsList.clear();
+    if(m_ellMapReady){
+        m_sectorTable.build(m_segArraysList);
+        m_sectorGrid.build(m_sectorTable, SECTOR_GRID_MARGIN);
+        buildSectorCoeffs();
+    }
+
     //set output result description if input pointer is not null
     if(results_desc){
         *results_desc = results_desc_local;
@@ -92,7 +145,40 @@ bool EllMapPrivate::buildEllMap(Plan planNominal,
 }
 
 //----------
-bool EllMapPrivate::locateSector(const VectorF& posNE,
+void EllMapPrivate::buildSectorCoeffs()
+{
+    int nSeg = m_sectorTable.nSeg();
+    m_sectorCoeffsList.resize(m_sectorTable.size());
+    for(int planIdx = 0; planIdx < m_segArraysList.size() - 1; ++planIdx){
+        int planIdxRef = planIdx < m_idxNominal? planIdx + 1 : planIdx;
+        int planIdxOuter = planIdx < m_idxNominal? planIdx : planIdx + 1;
+        const SegmentArrays& segArraysRef = m_segArraysList.at(planIdxRef);
+        const SegmentArrays& segArraysOuter = m_segArraysList.at(planIdxOuter);
+        double dCrossTrack = segArraysOuter.crossTrack() - segArraysRef.crossTrack();
+
+        for(int segIdx = 0; segIdx < nSeg; ++segIdx){
+            SectorCoeffs& coeffs = m_sectorCoeffsList[planIdx * nSeg + segIdx];
+            coeffs.nodePrev = segArraysRef.nodePrev(segIdx);
+            coeffs.nodeNext = segArraysRef.nodeNext(segIdx);
+            coeffs.nVec = segArraysRef.nVec(segIdx);
+            //same bisectors as PlanHelper::getCrossTrackPlan: the start node of segment segIdx > 0 is the end node
+            //of segment segIdx - 1
+            coeffs.wPrev = segIdx > 0? \
+                        PlanHelper::findOffsetWaypt(Vec2(), segArraysRef.nVec(segIdx - 1), segArraysRef.bVecNext(segIdx - 1), 1.0, TOL_SMALL) :
+                        PlanHelper::findOffsetWaypt(Vec2(), segArraysRef.nVec(segIdx), segArraysRef.bVecPrev(segIdx), 1.0, TOL_SMALL);
+            coeffs.wNext = PlanHelper::findOffsetWaypt(Vec2(), segArraysRef.nVec(segIdx), segArraysRef.bVecNext(segIdx), 1.0, TOL_SMALL);
+            coeffs.crossTrack = segArraysRef.crossTrack();
+            coeffs.cumPrev = segArraysRef.lengthCumulativePrev(segIdx);
+            //no edge event strictly between two consecutive plans => every segment length is linear in dx_ref
+            coeffs.cumPrevSlope = abs(dCrossTrack) > TOL_SMALL? \
+                        (segArraysOuter.lengthCumulativePrev(segIdx) - coeffs.cumPrev) / dCrossTrack :
+                        0.0;
+        }
+    }
+}
+
+//----------
+bool EllMapPrivate::locateSector(const Vec2& posNE,
                                  int planIdx_0, int segIdx_0,
                                  int& planIdx, int& segIdx
                                  ) const
@@ -103,51 +189,192 @@ bool EllMapPrivate::locateSector(const VectorF& posNE,
     }
 
     bool isInPoly{false};
-    int nPlan = m_planList.size();
-    int nSeg = planNominal().nSegment();
-    algorithm::gjk::PointShape usv(posNE);
-    int np = 0;
-    int side = 1;
-
-    while (!isInPoly && np < nPlan-1){
-        side = -1*side;
-
-        //plan to check
-        planIdx = UtilHelper::mod(planIdx_0 + side*static_cast<int>(ceil(0.5*np)), nPlan-1);
-        const Plan& planCurr = m_planList.at(planIdx);
-        const Plan& planRhs = m_planList.at(planIdx+1);
-
-        int ns = 0;
-        while(ns < nSeg){
-            //segment to check
-            segIdx = UtilHelper::mod(segIdx_0+ns, nSeg);
-
-            const Segment& segCurr = planCurr.segmentList().at(segIdx);
-            const Segment& segRhs = planRhs.segmentList().at(segIdx);
-
-            //sector vertices
-            Polygon polysec{segCurr.wayptPrev().coord_const_ref(),
-                                       segCurr.wayptNext().coord_const_ref(),
-                                       segRhs.wayptPrev().coord_const_ref(),
-                                       segRhs.wayptNext().coord_const_ref()};
-
-            //GJK algorithm
-            double distance;
-            bool isValidDistance;
-            isInPoly = mp_gjk->chkIntersect(usv, polysec, distance, isValidDistance);
-            Q_ASSERT(!isValidDistance); //using basic Gjk, not expecting distance to be calculated.
-
-            //break if usv is in polysec
-            if (isInPoly){
-                break;
-            }
-            ++ns;
+    planIdx = -1;
+    segIdx = -1;
+
+    //warm start: walk from the previous sector
+    int sectorIdx = walkSector(posNE, planIdx_0, segIdx_0);
+    if(sectorIdx >= 0){
+        planIdx = m_sectorTable.planIdx(sectorIdx);
+        segIdx = m_sectorTable.segIdx(sectorIdx);
+        return(true);
+    }
+
+    SectorGrid::CandidateList candidateList;
+    m_sectorGrid.candidates(posNE, candidateList);
+    if(candidateList.isEmpty()){
+        return(isInPoly); //outside of every sector
+    }
+
+    //test candidates in the order the ring search around (planIdx_0, segIdx_0) would, so that a position on the
+    //boundary of several sectors is assigned consistently, and a good initial guess is tested first.
+    QVarLengthArray<QPair<int, int>, 64> rankedList; //(rank, sectorIdx)
+    for(int sectorIdx: candidateList){
+        rankedList.append(qMakePair(searchRank(m_sectorTable.planIdx(sectorIdx), m_sectorTable.segIdx(sectorIdx),
+                                               planIdx_0, segIdx_0),
+                                    sectorIdx));
+    }
+    std::sort(rankedList.begin(), rankedList.end());
+
+    for(const auto& ranked: rankedList){
+        //point in sector (convex hull of its 4 vertices)
+        isInPoly = m_sectorTable.contains(ranked.second, posNE, TOL_SMALL);
+
+        //break if usv is in sector
+        if(isInPoly){
+            planIdx = m_sectorTable.planIdx(ranked.second);
+            segIdx = m_sectorTable.segIdx(ranked.second);
+            break;
         }
-        ++np;
-    } //while
+    }
     return(isInPoly);
 }
 
+//----------
+int EllMapPrivate::walkSector(const Vec2& posNE, int planIdx_0, int segIdx_0) const
+{
+    //the walk returns the same sector as the ranked search of locateSector:
+    //- the start sector has rank 0, so it wins if it contains posNE at all,
+    //- any other sector is accepted only if posNE is inside it by more than the containment tolerance. Sectors
+    //  do not overlap (no edge event strictly between two plans), so no other sector can contain posNE then.
+    //Positions on sector boundaries are left to the ranked search.
+    int nSeg = m_sectorTable.nSeg();
+    if(planIdx_0 < 0 || planIdx_0 >= m_segArraysList.size() - 1 || segIdx_0 < 0 || segIdx_0 >= nSeg){
+        return(-1);
+    }
+    int sectorIdx = planIdx_0 * nSeg + segIdx_0;
+    if(m_sectorTable.contains(sectorIdx, posNE, TOL_SMALL)){
+        return(sectorIdx);
+    }
+
+    for(int step = 0; step < SECTOR_WALK_STEPS_MAX; ++step){
+        SectorTable::Side side;
+        if(m_sectorTable.isDegenerate(sectorIdx) || !m_sectorTable.exitSide(sectorIdx, posNE, side)){
+            break;
+        }
+        sectorIdx = m_sectorTable.neighbour(sectorIdx, side);
+        if(sectorIdx < 0){
+            break;
+        }
+        double depth = m_sectorTable.depth(sectorIdx, posNE);
+        if(depth > 2.0*TOL_SMALL){
+            return(sectorIdx);
+        }
+        if(depth >= -TOL_SMALL){
+            break; //on a boundary
+        }
+    }
+    return(-1);
+}
+
+//----------
+void EllMapPrivate::rootCoords(int sectorIdx, const Vec2& posNE, double& dx, double& ell, double& L, double& f_ell) const
+{
+    const SectorCoeffs& coeffs = m_sectorCoeffsList.at(sectorIdx);
+
+    //determine crosstrack coordinates
+    double dx_ref = (posNE - coeffs.nodePrev).dot(coeffs.nVec);
+    dx = dx_ref + coeffs.crossTrack;
+
+    //parameters for offset plan at dx
+    Vec2 nodePrev = coeffs.nodePrev + dx_ref * coeffs.wPrev;
+    Vec2 nodeNext = coeffs.nodeNext + dx_ref * coeffs.wNext;
+    double cumLength = coeffs.cumPrev + dx_ref * coeffs.cumPrevSlope;
+    double d_ell = (posNE - nodePrev).norm2();
+    L = (nodeNext - nodePrev).norm2();
+    f_ell = d_ell/L;
+    ell = cumLength + d_ell;
+}
+
+//----------
+bool EllMapPrivate::posNE(double dx, double ell, Vec2& posNE) const
+{
+    int nRow = m_segArraysList.size() - 1;
+    int nSeg = m_sectorTable.nSeg();
+    if(!m_ellMapReady || nRow < 1 || nSeg < 1 || ell < 0.0 ||
+       dx < m_segArraysList.first().crossTrack() || dx > m_segArraysList.last().crossTrack()){
+        return(false);
+    }
+
+    //row of sectors between the plans bracketing dx, plans are in ascending crosstrack
+    int lo = 0, hi = nRow;
+    while(hi - lo > 1){
+        int mid = (lo + hi) / 2;
+        if(m_segArraysList.at(mid).crossTrack() <= dx){
+            lo = mid;
+        }
+        else{
+            hi = mid;
+        }
+    }
+    int sectorIdx0 = lo * nSeg;
+
+    //last segment starting at or before ell on the offset plan at dx. Cumulative lengths do not decrease.
+    auto cumPrev = [&](int segIdx){
+        const SectorCoeffs& coeffs = m_sectorCoeffsList.at(sectorIdx0 + segIdx);
+        return(coeffs.cumPrev + (dx - coeffs.crossTrack) * coeffs.cumPrevSlope);
+    };
+    int segLo = 0, segHi = nSeg;
+    while(segHi - segLo > 1){
+        int mid = (segLo + segHi) / 2;
+        if(cumPrev(mid) <= ell){
+            segLo = mid;
+        }
+        else{
+            segHi = mid;
+        }
+    }
+
+    const SectorCoeffs& coeffs = m_sectorCoeffsList.at(sectorIdx0 + segLo);
+    double dx_ref = dx - coeffs.crossTrack;
+    Vec2 nodePrev = coeffs.nodePrev + dx_ref * coeffs.wPrev;
+    Vec2 nodeNext = coeffs.nodeNext + dx_ref * coeffs.wNext;
+    double L = (nodeNext - nodePrev).norm2();
+    double d_ell = ell - cumPrev(segLo);
+    if(d_ell > L + TOL_SMALL){
+        return(false); //beyond the end of the plan
+    }
+    posNE = L > TOL_SMALL? nodePrev + (std::min(d_ell, L) / L) * (nodeNext - nodePrev) : nodePrev;
+    return(true);
+}
+
+//----------
+int EllMapPrivate::getRootData(const Vec2* posNE, int nPos,
+                               double* dx, double* ell, double* L, double* f_ell, int* planIdx, int* segIdx) const
+{
+    int nFound = 0;
+    int planIdx_0 = -1;
+    int segIdx_0 = -1;
+    for(int i = 0; i < nPos; ++i){
+        if(locateSector(posNE[i], planIdx_0, segIdx_0, planIdx[i], segIdx[i])){
+            rootCoords(planIdx[i] * m_sectorTable.nSeg() + segIdx[i], posNE[i], dx[i], ell[i], L[i], f_ell[i]);
+            ++nFound;
+        }
+        else{
+            dx[i] = 0.0;
+            ell[i] = 0.0;
+            L[i] = 0.0;
+            f_ell[i] = 0.0;
+        }
+        planIdx_0 = planIdx[i]; //same warm start as successive calls of EllMap::getRootData with one RootData
+        segIdx_0 = segIdx[i];
+    }
+    return(nFound);
+}
+
+//----------
+int EllMapPrivate::searchRank(int planIdx, int segIdx, int planIdx_0, int segIdx_0) const
+{
+    //order in which the ring search visits sectors: plans alternate around planIdx_0 (planIdx_0, +1, -1, +2, ...,
+    //wrapping around), and within a plan, segments go forward from segIdx_0 (wrapping around).
+    int nRow = m_segArraysList.size() - 1;
+    int nSeg = m_sectorTable.nSeg();
+    int d = UtilHelper::mod(planIdx - planIdx_0, nRow);
+    int planRank = d == 0? 0 : std::min(2*d - 1, 2*(nRow - d));
+    int segRank = UtilHelper::mod(segIdx - segIdx_0, nSeg);
+    return(planRank * nSeg + segRank);
+}
+
 //----------
 Plan EllMapPrivate::planNominal() const
 {
@@ -218,6 +445,26 @@ const Plan& EllMap::at(int idx) const
     return d_ptr->m_planList.at(idx);
 }
 
+//----------
+bool EllMap::boundingBox(Vec2& minNE, Vec2& maxNE) const
+{
+    const SectorTable& sectorTable = d_ptr->m_sectorTable;
+    if(!d_ptr->m_ellMapReady || sectorTable.size() == 0){
+        return(false);
+    }
+
+    minNE = sectorTable.vertex(0, 0);
+    maxNE = minNE;
+    for(int k = 0; k < sectorTable.size(); ++k){
+        for(int i = 0; i < 4; ++i){
+            const Vec2& vertex = sectorTable.vertex(k, i);
+            minNE = Vec2(std::min(minNE[0], vertex[0]), std::min(minNE[1], vertex[1]));
+            maxNE = Vec2(std::max(maxNE[0], vertex[0]), std::max(maxNE[1], vertex[1]));
+        }
+    }
+    return(true);
+}
+
 //----------
 bool EllMap::locateSector(const VectorF& posNE,
                   int planIdx_0, int segIdx_0,
@@ -235,41 +482,13 @@ bool EllMap::getRootData(const VectorF& posNE, RootData& rootData) const
     int segIdx_0 = rootData.segIdx();
 
     int planIdx, segIdx;
-    bool ret = d_ptr->locateSector(posNE, planIdx_0, segIdx_0, planIdx, segIdx);
+    const Vec2 pos = posNE;
+    bool ret = d_ptr->locateSector(pos, planIdx_0, segIdx_0, planIdx, segIdx);
     if(ret){
-        const Plan& plan_p = d_ptr->m_planList.at(planIdx);
-        const Plan& plan_p_plus_1 = d_ptr->m_planList.at(planIdx + 1);
-
-        //determine crosstrack coordinates
-        const Plan& planRef = planIdx < d_ptr->m_idxNominal? \
-                    plan_p_plus_1 :
-                    plan_p;
-        double crossTrack_ref = planRef.crossTrack();
-        const VectorF& nodePrev_ref = planRef.segmentList().at(segIdx).wayptPrev().coord_const_ref();
-        const VectorF& nVec_ref = planRef.segmentList().at(segIdx).nVec();
-        VectorF dPos = VectorFHelper::subtract_vector(posNE, nodePrev_ref);
-        double dx_ref = VectorFHelper::dot_product(dPos, nVec_ref);
-        double dx = dx_ref + crossTrack_ref;
-
-        //get offset plan at posNE position
-        bool results_out;
-        QString results_desc;
-        Plan planOffset = PlanHelper::getCrossTrackPlan(planRef, 2.0*abs(dx_ref), dx_ref, QVector<int>(), TOL_SMALL, &results_out, &results_desc);
-        if(!results_out){
-            qCritical() << "[EllMap::getRootData] error getting cross track plan: " << results_desc;
-            Q_ASSERT(false);
-        }
-
-        //parameters for offset plan at dx
-        double cumLength = segIdx > 0? planOffset.segmentList().at(segIdx - 1).lengthCumulative() : 0.0;
-        const Segment& segOffset = planOffset.segmentList().at(segIdx);
-        const VectorF& nodePrev = segOffset.wayptPrev().coord_const_ref();
-        double d_ell = VectorFHelper::norm2(VectorFHelper::subtract_vector(posNE, nodePrev));
-        double L = segOffset.length();
-        double f_ell = d_ell/L;
-
+        double dx, ell, L, f_ell;
+        d_ptr->rootCoords(planIdx * d_ptr->m_sectorTable.nSeg() + segIdx, pos, dx, ell, L, f_ell);
         rootData.setDx(dx);
-        rootData.setEll(cumLength + d_ell);
+        rootData.setEll(ell);
         rootData.setL(L);
         rootData.setF_ell(f_ell);
 
@@ -279,11 +498,11 @@ bool EllMap::getRootData(const VectorF& posNE, RootData& rootData) const
         rootData.setIsInPoly(true);
 
         //USV arclength baseline. Set ell_list
-        rootData.ell_list().clear();
-        for(const Plan& plan: d_ptr->m_planList){
-            double cumLength_curr = segIdx > 0? plan.segmentList().at(segIdx - 1).lengthCumulative() : 0.0;
-            double ell_curr= cumLength_curr + f_ell * plan.segmentList().at(segIdx).length();
-            rootData.ell_list().append(ell_curr);
+        QVector<double>& ell_list = rootData.ell_list();
+        ell_list.resize(d_ptr->m_segArraysList.size());
+        for(int i = 0; i < ell_list.size(); ++i){
+            const SegmentArrays& segArrays = d_ptr->m_segArraysList.at(i);
+            ell_list[i] = segArrays.lengthCumulativePrev(segIdx) + f_ell * segArrays.length(segIdx);
         }
     }
     else{
@@ -293,6 +512,68 @@ bool EllMap::getRootData(const VectorF& posNE, RootData& rootData) const
     return(ret);
 }
 
+//----------
+bool EllMap::getPosNE(double dx, double ell, Vec2& posNE) const
+{
+    return(d_ptr->posNE(dx, ell, posNE));
+}
+
+//----------
+int EllMap::getRootData(const QVector<Vec2>& posNEList, RootDataBatch& batch, int nThread) const
+{
+    int nPos = posNEList.size();
+    batch.resize(nPos);
+
+    //raw pointers taken once here, so that the threads below neither detach nor share anything but disjoint ranges
+    const Vec2* posNE = posNEList.constData();
+    double* dx = batch.m_dx.data();
+    double* ell = batch.m_ell.data();
+    double* L = batch.m_L.data();
+    double* f_ell = batch.m_f_ell.data();
+    int* planIdx = batch.m_planIdx.data();
+    int* segIdx = batch.m_segIdx.data();
+
+    if(nThread <= 0){
+        nThread = QThread::idealThreadCount();
+    }
+    nThread = std::max(1, std::min(nThread, nPos / ROOT_DATA_BATCH_CHUNK_MIN));
+    if(nThread == 1){
+        return(d_ptr->getRootData(posNE, nPos, dx, ell, L, f_ell, planIdx, segIdx));
+    }
+
+    //contiguous chunks keep the warm start of each thread effective. The calling thread takes the last chunk.
+    const EllMapPrivate* ellMapPrivate = d_ptr.data();
+    int chunkSize = (nPos + nThread - 1) / nThread;
+    QVector<int> nFoundList(nThread, 0);
+    int* nFound = nFoundList.data();
+    QList<QThread*> threadList;
+    for(int t = 0; t < nThread; ++t){
+        int i0 = t * chunkSize;
+        int n = std::min(nPos - i0, chunkSize);
+        auto work = [=](){
+            nFound[t] = ellMapPrivate->getRootData(posNE + i0, n, dx + i0, ell + i0, L + i0, f_ell + i0,
+                                                   planIdx + i0, segIdx + i0);
+        };
+        if(t < nThread - 1){
+            threadList.append(QThread::create(work));
+            threadList.last()->start();
+        }
+        else{
+            work();
+        }
+    }
+    for(QThread* thread: threadList){
+        thread->wait();
+    }
+    qDeleteAll(threadList);
+
+    int nFoundTotal = 0;
+    for(int n: nFoundList){
+        nFoundTotal += n;
+    }
+    return(nFoundTotal);
+}
+
 //----------
 QDebug operator<<(QDebug debug, const RRTPLANNER_NAMESPACE::framework::EllMap &data)
 {
@@ -1,13 +1,11 @@
 #include <RrtPlannerLib/framework/PlanHelper.h>
 #include <RrtPlannerLib/framework/FrameworkDefines.h>
-#include <RrtPlannerLib/framework/VectorFHelper.h>
-#include <RrtPlannerLib/framework/UblasHelper.h>
+#include <RrtPlannerLib/framework/SegmentArrays.h>
+#include <RrtPlannerLib/framework/Vec2Helper.h>
 #include <QtGlobal>
 #include <QDebug>
 #include <limits>
 
-namespace bnu = boost::numeric::ublas;
-
 RRTPLANNER_FRAMEWORK_BEGIN_NAMESPACE
 
 //----------
@@ -34,20 +32,20 @@ PlanHelper::VerifyPlanResult PlanHelper::verifyPlanInput(const QVector<Waypt>& w
     //check no repeated point
     //check if any segment goes in a reverse direction
     if(res ==  VerifyPlanResult::VERIFY_PLAN_OK){   
-        VectorF wayptPrev = wayptList.at(0).coord_const_ref();
-        VectorF wayptLast = wayptList.at(nWaypt-1).coord_const_ref();
-        VectorF vecFirstToLast = VectorFHelper::subtract_vector(wayptLast, wayptPrev);
+        Vec2 wayptPrev = wayptList.at(0).coord_const_ref();
+        Vec2 wayptLast = wayptList.at(nWaypt-1).coord_const_ref();
+        Vec2 vecFirstToLast = wayptLast - wayptPrev;
         for(int idx = 1; idx < nWaypt; ++idx){ //loop from 2nd waypt onwards
-            VectorF wayptNext = wayptList.at(idx).coord_const_ref();
-            VectorF vecPrevToNext = VectorFHelper::subtract_vector(wayptNext, wayptPrev);
+            Vec2 wayptNext = wayptList.at(idx).coord_const_ref();
+            Vec2 vecPrevToNext = wayptNext - wayptPrev;
             //check repeat points
-            double segLength = VectorFHelper::norm2(vecPrevToNext);
+            double segLength = vecPrevToNext.norm2();
             if(segLength < TOL_SMALL){
                 res = VerifyPlanResult::VERIFY_PLAN_ERR_REPEATED_WATPT;
                 break;
             }
             //check reverse dir
-            double dotPdt = VectorFHelper::dot_product(vecPrevToNext, vecFirstToLast);
+            double dotPdt = vecPrevToNext.dot(vecFirstToLast);
             if(dotPdt < 0.0){
                 res = VerifyPlanResult::VERIFY_PLAN_ERR_REVERSE_DIR;
                 break;
@@ -70,32 +68,24 @@ bool PlanHelper::findNearestEdgeEvent(const Plan& plan,
     QVector<int> eventSegIdxList;
     double dxNearest = std::numeric_limits<double>::max(); //init dx
 
-    const QVector<Segment>& segmentList = plan.segmentList();
-    int nSeg = segmentList.size();
+    const SegmentArrays segArrays(plan); //contiguous copy of the segment attributes
+    int nSeg = segArrays.size();
 
     //edge event will need at least 2 segments
     if(nSeg > 1){
         //check event for each segment
         for(int i = 0; i < nSeg; ++i){
-            const Segment& currSeg = segmentList.at(i);
-            const VectorF& tVec = currSeg.tVec();
-            const VectorF& nVec = currSeg.nVec();
-            const VectorF& bVecPrev = currSeg.bVecPrev();
-            const VectorF& bVecNext = currSeg.bVecNext();
-            const VectorF& wayptPrev = currSeg.wayptPrev().coord_const_ref();
-            const VectorF& wayptNext = currSeg.wayptNext().coord_const_ref();
-            bnu::matrix M = UblasHelper::concatenate_col_vectors(bVecPrev.data_const_ref(),
-                                                                         -1.0 * bVecNext.data_const_ref());
-            bnu::vector<double> v = VectorFHelper::subtract_vector(wayptNext, wayptPrev).data_const_ref();
-            bnu::vector<double> d;
-            bool ok = UblasHelper::solve(M, v, TOL_SMALL, d);
+            //intersection of the bisectors at both ends of the segment
+            Vec2 wayptPrev = segArrays.nodePrev(i);
+            Vec2 wayptNext = segArrays.nodeNext(i);
+            Vec2 bVecNext = segArrays.bVecNext(i);
+            Vec2 d;
+            bool ok = Vec2Helper::intersectLines(wayptPrev, segArrays.bVecPrev(i), wayptNext, bVecNext, TOL_SMALL, d);
             if(ok){
-                bnu::vector<double> posEvent = wayptNext.data_const_ref() + d[1]*bVecNext.data_const_ref();
-                bnu::matrix M2 = UblasHelper::concatenate_col_vectors(tVec.data_const_ref(),
-                                                                              nVec.data_const_ref());
-                bnu::vector<double> v2 = posEvent - wayptPrev.data_const_ref();
-                bnu::vector<double> d2;
-                bool ok2 = UblasHelper::solve(M2, v2, TOL_SMALL, d2);
+                //decompose event position into the segment's tangent and normal directions
+                Vec2 posEvent = wayptNext + d[1]*bVecNext;
+                Vec2 d2;
+                bool ok2 = Vec2Helper::solve(segArrays.tVec(i), segArrays.nVec(i), posEvent - wayptPrev, TOL_SMALL, d2);
                 if(ok2){
                     double dx = side * d2[1]; //for port side, cast the problem to stbd side
                     if(dx > 0 && plan.crossTrack() + dx <= crossTrackHorizon){
@@ -190,7 +180,7 @@ Plan PlanHelper::getCrossTrackPlan(const Plan& plan,
         const Segment& firstSeg = segList.first();
         const Segment& lastSeg = segList.last();
 
-        VectorF coord_offset = findOffsetWaypt(firstSeg.wayptPrev().coord_const_ref(), firstSeg.nVec(), firstSeg.bVecPrev(), dx, tol_small);
+        Vec2 coord_offset = findOffsetWaypt(firstSeg.wayptPrev().coord_const_ref(), firstSeg.nVec(), firstSeg.bVecPrev(), dx, tol_small);
         Waypt wayptPrev(lastSeg.wayptPrev());
         wayptPrev.setCoord(coord_offset);
         Waypt wayptNext(lastSeg.wayptNext());
@@ -338,21 +328,21 @@ void PlanHelper::pushPlan( const Plan& plan,
 }
 
 //----------
-VectorF PlanHelper::findOffsetWaypt(const VectorF& pt,
-                                    const VectorF& nVec,
-                                    const VectorF& bVec,
+Vec2 PlanHelper::findOffsetWaypt(const Vec2& pt,
+                                 const Vec2& nVec,
+                                 const Vec2& bVec,
                                     double dx, //crosstrack to offset
                                     double tol_small
                                     )
 {
     //solve scalar, a, using relation: dot(a.bvec, nvec) = dx => a = dx/dot(bvec, nvec)
-    double dotPdt = VectorFHelper::dot_product(bVec, nVec);
+    double dotPdt = bVec.dot(nVec);
     bool ok = abs(dotPdt) >= tol_small;
     if(!ok){
         qFatal("[PlanHelper::findOffsetWaypt] Division by zero error");
     }
     double  a = dx/dotPdt;
-    VectorF res = VectorFHelper::add_vector(pt, VectorFHelper::multiply_value(bVec, a)); //pt + a * bVec
+    Vec2 res = pt + a * bVec;
     return(res);
 }
 
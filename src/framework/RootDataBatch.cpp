@@ -0,0 +1,27 @@
+#include <RrtPlannerLib/framework/RootDataBatch.h>
+
+RRTPLANNER_FRAMEWORK_BEGIN_NAMESPACE
+
+//----------
+RootDataBatch::RootDataBatch()
+{
+
+}
+
+//----------
+RootDataBatch::~RootDataBatch()
+{
+
+}
+
+//----------
+void RootDataBatch::resize(int n)
+{
+    for(QVector<double>* arr: {&m_dx, &m_ell, &m_L, &m_f_ell}){
+        arr->resize(n);
+    }
+    m_planIdx.resize(n);
+    m_segIdx.resize(n);
+}
+
+RRTPLANNER_FRAMEWORK_END_NAMESPACE
@@ -168,6 +168,12 @@ int SMap::idxNominal() const
     return d_ptr->m_idxNominal;
 }
 
+//----------
+const RootData& SMap::rootData() const
+{
+    return d_ptr->m_rootData;
+}
+
 //----------
 QDebug operator<<(QDebug debug, const RRTPLANNER_NAMESPACE::framework::SMap &data)
 {
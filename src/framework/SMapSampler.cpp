@@ -0,0 +1,354 @@
+#include <RrtPlannerLib/framework/SMapSampler.h>
+#include <RrtPlannerLib/framework/EllMap.h>
+#include <RrtPlannerLib/framework/RootData.h>
+#include <QSharedData>
+#include <QtGlobal>
+#include <QDebug>
+#include <algorithm>
+#include <cmath>
+
+RRTPLANNER_FRAMEWORK_BEGIN_NAMESPACE
+
+class SMapSamplerPrivate: public QSharedData
+{
+public:
+    SMapSamplerPrivate() = default;
+    SMapSamplerPrivate(const SMapSamplerPrivate& other) = default;
+    ~SMapSamplerPrivate() = default;
+
+    /**
+     * @brief Area of the (ell, t) section at arclength horizon lh.
+     */
+    double sectionArea(double lh) const;
+
+    /**
+     * @brief Interval of variate u0, and the residual variate uniform in [0, 1).
+     */
+    int interval(double u0, double& residual) const;
+
+    /**
+     * @brief Builds the Walker alias table of the interval probabilities (Vose's method).
+     */
+    void buildAlias();
+
+public:
+    struct Interval
+    {
+        double x0{};        //[m] crosstrack of the first SPlan
+        double width{};     //[m] crosstrack width
+        double lh0{};       //[m] arclength horizon at both ends
+        double lh1{};
+        double b0{};        //cumulative Bernstein weights of the dx marginal, b0 <= b01 <= 1
+        double b01{};
+        double volume{};    //normalised volume
+    };
+
+    SMapSampler::IntervalSearch m_intervalSearch{SMapSampler::IntervalSearch::ALIAS};
+    double m_th0{};
+    double m_umin{};
+    double m_umax{};
+    double m_ellCone{};             //[m] arclength up to which ell/umin <= th0, 0 if umin <= 0
+    double m_paceSpan{};            //[s/m] 1/umin - 1/umax, 0 if umin <= 0
+    QVector<Interval> m_interval;
+    QVector<double> m_cdf;          //m_cdf[i] = vol_cum of SPlan i + 1, m_cdf.last() = 1
+    QVector<double> m_aliasProb;
+    QVector<int> m_alias;
+
+    EllMap m_ellMap;
+    QVector<double> m_planCrossTrack; //crosstrack of the EllMap plans, ascending
+    QVector<double> m_planEll0;       //arclength of the root along each EllMap plan
+};
+
+//----------
+double SMapSamplerPrivate::sectionArea(double lh) const
+{
+    lh = std::min(std::max(lh, 0.0), m_th0 * m_umax);
+    double ell1 = std::min(m_ellCone, lh);
+    double area = 0.5 * m_paceSpan * ell1 * ell1;  //t in [ell/umax, ell/umin]
+    if(lh > ell1){                                  //t in [ell/umax, th0]
+        area += m_th0 * (lh - ell1) - 0.5 * (lh * lh - ell1 * ell1) / m_umax;
+    }
+    return(area);
+}
+
+//----------
+int SMapSamplerPrivate::interval(double u0, double& residual) const
+{
+    int n = m_interval.size();
+    int idx;
+    if(m_intervalSearch == SMapSampler::IntervalSearch::ALIAS){
+        double s = std::min(std::max(u0, 0.0), 1.0) * n;
+        idx = std::min(static_cast<int>(s), n - 1);
+        double frac = s - idx;
+        double prob = m_aliasProb.at(idx);
+        if(frac < prob){
+            residual = frac / prob;
+        }
+        else{
+            residual = (frac - prob) / (1.0 - prob);
+            idx = m_alias.at(idx);
+        }
+    }
+    else{
+        idx = static_cast<int>(std::upper_bound(m_cdf.begin(), m_cdf.end(), u0) - m_cdf.begin());
+        idx = std::min(idx, n - 1);
+        double cdfPrev = idx > 0? m_cdf.at(idx - 1) : 0.0;
+        double volume = m_cdf.at(idx) - cdfPrev;
+        residual = volume > 0.0? (u0 - cdfPrev) / volume : 0.0;
+    }
+    residual = std::min(std::max(residual, 0.0), 1.0);
+    return(idx);
+}
+
+//----------
+void SMapSamplerPrivate::buildAlias()
+{
+    int n = m_interval.size();
+    m_aliasProb.fill(1.0, n);
+    m_alias.resize(n);
+    QVector<double> scaled(n);
+    QVector<int> small, large;
+    for(int i = 0; i < n; ++i){
+        m_alias[i] = i;
+        scaled[i] = (m_cdf.at(i) - (i > 0? m_cdf.at(i - 1) : 0.0)) * n;
+        (scaled.at(i) < 1.0? small : large).append(i);
+    }
+    while(!small.isEmpty() && !large.isEmpty()){
+        int l = small.takeLast();
+        int g = large.last();
+        m_aliasProb[l] = scaled.at(l);
+        m_alias[l] = g;
+        scaled[g] -= 1.0 - scaled.at(l);
+        if(scaled.at(g) < 1.0){
+            large.removeLast();
+            small.append(g);
+        }
+    }
+    //the leftovers are 1 up to rounding
+}
+
+//----------
+SMapSampler::SMapSampler()
+    :d_ptr(new SMapSamplerPrivate)
+{
+
+}
+
+//----------
+SMapSampler::SMapSampler(const SMapSampler& other)
+    :d_ptr(other.d_ptr)
+{
+
+}
+
+//----------
+SMapSampler& SMapSampler::operator=(const SMapSampler& other)
+{
+    if(this != &other){
+        this->d_ptr = other.d_ptr;
+    }
+    return(*this);
+}
+
+//----------
+SMapSampler::~SMapSampler()
+{
+
+}
+
+//----------
+bool SMapSampler::build(const SMap& sMap, IntervalSearch intervalSearch)
+{
+    clear();
+    if(sMap.size() < 2 || !(sMap.umax() > 0.0) || !(sMap.th0() > 0.0) || !(sMap.last().getVol_cum() > 0.0)){
+        qWarning() << "[SMapSampler::build] The SMap has no volume, SMap::reset() needs to be called first. The sampler is left empty.";
+        return(false);
+    }
+
+    SMapSamplerPrivate* d = d_ptr.data();
+    d->m_intervalSearch = intervalSearch;
+    d->m_th0 = sMap.th0();
+    d->m_umin = sMap.umin();
+    d->m_umax = sMap.umax();
+    d->m_ellCone = d->m_umin > 0.0? d->m_th0 * d->m_umin : 0.0;
+    d->m_paceSpan = d->m_umin > 0.0? 1.0 / d->m_umin - 1.0 / d->m_umax : 0.0;
+
+    //dx marginal of each interval: the section area is quadratic in dx, its Bernstein coefficients are the values at
+    //both ends and 2 A(mid) - (A(0) + A(1))/2
+    const QList<SPlan>& sPlanList = sMap.SPlanList_const_ref();
+    const double volCumLast = sPlanList.last().getVol_cum();
+    int n = sPlanList.size() - 1;
+    d->m_interval.resize(n);
+    d->m_cdf.resize(n);
+    double volumeSum{};
+    for(int i = 0; i < n; ++i){
+        SMapSamplerPrivate::Interval& interval = d->m_interval[i];
+        interval.x0 = sPlanList.at(i).getCrosstrack();
+        interval.width = sPlanList.at(i + 1).getCrosstrack() - interval.x0;
+        interval.lh0 = sPlanList.at(i).getLh();
+        interval.lh1 = sPlanList.at(i + 1).getLh();
+        double a0 = d->sectionArea(interval.lh0);
+        double a2 = d->sectionArea(interval.lh1);
+        double a1 = std::max(2.0 * d->sectionArea(0.5 * (interval.lh0 + interval.lh1)) - 0.5 * (a0 + a2), 0.0);
+        double sum = a0 + a1 + a2;
+        interval.b0 = sum > 0.0? a0 / sum : 1.0;
+        interval.b01 = sum > 0.0? (a0 + a1) / sum : 1.0;
+        interval.volume = std::max(interval.width, 0.0) * sum / 3.0;
+        volumeSum += interval.volume;
+        d->m_cdf[i] = std::min(sPlanList.at(i + 1).getVol_cum() / volCumLast, 1.0);
+    }
+    d->m_cdf.last() = 1.0;
+    for(SMapSamplerPrivate::Interval& interval: d->m_interval){
+        interval.volume /= volumeSum;
+    }
+    d->buildAlias();
+
+    //arclength of the root along the EllMap plans, to place the samples
+    d->m_ellMap = sMap.ellMap();
+    d->m_planCrossTrack.resize(d->m_ellMap.size());
+    for(int k = 0; k < d->m_ellMap.size(); ++k){
+        d->m_planCrossTrack[k] = d->m_ellMap.at(k).crossTrack();
+    }
+    d->m_planEll0 = sMap.rootData().ell_list_const_ref();
+    if(d->m_planEll0.size() != d->m_planCrossTrack.size()){
+        qWarning() << "[SMapSampler::build] The root data of the SMap does not match its EllMap. The sampler is left empty.";
+        clear();
+        return(false);
+    }
+    return(true);
+}
+
+//----------
+void SMapSampler::clear()
+{
+    d_ptr->m_interval.clear();
+    d_ptr->m_cdf.clear();
+    d_ptr->m_aliasProb.clear();
+    d_ptr->m_alias.clear();
+    d_ptr->m_planCrossTrack.clear();
+    d_ptr->m_planEll0.clear();
+}
+
+//----------
+bool SMapSampler::isEmpty() const
+{
+    return(d_ptr->m_interval.isEmpty());
+}
+
+//----------
+SMapSampler::IntervalSearch SMapSampler::intervalSearch() const
+{
+    return(d_ptr->m_intervalSearch);
+}
+
+//----------
+int SMapSampler::nInterval() const
+{
+    return(d_ptr->m_interval.size());
+}
+
+//----------
+double SMapSampler::intervalVolume(int idx) const
+{
+    Q_ASSERT(idx >= 0 && idx < d_ptr->m_interval.size());
+    return(d_ptr->m_interval.at(idx).volume);
+}
+
+//----------
+void SMapSampler::sample(double u0, double u1, double u2, double u3, SMapSample& sample) const
+{
+    const SMapSamplerPrivate* d = d_ptr.constData();
+    Q_ASSERT(!d->m_interval.isEmpty());
+
+    //interval, then the Beta component of dx with the residual of u0
+    double residual;
+    int idx = d->interval(u0, residual);
+    const SMapSamplerPrivate::Interval& interval = d->m_interval.at(idx);
+    u1 = std::min(std::max(u1, 0.0), 1.0);
+    double s;
+    if(residual < interval.b0){
+        s = 1.0 - std::cbrt(1.0 - u1);                          //Beta(1,3), CDF 1 - (1 - s)^3
+    }
+    else if(residual < interval.b01){
+        s = 0.5 + std::sin(std::asin(2.0 * u1 - 1.0) / 3.0);    //Beta(2,2), CDF 3 s^2 - 2 s^3
+    }
+    else{
+        s = std::cbrt(u1);                                      //Beta(3,1), CDF s^3
+    }
+    double lh = interval.lh0 + s * (interval.lh1 - interval.lh0);
+    lh = std::min(std::max(lh, 0.0), d->m_th0 * d->m_umax);
+
+    //ell given dx: density ell/umin - ell/umax up to m_ellCone, th0 - ell/umax beyond
+    double ell1 = std::min(d->m_ellCone, lh);
+    double mass1 = 0.5 * d->m_paceSpan * ell1 * ell1;
+    double target = std::min(std::max(u2, 0.0), 1.0) * d->sectionArea(lh);
+    double ell;
+    if(target < mass1){
+        ell = std::sqrt(2.0 * target / d->m_paceSpan);
+    }
+    else{
+        //span tau = th0 - ell/umax, the mass from ell1 is umax (tau1^2 - tau^2) / 2
+        double tau1 = d->m_th0 - ell1 / d->m_umax;
+        double tauSquare = tau1 * tau1 - 2.0 * (target - mass1) / d->m_umax;
+        ell = d->m_umax * (d->m_th0 - std::sqrt(std::max(tauSquare, 0.0)));
+    }
+    ell = std::min(std::max(ell, 0.0), lh);
+
+    //t given ell
+    double tLo = ell / d->m_umax;
+    double tHi = d->m_umin > 0.0? std::min(d->m_th0, ell / d->m_umin) : d->m_th0;
+    double t = tLo + std::min(std::max(u3, 0.0), 1.0) * std::max(tHi - tLo, 0.0);
+
+    sample.dx = interval.x0 + s * interval.width;
+    sample.ell = ell;
+    sample.t = t;
+    sample.speed = t > 0.0? ell / t : d->m_umax;
+    sample.interval = idx;
+}
+
+//----------
+void SMapSampler::sample(std::mt19937& rng, int n, QVector<double>& dxList, QVector<double>& ellList,
+                         QVector<double>& speedList, QVector<double>* p_tList) const
+{
+    dxList.resize(n);
+    ellList.resize(n);
+    speedList.resize(n);
+    if(p_tList){
+        p_tList->resize(n);
+    }
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    SMapSample s;
+    for(int i = 0; i < n; ++i){
+        double u0 = unit(rng);
+        double u1 = unit(rng);
+        double u2 = unit(rng);
+        double u3 = unit(rng);
+        sample(u0, u1, u2, u3, s);
+        dxList[i] = s.dx;
+        ellList[i] = s.ell;
+        speedList[i] = s.speed;
+        if(p_tList){
+            (*p_tList)[i] = s.t;
+        }
+    }
+}
+
+//----------
+bool SMapSampler::posNE(double dx, double ell, Vec2& posNE) const
+{
+    const SMapSamplerPrivate* d = d_ptr.constData();
+    int n = d->m_planCrossTrack.size();
+    if(n < 2){
+        return(false);
+    }
+
+    //the arclength of the root is linear in dx between adjacent plans
+    int k = static_cast<int>(std::upper_bound(d->m_planCrossTrack.begin(), d->m_planCrossTrack.end(), dx) - d->m_planCrossTrack.begin());
+    k = std::min(std::max(k, 1), n - 1);
+    double width = d->m_planCrossTrack.at(k) - d->m_planCrossTrack.at(k - 1);
+    double f = width > 0.0? (dx - d->m_planCrossTrack.at(k - 1)) / width : 0.0;
+    double ell0 = d->m_planEll0.at(k - 1) + f * (d->m_planEll0.at(k) - d->m_planEll0.at(k - 1));
+    return(d->m_ellMap.getPosNE(dx, ell0 + ell, posNE));
+}
+
+RRTPLANNER_FRAMEWORK_END_NAMESPACE
@@ -0,0 +1,183 @@
+#include <RrtPlannerLib/framework/SectorGrid.h>
+#include <RrtPlannerLib/framework/SectorTable.h>
+#include <QtGlobal>
+#include <QDebug>
+#include <QPair>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+RRTPLANNER_FRAMEWORK_BEGIN_NAMESPACE
+
+namespace {
+    const double CELL_SIZE0_MIN = 1.0;          //[m] lower bound of the finest cell size
+    const double CELL_SIZE0_QUANTILE = 0.25;    //finest cell size ~ this quantile of the sector extents
+    const int KEY_BITS_IDX = 29;                //bits of the cell key per cell index
+    const double KEY_LIMIT_IDX = static_cast<double>(qint64(1) << KEY_BITS_IDX);
+    const int LEVEL_MAX = 63;                   //remaining 6 bits of the cell key
+}
+
+//----------
+SectorGrid::SectorGrid()
+{
+
+}
+
+//----------
+SectorGrid::~SectorGrid()
+{
+
+}
+
+//----------
+quint64 SectorGrid::cellKey(int level, qint64 iN, qint64 iE)
+{
+    return((static_cast<quint64>(level) << (2*KEY_BITS_IDX)) |
+           (static_cast<quint64>(iN) << KEY_BITS_IDX) |
+           static_cast<quint64>(iE));
+}
+
+//----------
+void SectorGrid::build(const SectorTable& sectorTable, double margin)
+{
+    clear();
+
+    if(sectorTable.size() == 0){
+        return;
+    }
+    m_nSeg = sectorTable.nSeg();
+    m_nSector = sectorTable.size();
+
+    //inflated bounding box of each sector, and of all sectors
+    m_minN.resize(m_nSector);
+    m_minE.resize(m_nSector);
+    m_maxN.resize(m_nSector);
+    m_maxE.resize(m_nSector);
+    double boundsMinN = std::numeric_limits<double>::max();
+    double boundsMinE = std::numeric_limits<double>::max();
+    double boundsMaxN = std::numeric_limits<double>::lowest();
+    double boundsMaxE = std::numeric_limits<double>::lowest();
+    QVector<double> extentList(m_nSector);
+    for(int k = 0; k < m_nSector; ++k){
+        double minN = sectorTable.vertex(k, 0)[0], minE = sectorTable.vertex(k, 0)[1];
+        double maxN = minN, maxE = minE;
+        for(int i = 1; i < 4; ++i){
+            const Vec2& v = sectorTable.vertex(k, i);
+            minN = std::min(minN, v[0]);
+            minE = std::min(minE, v[1]);
+            maxN = std::max(maxN, v[0]);
+            maxE = std::max(maxE, v[1]);
+        }
+        m_minN[k] = minN - margin;
+        m_minE[k] = minE - margin;
+        m_maxN[k] = maxN + margin;
+        m_maxE[k] = maxE + margin;
+        extentList[k] = std::max(m_maxN[k] - m_minN[k], m_maxE[k] - m_minE[k]);
+        boundsMinN = std::min(boundsMinN, m_minN[k]);
+        boundsMinE = std::min(boundsMinE, m_minE[k]);
+        boundsMaxN = std::max(boundsMaxN, m_maxN[k]);
+        boundsMaxE = std::max(boundsMaxE, m_maxE[k]);
+    }
+    m_origin = Vec2(boundsMinN, boundsMinE);
+
+    //finest cell size from the small sectors, so that the dense region next to the nominal plan is resolved
+    QVector<double> extentSorted(extentList);
+    auto itQuantile = extentSorted.begin() + static_cast<int>(CELL_SIZE0_QUANTILE * (m_nSector - 1));
+    std::nth_element(extentSorted.begin(), itQuantile, extentSorted.end());
+    m_cellSize0 = std::max(*itQuantile, CELL_SIZE0_MIN);
+    double maxCellIdx = static_cast<double>((qint64(1) << KEY_BITS_IDX) - 1);
+    if(std::max(boundsMaxN - boundsMinN, boundsMaxE - boundsMinE) / m_cellSize0 > maxCellIdx){
+        m_cellSize0 = std::max(boundsMaxN - boundsMinN, boundsMaxE - boundsMinE) / maxCellIdx;
+    }
+
+    //each sector goes to the finest level with cellSize >= its extent => at most 2x2 cells
+    QVector<QPair<quint64, int>> keyList;
+    keyList.reserve(4 * m_nSector);
+    QVector<bool> isLevelUsed(LEVEL_MAX + 1, false);
+    for(int k = 0; k < m_nSector; ++k){
+        int level = 0;
+        double cellSize = m_cellSize0;
+        while(cellSize < extentList.at(k) && level < LEVEL_MAX){
+            cellSize *= 2.0;
+            ++level;
+        }
+        isLevelUsed[level] = true;
+        double invCellSize = 1.0 / cellSize;
+        qint64 iN0 = static_cast<qint64>((m_minN.at(k) - m_origin[0]) * invCellSize);
+        qint64 iN1 = static_cast<qint64>((m_maxN.at(k) - m_origin[0]) * invCellSize);
+        qint64 iE0 = static_cast<qint64>((m_minE.at(k) - m_origin[1]) * invCellSize);
+        qint64 iE1 = static_cast<qint64>((m_maxE.at(k) - m_origin[1]) * invCellSize);
+        for(qint64 iN = iN0; iN <= iN1; ++iN){
+            for(qint64 iE = iE0; iE <= iE1; ++iE){
+                keyList.append(qMakePair(cellKey(level, iN, iE), k));
+            }
+        }
+    }
+
+    for(int level = 0; level <= LEVEL_MAX; ++level){
+        if(isLevelUsed.at(level)){
+            m_levelList.append(Level{level, 1.0 / std::ldexp(m_cellSize0, level)});
+        }
+    }
+
+    //compressed storage of the non-empty cells. Sectors in ascending sectorIdx within a cell.
+    std::sort(keyList.begin(), keyList.end());
+    m_entry.reserve(keyList.size());
+    for(int i = 0; i < keyList.size(); ++i){
+        if(i == 0 || keyList.at(i).first != keyList.at(i - 1).first){
+            m_cellHash.insert(keyList.at(i).first, m_cellStart.size());
+            m_cellStart.append(i);
+        }
+        m_entry.append(keyList.at(i).second);
+    }
+    m_cellStart.append(m_entry.size());
+}
+
+//----------
+void SectorGrid::clear()
+{
+    m_nSeg = 0;
+    m_nSector = 0;
+    m_origin = Vec2();
+    m_cellSize0 = 0.0;
+    m_levelList.clear();
+    m_cellHash.clear();
+    m_cellStart.clear();
+    m_entry.clear();
+    m_minN.clear();
+    m_minE.clear();
+    m_maxN.clear();
+    m_maxE.clear();
+}
+
+//----------
+void SectorGrid::candidates(const Vec2& pos, CandidateList& sectorIdxList) const
+{
+    sectorIdxList.clear();
+    double dN = pos[0] - m_origin[0];
+    double dE = pos[1] - m_origin[1];
+    if(isEmpty() || !(dN >= 0.0 && dE >= 0.0)){ //also rejects NaN
+        return;
+    }
+
+    for(const Level& lvl: m_levelList){
+        double fN = dN * lvl.invCellSize;
+        double fE = dE * lvl.invCellSize;
+        if(fN >= KEY_LIMIT_IDX || fE >= KEY_LIMIT_IDX){
+            continue;
+        }
+        auto it = m_cellHash.constFind(cellKey(lvl.level, static_cast<qint64>(fN), static_cast<qint64>(fE)));
+        if(it == m_cellHash.cend()){
+            continue;
+        }
+        for(int i = m_cellStart.at(it.value()); i < m_cellStart.at(it.value() + 1); ++i){
+            int k = m_entry.at(i);
+            if(pos[0] >= m_minN.at(k) && pos[0] <= m_maxN.at(k) &&
+               pos[1] >= m_minE.at(k) && pos[1] <= m_maxE.at(k)){
+                sectorIdxList.append(k);
+            }
+        }
+    }
+}
+
+RRTPLANNER_FRAMEWORK_END_NAMESPACE
@@ -0,0 +1,207 @@
+#include <RrtPlannerLib/framework/SectorTable.h>
+#include <RrtPlannerLib/framework/SegmentArrays.h>
+#include <QtGlobal>
+#include <algorithm>
+#include <cmath>
+
+RRTPLANNER_FRAMEWORK_BEGIN_NAMESPACE
+
+namespace {
+    const double REL_TOL_COLLINEAR = 1e-12; //relative to the squared sector extent
+}
+
+//----------
+SectorTable::SectorTable()
+{
+
+}
+
+//----------
+SectorTable::~SectorTable()
+{
+
+}
+
+//----------
+void SectorTable::build(const QVector<SegmentArrays>& segArraysList)
+{
+    clear();
+
+    int nPlan = segArraysList.size();
+    if(nPlan < 2){
+        return;
+    }
+    m_nSeg = segArraysList.first().size();
+    int nSector = (nPlan - 1) * m_nSeg;
+    m_vertex.resize(4 * nSector);
+    m_normalN.resize(4 * nSector);
+    m_normalE.resize(4 * nSector);
+    m_offset.resize(4 * nSector);
+    m_isDegenerate.resize(nSector);
+    m_neighbour.resize(4 * nSector);
+
+    for(int p = 0; p < nPlan - 1; ++p){
+        const SegmentArrays& planCurr = segArraysList.at(p);
+        const SegmentArrays& planRhs = segArraysList.at(p + 1);
+        Q_ASSERT(planCurr.size() == m_nSeg && planRhs.size() == m_nSeg);
+        for(int s = 0; s < m_nSeg; ++s){
+            int k = p * m_nSeg + s;
+            m_vertex[4*k + 0] = planCurr.nodePrev(s);
+            m_vertex[4*k + 1] = planCurr.nodeNext(s);
+            m_vertex[4*k + 2] = planRhs.nodePrev(s);
+            m_vertex[4*k + 3] = planRhs.nodeNext(s);
+            setHalfPlanes(k);
+        }
+    }
+
+    //neighbours need the degenerate flags of all sectors
+    for(int p = 0; p < nPlan - 1; ++p){
+        for(int s = 0; s < m_nSeg; ++s){
+            setNeighbours(p, s);
+        }
+    }
+}
+
+//----------
+void SectorTable::clear()
+{
+    m_nSeg = 0;
+    m_vertex.clear();
+    m_normalN.clear();
+    m_normalE.clear();
+    m_offset.clear();
+    m_isDegenerate.clear();
+    m_neighbour.clear();
+}
+
+//----------
+bool SectorTable::exitSide(int sectorIdx, const Vec2& pos, Side& side) const
+{
+    const Vec2* v = m_vertex.constData() + 4*sectorIdx;
+    Vec2 centre = 0.25 * (v[0] + v[1] + v[2] + v[3]);
+    const int edgeList[4][2] = {{0, 2}, {1, 3}, {0, 1}, {2, 3}}; //vertices of each side, in Side order
+
+    bool found = false;
+    double distMax = 0.0;
+    for(int i = 0; i < 4; ++i){
+        const Vec2& a = v[edgeList[i][0]];
+        Vec2 d = v[edgeList[i][1]] - a;
+        double length = d.norm2();
+        if(length <= 0.0){
+            continue; //collapsed side, e.g., of a triangle
+        }
+        Vec2 n(-d[1], d[0]);
+        if(n.dot(centre - a) > 0.0){
+            n = -n; //outward
+        }
+        double dist = n.dot(pos - a) / length; //beyond the side if positive
+        if(dist > distMax){
+            distMax = dist;
+            side = static_cast<Side>(i);
+            found = true;
+        }
+    }
+    return(found);
+}
+
+//----------
+void SectorTable::setNeighbours(int planIdx, int segIdx)
+{
+    int nRow = size() / m_nSeg;
+    int k = planIdx * m_nSeg + segIdx;
+    int* neighbour = m_neighbour.data() + 4*k;
+
+    //along the plans: skip the zero area sectors of dummy segments
+    neighbour[static_cast<int>(Side::SegPrev)] = -1;
+    for(int s = segIdx - 1; s >= 0; --s){
+        if(!m_isDegenerate.at(planIdx * m_nSeg + s)){
+            neighbour[static_cast<int>(Side::SegPrev)] = planIdx * m_nSeg + s;
+            break;
+        }
+    }
+    neighbour[static_cast<int>(Side::SegNext)] = -1;
+    for(int s = segIdx + 1; s < m_nSeg; ++s){
+        if(!m_isDegenerate.at(planIdx * m_nSeg + s)){
+            neighbour[static_cast<int>(Side::SegNext)] = planIdx * m_nSeg + s;
+            break;
+        }
+    }
+
+    //across the plans: same segment of the adjacent row
+    int kPort = k - m_nSeg;
+    int kStbd = k + m_nSeg;
+    neighbour[static_cast<int>(Side::Port)] = planIdx > 0 && !m_isDegenerate.at(kPort)? kPort : -1;
+    neighbour[static_cast<int>(Side::Stbd)] = planIdx < nRow - 1 && !m_isDegenerate.at(kStbd)? kStbd : -1;
+}
+
+//----------
+void SectorTable::setHalfPlanes(int sectorIdx)
+{
+    //convex hull of the 4 vertices, counter-clockwise in (northing, easting), collinear points dropped
+    Vec2 pts[4] = {m_vertex[4*sectorIdx], m_vertex[4*sectorIdx + 1], m_vertex[4*sectorIdx + 2], m_vertex[4*sectorIdx + 3]};
+    std::sort(pts, pts + 4, [](const Vec2& a, const Vec2& b){
+        return(a[0] < b[0] || (a[0] == b[0] && a[1] < b[1]));
+    });
+    double extentSquare = (pts[3] - pts[0]).norm2_square();
+    for(int i = 1; i < 4; ++i){
+        extentSquare = std::max(extentSquare, (pts[i] - pts[0]).norm2_square());
+    }
+    double tolCross = REL_TOL_COLLINEAR * extentSquare;
+    auto isLeftTurn = [tolCross](const Vec2& o, const Vec2& a, const Vec2& b){
+        return((a - o).cross_zVal(b - o) > tolCross);
+    };
+
+    Vec2 hull[8];
+    int h = 0;
+    for(int i = 0; i < 4; ++i){ //lower hull
+        while(h >= 2 && !isLeftTurn(hull[h-2], hull[h-1], pts[i])){
+            --h;
+        }
+        hull[h++] = pts[i];
+    }
+    for(int i = 2, lower = h + 1; i >= 0; --i){ //upper hull
+        while(h >= lower && !isLeftTurn(hull[h-2], hull[h-1], pts[i])){
+            --h;
+        }
+        hull[h++] = pts[i];
+    }
+    --h; //last point repeats the first one
+
+    double* nN = m_normalN.data() + 4*sectorIdx;
+    double* nE = m_normalE.data() + 4*sectorIdx;
+    double* c = m_offset.data() + 4*sectorIdx;
+    auto setPlane = [&](int i, const Vec2& n, const Vec2& pt){
+        nN[i] = n[0];
+        nE[i] = n[1];
+        c[i] = n.dot(pt);
+    };
+
+    m_isDegenerate[sectorIdx] = h < 3;
+    if(h >= 3){
+        //polygon: one half-plane per edge, the 4th half-plane of a triangle repeats the first one
+        for(int i = 0; i < 4; ++i){
+            int j = i < h? i : 0;
+            Vec2 d = hull[(j + 1) % h] - hull[j];
+            Vec2 n = Vec2(-d[1], d[0]) * (1.0 / d.norm2()); //inward normal of a ccw polygon
+            setPlane(i, n, hull[j]);
+        }
+    }
+    else if(h == 2 && (hull[1] - hull[0]).norm2_square() > 0.0){
+        //segment: both sides of its line, capped at its end points
+        Vec2 t = (hull[1] - hull[0]) * (1.0 / (hull[1] - hull[0]).norm2());
+        Vec2 n(-t[1], t[0]);
+        setPlane(0, n, hull[0]);
+        setPlane(1, -n, hull[0]);
+        setPlane(2, t, hull[0]);
+        setPlane(3, -t, hull[1]);
+    }
+    else{
+        //point
+        setPlane(0, Vec2(1.0, 0.0), pts[0]);
+        setPlane(1, Vec2(-1.0, 0.0), pts[0]);
+        setPlane(2, Vec2(0.0, 1.0), pts[0]);
+        setPlane(3, Vec2(0.0, -1.0), pts[0]);
+    }
+}
+
+RRTPLANNER_FRAMEWORK_END_NAMESPACE
@@ -1,6 +1,5 @@
 #include <RrtPlannerLib/framework/Segment.h>
 #include <RrtPlannerLib/framework/FrameworkDefines.h>
-#include <RrtPlannerLib/framework/VectorFHelper.h>
 #include <RrtPlannerLib/framework/UtilHelper.h>
 #include <boost/geometry.hpp>
 #include <QSharedData>
@@ -14,35 +13,30 @@ class SegmentPrivate: public QSharedData
 public:
     SegmentPrivate()
         :QSharedData()
-    {
-        m_tVec.resize(DIM_COORD);
-        m_nVec.resize(DIM_COORD);
-        m_bVecPrev.resize(DIM_COORD);
-        m_bVecNext.resize(DIM_COORD);
-    }
+    {}
     ~SegmentPrivate() = default;
     SegmentPrivate(const SegmentPrivate& other) = default;
-    void calculateBisector(const Segment& seg1, const Segment& seg2, VectorF& bVec);
+    void calculateBisector(const Segment& seg1, const Segment& seg2, Vec2& bVec);
 
 public:
     Waypt m_wayptPrev;
     Waypt m_wayptNext;
-    VectorF m_tVec;
-    VectorF m_nVec;
-    VectorF m_bVecPrev;
-    VectorF m_bVecNext;
+    Vec2 m_tVec;
+    Vec2 m_nVec;
+    Vec2 m_bVecPrev;
+    Vec2 m_bVecNext;
     double m_length{};
     double m_lengthCumulative{};
     int m_id{-1};
 };
 
 //----------
-void SegmentPrivate::calculateBisector(const Segment& seg1, const Segment& seg2, VectorF& bVec)
+void SegmentPrivate::calculateBisector(const Segment& seg1, const Segment& seg2, Vec2& bVec)
 {
-    VectorF v = VectorFHelper::add_vector(seg1.nVec(), seg2.nVec());
-    double length_v = VectorFHelper::norm2(v);
+    Vec2 v = seg1.nVec() + seg2.nVec();
+    double length_v = v.norm2();
     if(length_v > TOL_SMALL){
-        bVec = VectorFHelper::multiply_value(v, 1/length_v);
+        bVec = v * (1/length_v);
     }
     else{
         //left-hand perp vector of b (tvec)
@@ -133,25 +127,25 @@ const Waypt& Segment::wayptNext() const
 }
 
 //----------
-void Segment::setTVec(const VectorF& tVec)
+void Segment::setTVec(const Vec2& tVec)
 {
     d_ptr->m_tVec = tVec;
 }
 
 //----------
-const VectorF& Segment::tVec() const
+const Vec2& Segment::tVec() const
 {
     return(d_ptr->m_tVec);
 }
 
 //----------
-void Segment::setNVec(const VectorF& nVec)
+void Segment::setNVec(const Vec2& nVec)
 {
     d_ptr->m_nVec = nVec;
 }
 
 //----------
-const VectorF& Segment::nVec() const
+const Vec2& Segment::nVec() const
 {
     return(d_ptr->m_nVec);
 }
@@ -181,7 +175,7 @@ double Segment::lengthCumulative() const
 }
 
 //----------
-void Segment::setbVecPrev(const VectorF& bVecPrev)
+void Segment::setbVecPrev(const Vec2& bVecPrev)
 {
     d_ptr->m_bVecPrev = bVecPrev;
 }
@@ -193,13 +187,13 @@ void Segment::setbVecPrev(const Segment& segmentPrev)
 }
 
 //----------
-const VectorF& Segment::bVecPrev() const
+const Vec2& Segment::bVecPrev() const
 {
     return(d_ptr->m_bVecPrev);
 }
 
 //----------
-void Segment::setbVecNext(const VectorF& bVecNext)
+void Segment::setbVecNext(const Vec2& bVecNext)
 {
     d_ptr->m_bVecNext = bVecNext;
 }
@@ -211,7 +205,7 @@ void Segment::setbVecNext(const Segment& segmentNext)
 }
 
 //----------
-const VectorF& Segment::bVecNext() const
+const Vec2& Segment::bVecNext() const
 {
     return(d_ptr->m_bVecNext);
 }
@@ -220,11 +214,10 @@ const VectorF& Segment::bVecNext() const
 void Segment::setSegmentAttributes()
 {
     //tVec and length
-    VectorF vecPrev2Next = VectorFHelper::subtract_vector(d_ptr->m_wayptNext.coord_const_ref(),
-                                                          d_ptr->m_wayptPrev.coord_const_ref());
-    d_ptr->m_length = VectorFHelper::norm2(vecPrev2Next);
+    Vec2 vecPrev2Next = d_ptr->m_wayptNext.coord_const_ref() - d_ptr->m_wayptPrev.coord_const_ref();
+    d_ptr->m_length = vecPrev2Next.norm2();
     if(d_ptr->m_length > TOL_SMALL){
-        d_ptr->m_tVec = VectorFHelper::multiply_value(vecPrev2Next, 1/d_ptr->m_length);
+        d_ptr->m_tVec = vecPrev2Next * (1/d_ptr->m_length);
 
         //nVec
         if(DIM_COORD == 2){
@@ -0,0 +1,72 @@
+#include <RrtPlannerLib/framework/SegmentArrays.h>
+#include <RrtPlannerLib/framework/FrameworkDefines.h>
+#include <RrtPlannerLib/framework/Plan.h>
+
+RRTPLANNER_FRAMEWORK_BEGIN_NAMESPACE
+
+//----------
+SegmentArrays::SegmentArrays()
+{
+
+}
+
+//----------
+SegmentArrays::SegmentArrays(const Plan& plan)
+{
+    set(plan);
+}
+
+//----------
+SegmentArrays::~SegmentArrays()
+{
+
+}
+
+//----------
+void SegmentArrays::set(const Plan& plan)
+{
+    const QVector<Segment>& segList = plan.segmentList();
+    int nSeg = segList.size();
+
+    for(QVector<double>* arr: {&m_nodePrevN, &m_nodePrevE, &m_nodeNextN, &m_nodeNextE,
+                               &m_tN, &m_tE, &m_nN, &m_nE,
+                               &m_bPrevN, &m_bPrevE, &m_bNextN, &m_bNextE,
+                               &m_length, &m_lengthCumulative}){
+        arr->resize(nSeg);
+    }
+
+    for(int i = 0; i < nSeg; ++i){
+        const Segment& seg = segList.at(i);
+        const Vec2& nodePrev = seg.wayptPrev().coord_const_ref();
+        const Vec2& nodeNext = seg.wayptNext().coord_const_ref();
+        m_nodePrevN[i] = nodePrev[IDX_NORTHING];
+        m_nodePrevE[i] = nodePrev[IDX_EASTING];
+        m_nodeNextN[i] = nodeNext[IDX_NORTHING];
+        m_nodeNextE[i] = nodeNext[IDX_EASTING];
+        m_tN[i] = seg.tVec()[IDX_NORTHING];
+        m_tE[i] = seg.tVec()[IDX_EASTING];
+        m_nN[i] = seg.nVec()[IDX_NORTHING];
+        m_nE[i] = seg.nVec()[IDX_EASTING];
+        m_bPrevN[i] = seg.bVecPrev()[IDX_NORTHING];
+        m_bPrevE[i] = seg.bVecPrev()[IDX_EASTING];
+        m_bNextN[i] = seg.bVecNext()[IDX_NORTHING];
+        m_bNextE[i] = seg.bVecNext()[IDX_EASTING];
+        m_length[i] = seg.length();
+        m_lengthCumulative[i] = seg.lengthCumulative();
+    }
+    m_crossTrack = plan.crossTrack();
+}
+
+//----------
+void SegmentArrays::clear()
+{
+    for(QVector<double>* arr: {&m_nodePrevN, &m_nodePrevE, &m_nodeNextN, &m_nodeNextE,
+                               &m_tN, &m_tE, &m_nN, &m_nE,
+                               &m_bPrevN, &m_bPrevE, &m_bNextN, &m_bNextE,
+                               &m_length, &m_lengthCumulative}){
+        arr->clear();
+    }
+    m_crossTrack = 0.0;
+}
+
+RRTPLANNER_FRAMEWORK_END_NAMESPACE
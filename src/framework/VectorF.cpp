@@ -55,6 +55,14 @@ VectorF::VectorF(const boost::numeric::ublas::vector<double>& data)
 
 }
 
+//---------
+VectorF::VectorF(const Vec2& vec)
+    :d_ptr(new VectorFPrivate(2))
+{
+    (*d_ptr->m_data)[0] = vec[0];
+    (*d_ptr->m_data)[1] = vec[1];
+}
+
 //---------
 VectorF::~VectorF()
 {
@@ -125,6 +133,13 @@ boost::numeric::ublas::vector<double>& VectorF::data()
     return(*(d_ptr->m_data));
 }
 
+//---------
+VectorF::operator Vec2() const
+{
+    Q_ASSERT(d_ptr->m_data->size() == 2);
+    return(Vec2((*d_ptr->m_data)[0], (*d_ptr->m_data)[1]));
+}
+
 //---------
 QDebug operator<<(QDebug debug, const RRTPLANNER_NAMESPACE::framework::VectorF &data)
 {
@@ -13,7 +13,7 @@ public:
 public:
     VesShape::Type m_type{VesShape::Type::NOT_SET};
     VectorF m_offset; //[dNorthing, dEasting] in meters
-    double m_rotation; //[deg]
+    double m_rotation{}; //[deg]
 };
 
 //#########################
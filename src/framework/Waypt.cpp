@@ -12,14 +12,12 @@ class WayptPrivate: public QSharedData
 public:
     WayptPrivate()
         :QSharedData()
-    {
-        m_coord.resize(DIM_COORD);
-    }
+    {}
     ~WayptPrivate() = default;
     WayptPrivate(const WayptPrivate& other) = default;
 
 public:
-    VectorF m_coord;
+    Vec2 m_coord;
     double m_lon0_deg{};
     int m_id{-1};
 };
@@ -43,7 +41,7 @@ Waypt::Waypt(double northing_m, double easting_m, double lon0_deg, int id)
 }
 
 //----------
-Waypt::Waypt(const VectorF& coord, double lon0_deg, int id)
+Waypt::Waypt(const Vec2& coord, double lon0_deg, int id)
     :d_ptr(new WayptPrivate)
 {
     set(coord, lon0_deg, id);
@@ -81,7 +79,7 @@ void Waypt::set(double northing_m, double easting_m, double lon0_deg, int id)
 }
 
 //----------
-void Waypt::set(const VectorF& coord, double lon0_deg, int id)
+void Waypt::set(const Vec2& coord, double lon0_deg, int id)
 {
     setCoord(coord);
     setLon0(lon0_deg);
@@ -136,13 +134,13 @@ double Waypt::lon0_deg() const
 }
 
 //----------
-void Waypt::setCoord(const VectorF& coord)
+void Waypt::setCoord(const Vec2& coord)
 {
     d_ptr->m_coord = coord;
 }
 
 //----------
-const VectorF& Waypt::coord_const_ref() const
+const Vec2& Waypt::coord_const_ref() const
 {
     return(d_ptr->m_coord);
 }
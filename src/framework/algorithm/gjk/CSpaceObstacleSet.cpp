@@ -0,0 +1,319 @@
+#include <RrtPlannerLib/framework/algorithm/gjk/CSpaceObstacleSet.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/Polygon.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/internal/ConvexHull.h>
+#include <QHash>
+#include <QSharedData>
+#include <QtGlobal>
+#include <algorithm>
+#include <cmath>
+#include <math.h> //for M_PI
+
+RRTPLANNER_FRAMEWORK_ALGORITHM_GJK_BEGIN_NAMESPACE
+
+namespace {
+    /**
+     * @brief Minkowski sum of two convex hulls as returned by convexHull().
+     *
+     * Both start at their lexicographically smallest vertex, so merging their edges by direction walks the boundary
+     * of the sum in O(n + m). Degenerate hulls (points, segments) take the hull of all pairwise sums instead.
+     */
+    QVector<Vec2> minkowskiSum(const QVector<Vec2>& hull1, const QVector<Vec2>& hull2)
+    {
+        int n = hull1.size();
+        int m = hull2.size();
+        QVector<Vec2> pts;
+        pts.reserve(n < 3 || m < 3? n * m : n + m);
+        if(n < 3 || m < 3){
+            for(const Vec2& pt1: hull1){
+                for(const Vec2& pt2: hull2){
+                    pts.append(pt1 + pt2);
+                }
+            }
+        }
+        else{
+            int i = 0, j = 0;
+            while(i < n || j < m){
+                pts.append(hull1.at(i % n) + hull2.at(j % m));
+                double cross = (hull1.at((i + 1) % n) - hull1.at(i % n)).cross_zVal(hull2.at((j + 1) % m) - hull2.at(j % m));
+                if(cross >= 0.0 && i < n){
+                    ++i;
+                }
+                if(cross <= 0.0 && j < m){
+                    ++j;
+                }
+            }
+        }
+        return(convexHull(pts)); //drops the collinear vertices of parallel edges
+    }
+
+    /**
+     * @brief True if pt is inside or on the boundary of the convex hull vertex[0 .. n), as returned by convexHull().
+     */
+    bool containsPoint(const Vec2* vertex, int n, const Vec2& pt)
+    {
+        Vec2 d = pt - vertex[0];
+        if(n < 3){
+            if(n == 1){
+                return(d.norm2_square() <= 0.0);
+            }
+            Vec2 e = vertex[1] - vertex[0];
+            return(e.cross_zVal(d) == 0.0 && d.dot(e) >= 0.0 && d.dot(e) <= e.norm2_square());
+        }
+
+        //fan of triangles from vertex 0: outside the first or last edge, or binary search for the triangle
+        if((vertex[1] - vertex[0]).cross_zVal(d) < 0.0 || (vertex[n - 1] - vertex[0]).cross_zVal(d) > 0.0){
+            return(false);
+        }
+        int lo = 1, hi = n - 1;
+        while(hi - lo > 1){
+            int mid = (lo + hi) / 2;
+            if((vertex[mid] - vertex[0]).cross_zVal(d) >= 0.0){
+                lo = mid;
+            }
+            else{
+                hi = mid;
+            }
+        }
+        return((vertex[hi] - vertex[lo]).cross_zVal(pt - vertex[lo]) >= 0.0);
+    }
+}
+
+class CSpaceObstacleSetPrivate: public QSharedData
+{
+public:
+    CSpaceObstacleSetPrivate() = default;
+    CSpaceObstacleSetPrivate(const CSpaceObstacleSetPrivate& other) = default;
+    ~CSpaceObstacleSetPrivate() = default;
+
+    void setFootprint(const QVector<Vec2>& footprint, int nHeadingBucket);
+    void clear();
+    qint64 cellIdx(double coord) const { return(static_cast<qint64>(std::floor(coord / m_cellSize))); }
+    static quint64 cellKey(qint64 iN, qint64 iE) { return((static_cast<quint64>(static_cast<quint32>(iN)) << 32) | static_cast<quint32>(iE)); }
+
+public:
+    int m_nBucket{};
+    double m_bucketWidth{};             //[deg]
+    QVector<QVector<Vec2>> m_footprint; //by bucket, hull of -R(h) footprint over the bucket headings
+    double m_reach{};                   //[m] bound of the distance of m_footprint vertices from the origin
+    QVector<Vec2> m_vertex;             //vertices of all C-space obstacles
+    QVector<int> m_vertexStart;         //C-space obstacle of obstacle i, bucket b is entry i*m_nBucket + b
+    QVector<double> m_minN;             //bounding box of each obstacle, inflated by m_reach
+    QVector<double> m_minE;
+    QVector<double> m_maxN;
+    QVector<double> m_maxE;
+    double m_cellSize{};                        //[m] grid over the inflated bounding boxes
+    QHash<quint64, QVector<int>> m_cellHash;    //cell key -> ascending indices of the obstacles overlapping the cell
+};
+
+//----------
+void CSpaceObstacleSetPrivate::setFootprint(const QVector<Vec2>& footprint, int nHeadingBucket)
+{
+    Q_ASSERT(footprint.size() > 0);
+    Q_ASSERT(nHeadingBucket >= 4); //tangents of a bucket meet within 90 deg
+
+    m_nBucket = std::max(nHeadingBucket, 4);
+    m_bucketWidth = 360.0 / m_nBucket;
+    double halfWidth = 0.5 * m_bucketWidth * M_PI / 180.0;
+    double tangentScale = 1.0 / std::cos(halfWidth); //arc enclosed by its end points and the meet of its tangents
+
+    double rMax = 0.0;
+    for(const Vec2& uv: footprint){
+        rMax = std::max(rMax, uv.norm2());
+    }
+    m_reach = rMax * tangentScale;
+    m_cellSize = std::max(4.0 * m_reach, 1.0);
+
+    m_footprint.resize(m_nBucket);
+    for(int b = 0; b < m_nBucket; ++b){
+        GjkPose poseStart{Vec2(0.0, 0.0), b * m_bucketWidth};
+        GjkPose poseMid{Vec2(0.0, 0.0), (b + 0.5) * m_bucketWidth};
+        GjkPose poseEnd{Vec2(0.0, 0.0), (b + 1) * m_bucketWidth};
+        QVector<Vec2> pts;
+        pts.reserve(3 * footprint.size());
+        for(const Vec2& uv: footprint){
+            pts.append(-poseStart.toWorld(uv));
+            pts.append(-poseMid.toWorld(uv) * tangentScale);
+            pts.append(-poseEnd.toWorld(uv));
+        }
+        m_footprint[b] = convexHull(pts);
+    }
+    clear();
+}
+
+//----------
+void CSpaceObstacleSetPrivate::clear()
+{
+    m_vertex.clear();
+    m_vertexStart.clear();
+    m_vertexStart.append(0);
+    m_minN.clear();
+    m_minE.clear();
+    m_maxN.clear();
+    m_maxE.clear();
+    m_cellHash.clear();
+}
+
+//----------
+CSpaceObstacleSet::CSpaceObstacleSet()
+    :d_ptr(new CSpaceObstacleSetPrivate)
+{
+    d_ptr->setFootprint(QVector<Vec2>{Vec2(0.0, 0.0)}, CSPACE_HEADING_BUCKETS);
+}
+
+//----------
+CSpaceObstacleSet::CSpaceObstacleSet(const QVector<Vec2>& footprint, int nHeadingBucket)
+    :d_ptr(new CSpaceObstacleSetPrivate)
+{
+    d_ptr->setFootprint(footprint, nHeadingBucket);
+}
+
+//----------
+CSpaceObstacleSet::CSpaceObstacleSet(const CSpaceObstacleSet& other)
+    :d_ptr(other.d_ptr)
+{
+
+}
+
+//----------
+CSpaceObstacleSet& CSpaceObstacleSet::operator=(const CSpaceObstacleSet& other)
+{
+    if(this != &other){
+        this->d_ptr = other.d_ptr;
+    }
+    return(*this);
+}
+
+//----------
+CSpaceObstacleSet::~CSpaceObstacleSet()
+{
+
+}
+
+//----------
+int CSpaceObstacleSet::append(const QVector<Vec2>& vertexList)
+{
+    Q_ASSERT(vertexList.size() > 0);
+
+    QVector<Vec2> hull = convexHull(vertexList);
+    double minN = hull.first()[0], minE = hull.first()[1];
+    double maxN = minN, maxE = minE;
+    for(const Vec2& vertex: hull){
+        minN = std::min(minN, vertex[0]);
+        minE = std::min(minE, vertex[1]);
+        maxN = std::max(maxN, vertex[0]);
+        maxE = std::max(maxE, vertex[1]);
+    }
+
+    for(int b = 0; b < d_ptr->m_nBucket; ++b){
+        d_ptr->m_vertex.append(minkowskiSum(hull, d_ptr->m_footprint.at(b)));
+        d_ptr->m_vertexStart.append(d_ptr->m_vertex.size());
+    }
+    minN -= d_ptr->m_reach;
+    minE -= d_ptr->m_reach;
+    maxN += d_ptr->m_reach;
+    maxE += d_ptr->m_reach;
+    d_ptr->m_minN.append(minN);
+    d_ptr->m_minE.append(minE);
+    d_ptr->m_maxN.append(maxN);
+    d_ptr->m_maxE.append(maxE);
+
+    int idx = size() - 1;
+    for(qint64 iN = d_ptr->cellIdx(minN); iN <= d_ptr->cellIdx(maxN); ++iN){
+        for(qint64 iE = d_ptr->cellIdx(minE); iE <= d_ptr->cellIdx(maxE); ++iE){
+            d_ptr->m_cellHash[CSpaceObstacleSetPrivate::cellKey(iN, iE)].append(idx);
+        }
+    }
+    return(idx);
+}
+
+//----------
+int CSpaceObstacleSet::append(const Polygon& polygon)
+{
+    return(append(polygon.vertexList_const_ref()));
+}
+
+//----------
+void CSpaceObstacleSet::clear()
+{
+    d_ptr->clear();
+}
+
+//----------
+int CSpaceObstacleSet::size() const
+{
+    return(d_ptr->m_minN.size());
+}
+
+//----------
+int CSpaceObstacleSet::nHeadingBucket() const
+{
+    return(d_ptr->m_nBucket);
+}
+
+//----------
+int CSpaceObstacleSet::headingBucket(double heading) const
+{
+    double h = std::fmod(heading, 360.0);
+    if(h < 0.0){
+        h += 360.0;
+    }
+    int ret = static_cast<int>(h / d_ptr->m_bucketWidth);
+    return(std::min(ret, d_ptr->m_nBucket - 1));
+}
+
+//----------
+QVector<Vec2> CSpaceObstacleSet::cObstacle(int idx, int iBucket) const
+{
+    int entry = idx * d_ptr->m_nBucket + iBucket;
+    return(d_ptr->m_vertex.mid(d_ptr->m_vertexStart.at(entry), d_ptr->m_vertexStart.at(entry + 1) - d_ptr->m_vertexStart.at(entry)));
+}
+
+//----------
+bool CSpaceObstacleSet::chkIntersect(const GjkPose& pose) const
+{
+    const Vec2& pt = pose.position;
+    int iBucket = headingBucket(pose.heading);
+    const Vec2* vertex = d_ptr->m_vertex.constData();
+    const int* vertexStart = d_ptr->m_vertexStart.constData();
+    auto it = d_ptr->m_cellHash.constFind(CSpaceObstacleSetPrivate::cellKey(d_ptr->cellIdx(pt[0]), d_ptr->cellIdx(pt[1])));
+    if(it == d_ptr->m_cellHash.constEnd()){
+        return(false);
+    }
+    for(int i: it.value()){
+        if(pt[0] < d_ptr->m_minN.at(i) || pt[0] > d_ptr->m_maxN.at(i) || pt[1] < d_ptr->m_minE.at(i) || pt[1] > d_ptr->m_maxE.at(i)){
+            continue;
+        }
+        int entry = i * d_ptr->m_nBucket + iBucket;
+        if(containsPoint(vertex + vertexStart[entry], vertexStart[entry + 1] - vertexStart[entry], pt)){
+            return(true);
+        }
+    }
+    return(false);
+}
+
+//----------
+int CSpaceObstacleSet::chkIntersect(const GjkPose& pose, QVector<int>& hitIdxList) const
+{
+    hitIdxList.clear();
+    const Vec2& pt = pose.position;
+    int iBucket = headingBucket(pose.heading);
+    const Vec2* vertex = d_ptr->m_vertex.constData();
+    const int* vertexStart = d_ptr->m_vertexStart.constData();
+    auto it = d_ptr->m_cellHash.constFind(CSpaceObstacleSetPrivate::cellKey(d_ptr->cellIdx(pt[0]), d_ptr->cellIdx(pt[1])));
+    if(it == d_ptr->m_cellHash.constEnd()){
+        return(0);
+    }
+    for(int i: it.value()){
+        if(pt[0] < d_ptr->m_minN.at(i) || pt[0] > d_ptr->m_maxN.at(i) || pt[1] < d_ptr->m_minE.at(i) || pt[1] > d_ptr->m_maxE.at(i)){
+            continue;
+        }
+        int entry = i * d_ptr->m_nBucket + iBucket;
+        if(containsPoint(vertex + vertexStart[entry], vertexStart[entry + 1] - vertexStart[entry], pt)){
+            hitIdxList.append(i);
+        }
+    }
+    return(hitIdxList.size());
+}
+
+
+RRTPLANNER_FRAMEWORK_ALGORITHM_GJK_END_NAMESPACE
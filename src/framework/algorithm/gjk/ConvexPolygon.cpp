@@ -0,0 +1,321 @@
+#include <RrtPlannerLib/framework/algorithm/gjk/ConvexPolygon.h>
+#include <RrtPlannerLib/framework/FrameworkDefines.h>
+#include <QSharedData>
+#include <QVector>
+#include <QDebug>
+#include <algorithm>
+#include <cmath>
+#include <math.h> //for M_PI
+#include <limits>
+
+RRTPLANNER_FRAMEWORK_ALGORITHM_GJK_BEGIN_NAMESPACE
+
+namespace {
+    const double REL_TOL_COLLINEAR = 1e-12; //relative to the squared polygon extent
+    const int HILL_CLIMB_STEPS_MAX = 4;     //warm start steps before falling back to the binary search
+    const int BINARY_SEARCH_SIZE_MIN = 32;  //below this size a scan is cheaper than the atan2 of the binary search
+
+    double wrapAngle(double angle)
+    {
+        double ret = std::fmod(angle, 2.0*M_PI);
+        if(ret < 0.0){
+            ret += 2.0*M_PI;
+        }
+        return(ret);
+    }
+}
+
+class ConvexPolygonPrivate: public QSharedData
+{
+public:
+    ConvexPolygonPrivate() = default;
+    explicit ConvexPolygonPrivate(const QVector<Vec2>& vertexList)
+        :QSharedData()
+    {
+        build(vertexList);
+    }
+    ConvexPolygonPrivate(const ConvexPolygonPrivate& other) = default;
+    ~ConvexPolygonPrivate() = default;
+
+    void build(const QVector<Vec2>& vertexList);
+    int searchSupport(const Vec2& dir) const;
+
+public:
+    QVector<Vec2> m_vertexList;
+    QVector<double> m_edgeAngle;    //direction of edge i (vertex i to i+1) relative to edge 0, ascending in [0, 2pi)
+    double m_edgeAngle0{};          //direction of edge 0
+    Vec2 m_centroid;
+    bool m_isConvex{false};
+};
+
+//----------
+void ConvexPolygonPrivate::build(const QVector<Vec2>& vertexList)
+{
+    m_vertexList = vertexList;
+    m_edgeAngle.clear();
+    m_edgeAngle0 = 0.0;
+    m_isConvex = false;
+    m_centroid = Vec2();
+    if(vertexList.isEmpty()){
+        return;
+    }
+
+    double extentSquare = 0.0;
+    for(const Vec2& vertex: vertexList){
+        extentSquare = std::max(extentSquare, (vertex - vertexList.first()).norm2_square());
+    }
+    double tolCross = REL_TOL_COLLINEAR * extentSquare;
+
+    //drop repeated vertices, including a closing copy of the first vertex
+    QVector<Vec2> pts;
+    pts.reserve(vertexList.size());
+    for(const Vec2& vertex: vertexList){
+        if(pts.isEmpty() || (vertex - pts.last()).norm2_square() > tolCross){
+            pts.append(vertex);
+        }
+    }
+    if(pts.size() > 1 && (pts.first() - pts.last()).norm2_square() <= tolCross){
+        pts.removeLast();
+    }
+
+    //counter-clockwise in (northing, easting)
+    double area2 = 0.0;
+    for(int i = 0; i < pts.size(); ++i){
+        area2 += pts.at(i).cross_zVal(pts.at((i + 1) % pts.size()));
+    }
+    if(area2 < 0.0){
+        std::reverse(pts.begin(), pts.end());
+    }
+
+    //drop vertices in the middle of a straight edge. A vertex where the boundary turns back stays and fails below.
+    for(int i = 0; i < pts.size() && pts.size() >= 3;){
+        const Vec2& prev = pts.at((i + pts.size() - 1) % pts.size());
+        const Vec2& next = pts.at((i + 1) % pts.size());
+        Vec2 ePrev = pts.at(i) - prev;
+        Vec2 eNext = next - pts.at(i);
+        if(std::abs(ePrev.cross_zVal(eNext)) <= tolCross && ePrev.dot(eNext) > 0.0){
+            pts.remove(i);
+            i = std::max(i - 1, 0);
+        }
+        else{
+            ++i;
+        }
+    }
+
+    //strictly convex: left turn at every vertex and edge directions turning once around
+    int n = pts.size();
+    bool isConvex = n >= 3;
+    QVector<double> edgeAngle(n);
+    double edgeAngle0 = 0.0;
+    for(int i = 0; i < n && isConvex; ++i){
+        Vec2 ePrev = pts.at(i) - pts.at((i + n - 1) % n);
+        Vec2 eNext = pts.at((i + 1) % n) - pts.at(i);
+        double angle = std::atan2(eNext[1], eNext[0]);
+        if(i == 0){
+            edgeAngle0 = angle;
+        }
+        edgeAngle[i] = i == 0? 0.0 : wrapAngle(angle - edgeAngle0);
+        isConvex = ePrev.cross_zVal(eNext) > tolCross && (i == 0 || edgeAngle.at(i) > edgeAngle.at(i - 1));
+    }
+
+    if(isConvex){
+        m_vertexList = pts;
+        m_edgeAngle = edgeAngle;
+        m_edgeAngle0 = edgeAngle0;
+        m_isConvex = true;
+    }
+    else if(vertexList.size() >= 3){
+        qWarning() << "[ConvexPolygon] Vertices do not form a convex polygon. Support falls back to a linear scan.";
+    }
+
+    for(const Vec2& vertex: m_vertexList){
+        m_centroid += vertex;
+    }
+    m_centroid *= 1.0/m_vertexList.size();
+}
+
+//----------
+int ConvexPolygonPrivate::searchSupport(const Vec2& dir) const
+{
+    //the support vertex is the start of the first edge turning away from dir, i.e., at dir + 90deg or beyond
+    double angle = wrapAngle(std::atan2(dir[1], dir[0]) + 0.5*M_PI - m_edgeAngle0);
+    int idx = static_cast<int>(std::lower_bound(m_edgeAngle.cbegin(), m_edgeAngle.cend(), angle) - m_edgeAngle.cbegin());
+    return(idx == m_edgeAngle.size()? 0 : idx);
+}
+
+//---------
+ConvexPolygon::ConvexPolygon()
+    : IShape(),
+      d_ptr(new ConvexPolygonPrivate)
+{
+
+}
+
+//---------
+ConvexPolygon::ConvexPolygon(const QVector<Vec2>& vertexList)
+    : IShape(),
+      d_ptr(new ConvexPolygonPrivate(vertexList))
+{
+
+}
+
+//---------
+ConvexPolygon::ConvexPolygon(const std::initializer_list<Vec2>& list)
+    : ConvexPolygon(QVector<Vec2>(list))
+{
+
+}
+
+//---------
+ConvexPolygon::ConvexPolygon(const ConvexPolygon& other)
+    :IShape(other),
+      d_ptr(other.d_ptr),
+      m_idxLast(other.m_idxLast)
+{
+
+}
+
+//---------
+ConvexPolygon& ConvexPolygon::operator=(const ConvexPolygon& other)
+{
+    if(this != &other){
+        IShape::operator=(other);
+        this->d_ptr = other.d_ptr;
+        this->m_idxLast = other.m_idxLast;
+    }
+    return(*this);
+}
+
+//----------
+ConvexPolygon::~ConvexPolygon()
+{
+
+}
+
+//----------
+ConvexPolygon* ConvexPolygon::clone() const
+{
+    ConvexPolygon* ret = new ConvexPolygon(*this);
+    ret->detach();
+    return(ret);
+}
+
+//----------
+Vec2 ConvexPolygon::centroid() const
+{
+    Q_ASSERT(d_ptr->m_vertexList.size() > 0);
+
+    return(d_ptr->m_centroid);
+}
+
+//----------
+Vec2 ConvexPolygon::support(const Vec2& dir) const
+{
+    const QVector<Vec2>& vertexList = d_ptr->m_vertexList;
+    Q_ASSERT(vertexList.size() > 0);
+
+    auto scan = [&vertexList](const Vec2& dir){
+        int ret = 0;
+        double maxVal = -std::numeric_limits<double>::max();
+        for(int i = 0; i < vertexList.size(); ++i){
+            double val = vertexList.at(i).dot(dir);
+            if(val > maxVal){
+                ret = i;
+                maxVal = val;
+            }
+        }
+        return(ret);
+    };
+
+    if(!d_ptr->m_isConvex){
+        return(vertexList.at(scan(dir)));
+    }
+
+    int idx = m_idxLast < vertexList.size()? m_idxLast : 0;
+    if(!hillClimb(idx, dir, HILL_CLIMB_STEPS_MAX)){
+        if(vertexList.size() < BINARY_SEARCH_SIZE_MIN){
+            idx = scan(dir);
+        }
+        else{
+            idx = d_ptr->searchSupport(dir);
+            hillClimb(idx, dir, vertexList.size()); //rounding of the edge angles can leave idx next to the support
+        }
+    }
+    m_idxLast = idx;
+    return(vertexList.at(idx));
+}
+
+//----------
+bool ConvexPolygon::hillClimb(int& idx, const Vec2& dir, int nStepMax) const
+{
+    const Vec2* vertex = d_ptr->m_vertexList.constData();
+    int n = d_ptr->m_vertexList.size();
+
+    //projections on dir are unimodal along the boundary of a convex polygon => a local max is the support
+    double val = vertex[idx].dot(dir);
+    for(int k = 0; k <= nStepMax; ++k){
+        int next = idx + 1 == n? 0 : idx + 1;
+        double valNext = vertex[next].dot(dir);
+        if(valNext > val){
+            idx = next;
+            val = valNext;
+            continue;
+        }
+        int prev = idx == 0? n - 1 : idx - 1;
+        double valPrev = vertex[prev].dot(dir);
+        if(valPrev > val){
+            idx = prev;
+            val = valPrev;
+            continue;
+        }
+        return(true);
+    }
+    return(false);
+}
+
+//----------
+bool ConvexPolygon::isConvex() const
+{
+    return(d_ptr->m_isConvex);
+}
+
+//----------
+int ConvexPolygon::size() const
+{
+    return(d_ptr->m_vertexList.size());
+}
+
+//----------
+const Vec2& ConvexPolygon::at(int i) const
+{
+    return(d_ptr->m_vertexList.at(i));
+}
+
+//----------
+const QVector<Vec2>& ConvexPolygon::vertexList_const_ref() const
+{
+    return(d_ptr->m_vertexList);
+}
+
+//----------
+QString ConvexPolygon::debugPrint() const
+{
+    QString ret("[");
+    for(const Vec2& vertex: d_ptr->m_vertexList){
+        ret += QString(" <") + \
+               QString::number(vertex.at(IDX_NORTHING), 'f', 2) + ", " + \
+               QString::number(vertex.at(IDX_EASTING), 'f', 2) + \
+               ">";
+    }
+    ret.append(" ]");
+    return(ret);
+}
+
+//----------
+void ConvexPolygon::detach()
+{
+    d_ptr.detach();
+}
+
+
+RRTPLANNER_FRAMEWORK_ALGORITHM_GJK_END_NAMESPACE
@@ -1,5 +1,6 @@
 #include <RrtPlannerLib/framework/algorithm/gjk/Gjk.h>
 #include <RrtPlannerLib/framework/algorithm/gjk/GjkDefines.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/GjkKernel.h>
 #include <RrtPlannerLib/framework/algorithm/gjk/internal/Simplex.h>
 #include <RrtPlannerLib/framework/algorithm/gjk/internal/Support.h>
 #include <RrtPlannerLib/framework/VectorF.h>
@@ -36,6 +37,43 @@ Gjk::~Gjk()
 
 }
 
+//----------
+bool Gjk::chkIntersectCached(const IShape& shape1, const IShape& shape2, GjkCache& cache, quint64 pairId)
+{
+    Vec2 searchDir;
+    cache.searchDir(pairId, searchDir);
+    bool isIntersect = intersectWarmStart(shape1, shape2, searchDir, eps_square(), max_iteration());
+    cache.setSearchDir(pairId, searchDir);
+    return(isIntersect);
+}
+
+//----------
+bool Gjk::chkContact(const IShape& shape1, const IShape& shape2, GjkContact& contact)
+{
+    double distance;
+    bool isValidDistance;
+    contact = GjkContact();
+    bool isIntersect = chkIntersect(shape1, shape2, distance, isValidDistance);
+    if(isValidDistance){
+        contact.distance = distance;
+    }
+    return(isIntersect);
+}
+
+//----------
+bool Gjk::chkSeparation(const IShape& shape1, const IShape& shape2, double distanceMin, GjkContact& contact)
+{
+    return(isSeparated(shape1, shape2, distanceMin, contact, eps_square(), max_iteration()));
+}
+
+//----------
+bool Gjk::chkSweep(const IShape& footprint, const GjkPose& poseStart, const GjkPose& poseEnd, const IShape& obstacle,
+                   double& timeContact, GjkContact& contact, double distanceTol)
+{
+    return(sweepContact(footprint, poseStart, poseEnd, obstacle, timeContact, contact, distanceTol,
+                        eps_square(), max_iteration()));
+}
+
 //----------
 void Gjk::set_eps_square(double eps_square)
 {
@@ -0,0 +1,366 @@
+#include <RrtPlannerLib/framework/algorithm/gjk/GjkBatch.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/GjkDefines.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/Polygon.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/internal/SimplexKernel.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/internal/SupportLanes.h>
+#include <QSharedData>
+#include <QDebug>
+#include <QtGlobal>
+#include <algorithm>
+#include <cmath>
+
+RRTPLANNER_FRAMEWORK_ALGORITHM_GJK_BEGIN_NAMESPACE
+
+namespace {
+    const int LANES = GJK_BATCH_LANES;
+
+    /**
+     * @brief Vertices of a group of pairs, structure-of-arrays: vertex j of lane l at [j*LANES + l]. Shapes with
+     * fewer vertices than the largest one of the group repeat their last vertex, which never changes the support.
+     */
+    struct PackedGroup
+    {
+        QVector<double> x1, y1, x2, y2;
+        int n1{};
+        int n2{};
+        Vec2 centroid1[LANES];
+        Vec2 centroid2[LANES];
+        int nLane{};    //lanes holding a pair, the others repeat lane 0 and are masked out from the start
+    };
+
+    /**
+     * @brief Support point of the Minkowski difference shape2 - shape1 of each lane: shape2 in dir, shape1 in -dir.
+     */
+    inline void supportDiffLanes(const PackedGroup& group, const Vec2* dir, Vec2* spp)
+    {
+        double dx[LANES], dy[LANES], ndx[LANES], ndy[LANES];
+        for(int l = 0; l < LANES; ++l){
+            dx[l] = dir[l][0];
+            dy[l] = dir[l][1];
+            ndx[l] = -dir[l][0];
+            ndy[l] = -dir[l][1];
+        }
+        double sx1[LANES], sy1[LANES], sx2[LANES], sy2[LANES];
+        supportLanes(group.x2.constData(), group.y2.constData(), group.n2, dx, dy, sx2, sy2);
+        supportLanes(group.x1.constData(), group.y1.constData(), group.n1, ndx, ndy, sx1, sy1);
+        for(int l = 0; l < LANES; ++l){
+            spp[l] = Vec2(sx2[l], sy2[l]) - Vec2(sx1[l], sy1[l]);
+        }
+    }
+
+    /**
+     * @brief The iterations of intersectWarmStart() (seeded with the centroid difference) in lockstep lanes.
+     */
+    void intersectLanes(const PackedGroup& group, double eps_square, int maxIter, bool* isIntersect)
+    {
+        Vec2 dir[LANES];
+        Vec2 spp[LANES];
+        SimplexBasicKernel simplex[LANES];
+        bool isDone[LANES];
+        int k[LANES];
+        for(int l = 0; l < LANES; ++l){
+            dir[l] = group.centroid2[l] - group.centroid1[l]; //arbitrary search dir
+            simplex[l] = SimplexBasicKernel(eps_square);
+            isDone[l] = l >= group.nLane;
+            isIntersect[l] = false;
+            k[l] = -1; //the first support precedes the iterations
+        }
+
+        int nDone = LANES - group.nLane;
+        while(nDone < LANES){
+            supportDiffLanes(group, dir, spp);
+            for(int l = 0; l < LANES; ++l){
+                if(isDone[l]){
+                    continue;
+                }
+                bool isEnd = true;
+                double spp_dot_v = spp[l].dot(dir[l]);
+                if(spp[l].norm2_square() < eps_square){
+                    isIntersect[l] = true; //support on origin
+                }
+                else if(spp_dot_v < 0 && spp_dot_v*spp_dot_v > eps_square*dir[l].norm2_square()){
+                    isIntersect[l] = false; //support short of origin
+                }
+                else if(simplex[l].size() == 0){
+                    simplex[l].update(spp[l], dir[l]);
+                    isEnd = false;
+                }
+                else{
+                    isIntersect[l] = simplex[l].update(spp[l], dir[l]);
+                    isEnd = isIntersect[l];
+                }
+                if(!isEnd && ++k[l] >= maxIter){
+                    qWarning() << "[GjkBatch::chkIntersect] Maximum iteration reached while searching for origin in simplex. Results may not be accurate!";
+                    isEnd = true;
+                }
+                if(isEnd){
+                    isDone[l] = true;
+                    ++nDone;
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief The iterations of intersectMinDist() in lockstep lanes.
+     */
+    void intersectMinDistLanes(const PackedGroup& group, double eps_square, int maxIter,
+                               bool* isIntersect, double* distance, bool* isValidDistance)
+    {
+        Vec2 dir[LANES];
+        Vec2 spp[LANES];
+        SimplexMinDistKernel simplex[LANES];
+        bool isDone[LANES];
+        int k[LANES];
+        for(int l = 0; l < LANES; ++l){
+            dir[l] = group.centroid2[l] - group.centroid1[l]; //arbitrary search dir
+            simplex[l] = SimplexMinDistKernel(eps_square);
+            isDone[l] = l >= group.nLane;
+            isIntersect[l] = false;
+            distance[l] = 0.0;
+            isValidDistance[l] = false;
+            k[l] = -1; //the first support precedes the iterations
+        }
+
+        int nDone = LANES - group.nLane;
+        while(nDone < LANES){
+            supportDiffLanes(group, dir, spp);
+            for(int l = 0; l < LANES; ++l){
+                if(isDone[l]){
+                    continue;
+                }
+                bool isEnd = true;
+                if(spp[l].norm2_square() < eps_square){
+                    isIntersect[l] = true; //support on origin
+                }
+                else if(simplex[l].size() == 0){
+                    simplex[l].update(spp[l], dir[l]);
+                    isEnd = false;
+                }
+                else{
+                    double s = (spp[l] + dir[l]).dot(dir[l]);
+                    if(s*s < eps_square*dir[l].norm2_square()){ //no progress towards the origin => dir is the distance
+                        distance[l] = dir[l].norm2();
+                        isValidDistance[l] = true;
+                    }
+                    else{
+                        isIntersect[l] = simplex[l].update(spp[l], dir[l]);
+                        isEnd = isIntersect[l];
+                    }
+                }
+                if(!isEnd && ++k[l] >= maxIter){
+                    qWarning() << "[GjkBatch::chkIntersect] Maximum iteration reached while searching for origin in simplex. Results may not be accurate!";
+                    isEnd = true;
+                }
+                if(isEnd){
+                    isDone[l] = true;
+                    ++nDone;
+                }
+            }
+        }
+    }
+}
+
+class GjkBatchPrivate: public QSharedData
+{
+public:
+    GjkBatchPrivate() = default;
+    GjkBatchPrivate(const GjkBatchPrivate& other) = default;
+    ~GjkBatchPrivate() = default;
+
+    void pack(int pairIdx0, PackedGroup& group) const;
+
+public:
+    QVector<Vec2> m_vertex;         //vertices of all shapes, shape 2*i and 2*i+1 are those of pair i
+    QVector<int> m_vertexStart;     //vertices of shape s are m_vertex[m_vertexStart[s] .. m_vertexStart[s+1])
+    QVector<Vec2> m_centroid;       //by shape
+    QVector<PackedGroup> m_group;   //pairs LANES*g .. LANES*g + LANES-1, packed on append
+    double m_eps_square{EPS_SQUARE};
+    int m_maxIter{MAX_ITER};
+};
+
+//----------
+void GjkBatchPrivate::pack(int pairIdx0, PackedGroup& group) const
+{
+    int nPair = m_centroid.size() / 2;
+    group.nLane = std::min(LANES, nPair - pairIdx0);
+    auto shapeIdx = [&](int l, int side){
+        return(2*(pairIdx0 + (l < group.nLane? l : 0)) + side);
+    };
+    auto vertexCount = [this](int s){
+        return(m_vertexStart.at(s + 1) - m_vertexStart.at(s));
+    };
+
+    group.n1 = 0;
+    group.n2 = 0;
+    for(int l = 0; l < LANES; ++l){
+        group.n1 = std::max(group.n1, vertexCount(shapeIdx(l, 0)));
+        group.n2 = std::max(group.n2, vertexCount(shapeIdx(l, 1)));
+        group.centroid1[l] = m_centroid.at(shapeIdx(l, 0));
+        group.centroid2[l] = m_centroid.at(shapeIdx(l, 1));
+    }
+
+    auto fill = [&](int side, int nMax, QVector<double>& x, QVector<double>& y){
+        x.resize(nMax * LANES);
+        y.resize(nMax * LANES);
+        for(int l = 0; l < LANES; ++l){
+            int s = shapeIdx(l, side);
+            const Vec2* vertex = m_vertex.constData() + m_vertexStart.at(s);
+            int n = vertexCount(s);
+            for(int j = 0; j < nMax; ++j){
+                const Vec2& pt = vertex[std::min(j, n - 1)];
+                x[j*LANES + l] = pt[0];
+                y[j*LANES + l] = pt[1];
+            }
+        }
+    };
+    fill(0, group.n1, group.x1, group.y1);
+    fill(1, group.n2, group.x2, group.y2);
+}
+
+//----------
+GjkBatch::GjkBatch()
+    :d_ptr(new GjkBatchPrivate)
+{
+    d_ptr->m_vertexStart.append(0);
+}
+
+//----------
+GjkBatch::GjkBatch(const GjkBatch& other)
+    :d_ptr(other.d_ptr)
+{
+
+}
+
+//----------
+GjkBatch& GjkBatch::operator=(const GjkBatch& other)
+{
+    if(this != &other){
+        this->d_ptr = other.d_ptr;
+    }
+    return(*this);
+}
+
+//----------
+GjkBatch::~GjkBatch()
+{
+
+}
+
+//----------
+int GjkBatch::append(const QVector<Vec2>& vertexList1, const QVector<Vec2>& vertexList2)
+{
+    Q_ASSERT(vertexList1.size() > 0 && vertexList2.size() > 0);
+
+    for(const QVector<Vec2>* p_vertexList: {&vertexList1, &vertexList2}){
+        //same centroid as Polygon::centroid(), so that the first search direction is the same as in GjkBasic
+        Vec2 centroid{0.0, 0.0};
+        for(const Vec2& vertex: *p_vertexList){
+            centroid += vertex;
+        }
+        centroid *= 1.0/p_vertexList->size();
+
+        d_ptr->m_vertex.append(*p_vertexList);
+        d_ptr->m_vertexStart.append(d_ptr->m_vertex.size());
+        d_ptr->m_centroid.append(centroid);
+    }
+
+    //(re)pack the group of the new pair, at most LANES pairs
+    int pairIdx = size() - 1;
+    if(pairIdx % LANES == 0){
+        d_ptr->m_group.append(PackedGroup());
+    }
+    d_ptr->pack(pairIdx - pairIdx % LANES, d_ptr->m_group.last());
+    return(pairIdx);
+}
+
+//----------
+int GjkBatch::append(const Polygon& shape1, const Polygon& shape2)
+{
+    return(append(shape1.vertexList_const_ref(), shape2.vertexList_const_ref()));
+}
+
+//----------
+void GjkBatch::clear()
+{
+    d_ptr->m_vertex.clear();
+    d_ptr->m_vertexStart.resize(1);
+    d_ptr->m_centroid.clear();
+    d_ptr->m_group.clear();
+}
+
+//----------
+int GjkBatch::size() const
+{
+    return(d_ptr->m_centroid.size() / 2);
+}
+
+//----------
+void GjkBatch::chkIntersect(QVector<bool>& isIntersectList) const
+{
+    int nPair = size();
+    isIntersectList.resize(nPair);
+    bool isIntersect[LANES];
+    for(int g = 0; g < d_ptr->m_group.size(); ++g){
+        const PackedGroup& group = d_ptr->m_group.at(g);
+        intersectLanes(group, d_ptr->m_eps_square, d_ptr->m_maxIter, isIntersect);
+        for(int l = 0; l < group.nLane; ++l){
+            isIntersectList[g*LANES + l] = isIntersect[l];
+        }
+    }
+}
+
+//----------
+void GjkBatch::chkIntersect(QVector<bool>& isIntersectList, QVector<double>& distanceList,
+                            QVector<bool>& isValidDistanceList) const
+{
+    int nPair = size();
+    isIntersectList.resize(nPair);
+    distanceList.resize(nPair);
+    isValidDistanceList.resize(nPair);
+    bool isIntersect[LANES];
+    double distance[LANES];
+    bool isValidDistance[LANES];
+    for(int g = 0; g < d_ptr->m_group.size(); ++g){
+        const PackedGroup& group = d_ptr->m_group.at(g);
+        intersectMinDistLanes(group, d_ptr->m_eps_square, d_ptr->m_maxIter, isIntersect, distance, isValidDistance);
+        for(int l = 0; l < group.nLane; ++l){
+            isIntersectList[g*LANES + l] = isIntersect[l];
+            distanceList[g*LANES + l] = distance[l];
+            isValidDistanceList[g*LANES + l] = isValidDistance[l];
+        }
+    }
+}
+
+//----------
+void GjkBatch::set_eps_square(double eps_square)
+{
+    d_ptr->m_eps_square = eps_square;
+}
+
+//----------
+double GjkBatch::eps_square() const
+{
+    return(d_ptr->m_eps_square);
+}
+
+//----------
+void GjkBatch::set_max_iteration(int max_iteration)
+{
+    d_ptr->m_maxIter = max_iteration;
+}
+
+//----------
+int GjkBatch::max_iteration() const
+{
+    return(d_ptr->m_maxIter);
+}
+
+//----------
+bool GjkBatch::isAvx2()
+{
+    return(isSupportLanesAvx2());
+}
+
+
+RRTPLANNER_FRAMEWORK_ALGORITHM_GJK_END_NAMESPACE
@@ -0,0 +1,83 @@
+#include <RrtPlannerLib/framework/algorithm/gjk/GjkCache.h>
+#include <QSharedData>
+#include <QHash>
+
+RRTPLANNER_FRAMEWORK_ALGORITHM_GJK_BEGIN_NAMESPACE
+
+class GjkCachePrivate: public QSharedData
+{
+public:
+    GjkCachePrivate() = default;
+    GjkCachePrivate(const GjkCachePrivate& other) = default;
+    ~GjkCachePrivate() = default;
+
+public:
+    QHash<quint64, Vec2> m_searchDir;
+};
+
+//----------
+GjkCache::GjkCache()
+    :d_ptr(new GjkCachePrivate)
+{
+
+}
+
+//----------
+GjkCache::GjkCache(const GjkCache& other)
+    :d_ptr(other.d_ptr)
+{
+
+}
+
+//----------
+GjkCache& GjkCache::operator=(const GjkCache& other)
+{
+    if(this != &other){
+        this->d_ptr = other.d_ptr;
+    }
+    return(*this);
+}
+
+//----------
+GjkCache::~GjkCache()
+{
+
+}
+
+//----------
+bool GjkCache::searchDir(quint64 pairId, Vec2& searchDir) const
+{
+    auto it = d_ptr->m_searchDir.constFind(pairId);
+    if(it == d_ptr->m_searchDir.constEnd()){
+        return(false);
+    }
+    searchDir = it.value();
+    return(true);
+}
+
+//----------
+void GjkCache::setSearchDir(quint64 pairId, const Vec2& searchDir)
+{
+    d_ptr->m_searchDir.insert(pairId, searchDir);
+}
+
+//----------
+void GjkCache::remove(quint64 pairId)
+{
+    d_ptr->m_searchDir.remove(pairId);
+}
+
+//----------
+void GjkCache::clear()
+{
+    d_ptr->m_searchDir.clear();
+}
+
+//----------
+int GjkCache::size() const
+{
+    return(d_ptr->m_searchDir.size());
+}
+
+
+RRTPLANNER_FRAMEWORK_ALGORITHM_GJK_END_NAMESPACE
@@ -1,6 +1,7 @@
 #include <RrtPlannerLib/framework/algorithm/gjk/GjkFactory.h>
 #include <RrtPlannerLib/framework/algorithm/gjk/Gjk.h>
 #include <RrtPlannerLib/framework/algorithm/gjk/internal/GjkBasic.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/internal/GjkEpa.h>
 #include <RrtPlannerLib/framework/algorithm/gjk/internal/GjkMinDist.h>
 #include <QtGlobal>
 
@@ -19,6 +20,9 @@ Gjk* GjkFactory::getGjk(const  GjkFactory::GjkType& gjkType)
     case GjkType::MinDist:
         p_gjk = new GjkMinDist;
         break;
+    case GjkType::Epa:
+        p_gjk = new GjkEpa;
+        break;
     default:
     {
         qFatal("[GjkFactoryCreator::getGjk] unhandled input GjkType enum type!");
@@ -0,0 +1,189 @@
+#include <RrtPlannerLib/framework/algorithm/gjk/ObstacleSet.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/GjkKernel.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/Polygon.h>
+#include <QSharedData>
+#include <QtGlobal>
+#include <algorithm>
+
+RRTPLANNER_FRAMEWORK_ALGORITHM_GJK_BEGIN_NAMESPACE
+
+namespace {
+    /**
+     * @brief IShape with its centroid computed once, for the GJK kernel.
+     */
+    class CachedShape
+    {
+    public:
+        explicit CachedShape(const IShape& shape)
+            :m_shape(shape),
+              m_centroid(shape.centroid())
+        {}
+
+        Vec2 centroid() const { return(m_centroid); }
+        Vec2 support(const Vec2& dir) const { return(m_shape.support(dir)); }
+
+    private:
+        const IShape& m_shape;
+        Vec2 m_centroid;
+    };
+}
+
+class ObstacleSetPrivate: public QSharedData
+{
+public:
+    ObstacleSetPrivate() = default;
+    ObstacleSetPrivate(const ObstacleSetPrivate& other) = default;
+    ~ObstacleSetPrivate() = default;
+
+public:
+    QVector<Vec2> m_vertex;         //vertices of all obstacles
+    QVector<int> m_vertexStart;     //vertices of obstacle i are m_vertex[m_vertexStart[i] .. m_vertexStart[i+1])
+    QVector<Vec2> m_centroid;
+    QVector<double> m_minN;         //bounding box of each obstacle
+    QVector<double> m_minE;
+    QVector<double> m_maxN;
+    QVector<double> m_maxE;
+};
+
+//----------
+ObstacleSet::ObstacleSet()
+    :d_ptr(new ObstacleSetPrivate)
+{
+    d_ptr->m_vertexStart.append(0);
+}
+
+//----------
+ObstacleSet::ObstacleSet(const ObstacleSet& other)
+    :d_ptr(other.d_ptr)
+{
+
+}
+
+//----------
+ObstacleSet& ObstacleSet::operator=(const ObstacleSet& other)
+{
+    if(this != &other){
+        this->d_ptr = other.d_ptr;
+    }
+    return(*this);
+}
+
+//----------
+ObstacleSet::~ObstacleSet()
+{
+
+}
+
+//----------
+int ObstacleSet::append(const QVector<Vec2>& vertexList)
+{
+    Q_ASSERT(vertexList.size() > 0);
+
+    Vec2 centroid{0.0, 0.0};
+    double minN = vertexList.first()[0], minE = vertexList.first()[1];
+    double maxN = minN, maxE = minE;
+    for(const Vec2& vertex: vertexList){
+        centroid += vertex;
+        minN = std::min(minN, vertex[0]);
+        minE = std::min(minE, vertex[1]);
+        maxN = std::max(maxN, vertex[0]);
+        maxE = std::max(maxE, vertex[1]);
+    }
+    centroid *= 1.0/vertexList.size();
+
+    d_ptr->m_vertex.append(vertexList);
+    d_ptr->m_vertexStart.append(d_ptr->m_vertex.size());
+    d_ptr->m_centroid.append(centroid);
+    d_ptr->m_minN.append(minN);
+    d_ptr->m_minE.append(minE);
+    d_ptr->m_maxN.append(maxN);
+    d_ptr->m_maxE.append(maxE);
+    return(size() - 1);
+}
+
+//----------
+int ObstacleSet::append(const Polygon& polygon)
+{
+    return(append(polygon.vertexList_const_ref()));
+}
+
+//----------
+void ObstacleSet::clear()
+{
+    d_ptr = new ObstacleSetPrivate;
+    d_ptr->m_vertexStart.append(0);
+}
+
+//----------
+int ObstacleSet::size() const
+{
+    return(d_ptr->m_centroid.size());
+}
+
+//----------
+const Vec2* ObstacleSet::vertexData(int idx) const
+{
+    return(d_ptr->m_vertex.constData() + d_ptr->m_vertexStart.at(idx));
+}
+
+//----------
+int ObstacleSet::vertexCount(int idx) const
+{
+    return(d_ptr->m_vertexStart.at(idx + 1) - d_ptr->m_vertexStart.at(idx));
+}
+
+//----------
+int ObstacleSet::chkIntersect(const IShape& shape, QVector<int>& hitIdxList,
+                              QVector<double>* p_distanceList, double distanceMax) const
+{
+    hitIdxList.clear();
+    if(p_distanceList){
+        p_distanceList->clear();
+    }
+    if(size() == 0){
+        return(0);
+    }
+
+    //bounding box of the query shape, inflated by distanceMax
+    double margin = std::max(distanceMax, 0.0);
+    double minN = shape.support(Vec2(-1.0, 0.0))[0] - margin;
+    double maxN = shape.support(Vec2(1.0, 0.0))[0] + margin;
+    double minE = shape.support(Vec2(0.0, -1.0))[1] - margin;
+    double maxE = shape.support(Vec2(0.0, 1.0))[1] + margin;
+
+    const double* obsMinN = d_ptr->m_minN.constData();
+    const double* obsMinE = d_ptr->m_minE.constData();
+    const double* obsMaxN = d_ptr->m_maxN.constData();
+    const double* obsMaxE = d_ptr->m_maxE.constData();
+    CachedShape query(shape);
+    SimplexWitnessKernel simplex;
+    GjkContact contact;
+    for(int i = 0; i < size(); ++i){
+        if(obsMaxN[i] < minN || obsMinN[i] > maxN || obsMaxE[i] < minE || obsMinE[i] > maxE){
+            continue;
+        }
+
+        ConvexView obstacle(vertexData(i), vertexCount(i), d_ptr->m_centroid.at(i));
+        double distance = 0.0;
+        bool isHit = false;
+        if(margin <= 0.0){
+            isHit = intersect(query, obstacle);
+        }
+        else{
+            ClosestPointsResult result = closestPoints(query, obstacle, margin, simplex, contact);
+            isHit = result == ClosestPointsResult::Intersect ||
+                    (result == ClosestPointsResult::Converged && contact.distance <= margin);
+            distance = result == ClosestPointsResult::Intersect? 0.0 : contact.distance;
+        }
+        if(isHit){
+            hitIdxList.append(i);
+            if(p_distanceList){
+                p_distanceList->append(distance);
+            }
+        }
+    }
+    return(hitIdxList.size());
+}
+
+
+RRTPLANNER_FRAMEWORK_ALGORITHM_GJK_END_NAMESPACE
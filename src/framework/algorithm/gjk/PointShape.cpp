@@ -11,7 +11,7 @@ public:
     ~PointShapePrivate() = default;
 
 public:
-    VectorF m_pt{};
+    Vec2 m_pt{};
 
 };
 
@@ -25,7 +25,7 @@ PointShape::PointShape()
 }
 
 //----------
-PointShape::PointShape(const VectorF& pt)
+PointShape::PointShape(const Vec2& pt)
     :PointShape()
 {
     setPt(pt);
@@ -56,13 +56,13 @@ PointShape::~PointShape()
 }
 
 //----------
-const VectorF& PointShape::pt() const
+const Vec2& PointShape::pt() const
 {
     return d_ptr->m_pt;
 }
 
 //----------
-void PointShape::setPt(const VectorF& pt)
+void PointShape::setPt(const Vec2& pt)
 {
      d_ptr->m_pt = pt;
 }
@@ -76,13 +76,13 @@ IShape* PointShape::clone() const
 }
 
 //----------
-VectorF PointShape::centroid() const
+Vec2 PointShape::centroid() const
 {
     return(d_ptr->m_pt);
 }
 
 //----------
-VectorF PointShape::support(const VectorF& dir) const
+Vec2 PointShape::support(const Vec2& dir) const
 {
     return(d_ptr->m_pt);
 }
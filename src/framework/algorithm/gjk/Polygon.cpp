@@ -1,6 +1,5 @@
 #include <RrtPlannerLib/framework/algorithm/gjk/Polygon.h>
 #include <RrtPlannerLib/framework/FrameworkDefines.h>
-#include <RrtPlannerLib/framework/VectorFHelper.h>
 #include <QSharedData>
 #include <QVector>
 #include <QScopedPointer>
@@ -13,7 +12,7 @@ class PolygonPrivate: public QSharedData
 {
 public:
     PolygonPrivate() = default;
-    PolygonPrivate(const std::initializer_list<VectorF>& list)
+    PolygonPrivate(const std::initializer_list<Vec2>& list)
         :QSharedData(),
           m_vertexList(list)
     {}   
@@ -21,7 +20,7 @@ public:
     ~PolygonPrivate() = default;
 
 public:
-    QVector<VectorF> m_vertexList;
+    QVector<Vec2> m_vertexList;
 
 };
 
@@ -34,7 +33,7 @@ Polygon::Polygon()
 }
 
 //---------
-Polygon::Polygon(const std::initializer_list<VectorF>& list)
+Polygon::Polygon(const std::initializer_list<Vec2>& list)
     : IShape(),
       d_ptr(new PolygonPrivate(list))
 {
@@ -75,27 +74,27 @@ Polygon* Polygon::clone() const
 }
 
 //----------
-VectorF Polygon::centroid() const
+Vec2 Polygon::centroid() const
 {
     Q_ASSERT(d_ptr->m_vertexList.size() > 0);
 
-    VectorF ret{0.0, 0.0};
-    for(const VectorF& vertex: d_ptr->m_vertexList){
-        ret = VectorFHelper::add_vector(ret, vertex);
+    Vec2 ret{0.0, 0.0};
+    for(const Vec2& vertex: d_ptr->m_vertexList){
+        ret += vertex;
     }
-    ret = VectorFHelper::multiply_value(ret, 1.0/d_ptr->m_vertexList.size());
+    ret *= 1.0/d_ptr->m_vertexList.size();
     return(ret);
 }
 
 //----------
-VectorF Polygon::support(const VectorF& dir) const
+Vec2 Polygon::support(const Vec2& dir) const
 {
     Q_ASSERT(d_ptr->m_vertexList.size() > 0);
 
-    VectorF ret;
+    Vec2 ret;
     double maxVal = -std::numeric_limits<double>::max();
-    for(const VectorF& vertex: d_ptr->m_vertexList){
-        double val = VectorFHelper::dot_product(vertex, dir);
+    for(const Vec2& vertex: d_ptr->m_vertexList){
+        double val = vertex.dot(dir);
         if(val > maxVal){
             ret = vertex;
             maxVal = val;
@@ -111,25 +110,25 @@ int Polygon::size() const
 }
 
 //----------
-const VectorF& Polygon::at(int i) const
+const Vec2& Polygon::at(int i) const
 {
     return(d_ptr->m_vertexList.at(i));
 }
 
 //----------
-VectorF& Polygon::operator[](int i)
+Vec2& Polygon::operator[](int i)
 {
     return(d_ptr->m_vertexList[i]);
 }
 
 //----------
-const QVector<VectorF>& Polygon::vertexList_const_ref() const
+const QVector<Vec2>& Polygon::vertexList_const_ref() const
 {
     return(d_ptr->m_vertexList);
 }
 
 //----------
-QVector<VectorF>& Polygon::vertexList()
+QVector<Vec2>& Polygon::vertexList()
 {
     return(d_ptr->m_vertexList);
 }
@@ -138,7 +137,7 @@ QVector<VectorF>& Polygon::vertexList()
 QString Polygon::debugPrint() const
 {
     QString ret("[");
-    for(const VectorF& vertex: d_ptr->m_vertexList){
+    for(const Vec2& vertex: d_ptr->m_vertexList){
         ret += QString(" <") + \
                QString::number(vertex.at(IDX_NORTHING), 'f', 2) + ", " + \
                QString::number(vertex.at(IDX_EASTING), 'f', 2) + \
@@ -0,0 +1,280 @@
+#include <RrtPlannerLib/framework/algorithm/gjk/SignedDistanceGrid.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/ObstacleSet.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/internal/ConvexHull.h>
+#include <QSharedData>
+#include <QVector>
+#include <QtGlobal>
+#include <QDebug>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+RRTPLANNER_FRAMEWORK_ALGORITHM_GJK_BEGIN_NAMESPACE
+
+namespace {
+    /**
+     * @brief Distance from pt to the segment [a, b].
+     */
+    double segmentDistance(const Vec2& a, const Vec2& b, const Vec2& pt)
+    {
+        Vec2 e = b - a;
+        Vec2 d = pt - a;
+        double eSquare = e.norm2_square();
+        double t = eSquare > 0.0? std::min(std::max(d.dot(e) / eSquare, 0.0), 1.0) : 0.0;
+        return((d - t * e).norm2());
+    }
+
+    /**
+     * @brief Signed distance from pt to the convex hull vertex[0 .. n), as returned by convexHull().
+     *
+     * Inside, the distance to the boundary is the smallest distance to the edge lines. Outside, it is the distance to
+     * the nearest edge.
+     */
+    double signedDistance(const QVector<Vec2>& vertex, const QVector<Vec2>& normal, const Vec2& pt)
+    {
+        int n = vertex.size();
+        if(n < 3){
+            return(n == 1? (pt - vertex.at(0)).norm2() : segmentDistance(vertex.at(0), vertex.at(1), pt));
+        }
+
+        double outMax = -std::numeric_limits<double>::max();
+        for(int i = 0; i < n; ++i){
+            outMax = std::max(outMax, normal.at(i).dot(pt - vertex.at(i)));
+        }
+        if(outMax <= 0.0){
+            return(outMax);
+        }
+        double ret = std::numeric_limits<double>::max();
+        for(int i = 0; i < n; ++i){
+            ret = std::min(ret, segmentDistance(vertex.at(i), vertex.at((i + 1) % n), pt));
+        }
+        return(ret);
+    }
+}
+
+class SignedDistanceGridPrivate: public QSharedData
+{
+public:
+    SignedDistanceGridPrivate() = default;
+    SignedDistanceGridPrivate(const SignedDistanceGridPrivate& other) = default;
+    ~SignedDistanceGridPrivate() = default;
+
+    /**
+     * @brief Cell (i, j) containing posNE, clamped to the grid, and the fractions (tN, tE) of posNE within it.
+     */
+    void locate(const Vec2& posNE, int& i, int& j, double& tN, double& tE) const;
+
+public:
+    int m_nN{};
+    int m_nE{};
+    Vec2 m_origin;
+    double m_resolution{};
+    double m_distanceMax{};
+    QVector<float> m_value;     //node (i, j) is entry i*m_nE + j
+};
+
+//----------
+void SignedDistanceGridPrivate::locate(const Vec2& posNE, int& i, int& j, double& tN, double& tE) const
+{
+    //a single node along an axis is a cell of zero width
+    double sN = std::min(std::max((posNE[0] - m_origin[0]) / m_resolution, 0.0), static_cast<double>(m_nN - 1));
+    double sE = std::min(std::max((posNE[1] - m_origin[1]) / m_resolution, 0.0), static_cast<double>(m_nE - 1));
+    i = std::min(static_cast<int>(sN), std::max(m_nN - 2, 0));
+    j = std::min(static_cast<int>(sE), std::max(m_nE - 2, 0));
+    tN = sN - i;
+    tE = sE - j;
+}
+
+//----------
+SignedDistanceGrid::SignedDistanceGrid()
+    :d_ptr(new SignedDistanceGridPrivate)
+{
+
+}
+
+//----------
+SignedDistanceGrid::SignedDistanceGrid(const SignedDistanceGrid& other)
+    :d_ptr(other.d_ptr)
+{
+
+}
+
+//----------
+SignedDistanceGrid& SignedDistanceGrid::operator=(const SignedDistanceGrid& other)
+{
+    if(this != &other){
+        this->d_ptr = other.d_ptr;
+    }
+    return(*this);
+}
+
+//----------
+SignedDistanceGrid::~SignedDistanceGrid()
+{
+
+}
+
+//----------
+bool SignedDistanceGrid::build(const ObstacleSet& obstacleSet, const Vec2& minNE, const Vec2& maxNE,
+                               double resolution, double distanceMax)
+{
+    clear();
+    if(!(resolution > 0.0) || !(distanceMax > 0.0) || !(maxNE[0] >= minNE[0]) || !(maxNE[1] >= minNE[1])){
+        qWarning() << "[SignedDistanceGrid::build] Invalid rectangle, resolution or distanceMax. The grid is left empty.";
+        return(false);
+    }
+    double nN = std::ceil((maxNE[0] - minNE[0]) / resolution) + 1.0;
+    double nE = std::ceil((maxNE[1] - minNE[1]) / resolution) + 1.0;
+    if(nN * nE > SDF_MAX_NODE){
+        qWarning() << "[SignedDistanceGrid::build] The grid would exceed SDF_MAX_NODE nodes, increase the resolution. The grid is left empty.";
+        return(false);
+    }
+
+    SignedDistanceGridPrivate* d = d_ptr.data();
+    d->m_nN = static_cast<int>(nN);
+    d->m_nE = static_cast<int>(nE);
+    d->m_origin = minNE;
+    d->m_resolution = resolution;
+    d->m_distanceMax = distanceMax;
+    d->m_value.fill(static_cast<float>(distanceMax), d->m_nN * d->m_nE);
+
+    for(int idx = 0; idx < obstacleSet.size(); ++idx){
+        QVector<Vec2> vertex = convexHull(QVector<Vec2>(obstacleSet.vertexData(idx),
+                                                        obstacleSet.vertexData(idx) + obstacleSet.vertexCount(idx)));
+        QVector<Vec2> normal(vertex.size()); //outward unit normals of the edges of a counter-clockwise hull
+        Vec2 lo = vertex.at(0), hi = vertex.at(0);
+        for(int k = 0; k < vertex.size(); ++k){
+            Vec2 e = vertex.at((k + 1) % vertex.size()) - vertex.at(k);
+            normal[k] = e.norm2() > 0.0? Vec2(e[1], -e[0]) * (1.0 / e.norm2()) : Vec2();
+            lo = Vec2(std::min(lo[0], vertex.at(k)[0]), std::min(lo[1], vertex.at(k)[1]));
+            hi = Vec2(std::max(hi[0], vertex.at(k)[0]), std::max(hi[1], vertex.at(k)[1]));
+        }
+
+        //nodes within distanceMax of the bounding box, the others are at least distanceMax away
+        int i0 = static_cast<int>(std::max(std::ceil((lo[0] - distanceMax - minNE[0]) / resolution), 0.0));
+        int i1 = static_cast<int>(std::min(std::floor((hi[0] + distanceMax - minNE[0]) / resolution), nN - 1.0));
+        int j0 = static_cast<int>(std::max(std::ceil((lo[1] - distanceMax - minNE[1]) / resolution), 0.0));
+        int j1 = static_cast<int>(std::min(std::floor((hi[1] + distanceMax - minNE[1]) / resolution), nE - 1.0));
+        for(int i = i0; i <= i1; ++i){
+            float* row = d->m_value.data() + static_cast<qint64>(i) * d->m_nE;
+            for(int j = j0; j <= j1; ++j){
+                Vec2 pt = minNE + Vec2(i * resolution, j * resolution);
+                double value = std::max(signedDistance(vertex, normal, pt), -distanceMax);
+                row[j] = std::min(row[j], static_cast<float>(value));
+            }
+        }
+    }
+    return(true);
+}
+
+//----------
+void SignedDistanceGrid::clear()
+{
+    d_ptr->m_nN = 0;
+    d_ptr->m_nE = 0;
+    d_ptr->m_value.clear();
+}
+
+//----------
+bool SignedDistanceGrid::isEmpty() const
+{
+    return(d_ptr->m_value.isEmpty());
+}
+
+//----------
+int SignedDistanceGrid::nN() const
+{
+    return(d_ptr->m_nN);
+}
+
+//----------
+int SignedDistanceGrid::nE() const
+{
+    return(d_ptr->m_nE);
+}
+
+//----------
+Vec2 SignedDistanceGrid::origin() const
+{
+    return(d_ptr->m_origin);
+}
+
+//----------
+double SignedDistanceGrid::resolution() const
+{
+    return(d_ptr->m_resolution);
+}
+
+//----------
+double SignedDistanceGrid::distanceMax() const
+{
+    return(d_ptr->m_distanceMax);
+}
+
+//----------
+double SignedDistanceGrid::errorBound() const
+{
+    return(std::sqrt(2.0) * d_ptr->m_resolution + d_ptr->m_distanceMax * std::numeric_limits<float>::epsilon());
+}
+
+//----------
+bool SignedDistanceGrid::contains(const Vec2& posNE) const
+{
+    const SignedDistanceGridPrivate* d = d_ptr.constData();
+    if(d->m_value.isEmpty()){
+        return(false);
+    }
+    Vec2 s = (posNE - d->m_origin) * (1.0 / d->m_resolution);
+    return(s[0] >= 0.0 && s[0] <= d->m_nN - 1 && s[1] >= 0.0 && s[1] <= d->m_nE - 1);
+}
+
+//----------
+double SignedDistanceGrid::nodeDistance(int i, int j) const
+{
+    Q_ASSERT(i >= 0 && i < d_ptr->m_nN && j >= 0 && j < d_ptr->m_nE);
+    return(d_ptr->m_value.at(i * d_ptr->m_nE + j));
+}
+
+//----------
+double SignedDistanceGrid::distance(const Vec2& posNE) const
+{
+    const SignedDistanceGridPrivate* d = d_ptr.constData();
+    if(d->m_value.isEmpty()){
+        return(d->m_distanceMax);
+    }
+
+    int i, j;
+    double tN, tE;
+    d->locate(posNE, i, j, tN, tE);
+    const float* p00 = d->m_value.constData() + i * d->m_nE + j;
+    const float* p10 = d->m_nN > 1? p00 + d->m_nE : p00;
+    int dj = d->m_nE > 1? 1 : 0;
+    double f0 = p00[0] + tE * (p00[dj] - p00[0]);
+    double f1 = p10[0] + tE * (p10[dj] - p10[0]);
+    return(f0 + tN * (f1 - f0));
+}
+
+//----------
+double SignedDistanceGrid::distance(const Vec2& posNE, Vec2& gradient) const
+{
+    const SignedDistanceGridPrivate* d = d_ptr.constData();
+    gradient = Vec2();
+    if(d->m_value.isEmpty()){
+        return(d->m_distanceMax);
+    }
+
+    int i, j;
+    double tN, tE;
+    d->locate(posNE, i, j, tN, tE);
+    const float* p00 = d->m_value.constData() + i * d->m_nE + j;
+    const float* p10 = d->m_nN > 1? p00 + d->m_nE : p00;
+    int dj = d->m_nE > 1? 1 : 0;
+    double f0 = p00[0] + tE * (p00[dj] - p00[0]);
+    double f1 = p10[0] + tE * (p10[dj] - p10[0]);
+    double gE = (1.0 - tN) * (p00[dj] - p00[0]) + tN * (p10[dj] - p10[0]);
+    gradient = Vec2(f1 - f0, gE) * (1.0 / d->m_resolution);
+    return(f0 + tN * (f1 - f0));
+}
+
+
+RRTPLANNER_FRAMEWORK_ALGORITHM_GJK_END_NAMESPACE
@@ -1,39 +1,13 @@
 #include <RrtPlannerLib/framework/algorithm/gjk/internal/GjkBasic.h>
-#include <RrtPlannerLib/framework/algorithm/gjk/GjkDefines.h>
-#include <RrtPlannerLib/framework/algorithm/gjk/internal/GjkComponentFactory.h>
-#include <RrtPlannerLib/framework/algorithm/gjk/internal/GjkComponentFactoryCreator.h>
-#include <RrtPlannerLib/framework/algorithm/gjk/internal/Simplex.h>
-#include <RrtPlannerLib/framework/algorithm/gjk/internal/Support.h>
-#include <RrtPlannerLib/framework/VectorF.h>
-#include <RrtPlannerLib/framework/VectorFHelper.h>
-#include <QDebug>
-#include <QScopedPointer>
+#include <RrtPlannerLib/framework/algorithm/gjk/GjkKernel.h>
 
 RRTPLANNER_FRAMEWORK_ALGORITHM_GJK_BEGIN_NAMESPACE
 
-class GjkBasicPrivate
-{
-public:
-    GjkBasicPrivate() = default;
-    GjkBasicPrivate(const GjkBasicPrivate& other) = delete;
-    ~GjkBasicPrivate() = default;
-
-public:
-    QScopedPointer<Simplex> mp_simplex;
-    QScopedPointer<Support> mp_support;
-
-};
-
-//####################
-
 //----------
 GjkBasic::GjkBasic()
-    :Gjk(),
-      d_ptr(new GjkBasicPrivate)
+    :Gjk()
 {
-    QScopedPointer<GjkComponentFactory> gjkFactory(GjkComponentFactoryCreator::getGjkComponentFactory(GjkComponentFactoryCreator::GjkType::Basic));
-    d_ptr->mp_simplex.reset(gjkFactory->getSimplex(eps_square()));
-    d_ptr->mp_support.reset(gjkFactory->getSupport(eps_square()));
+
 }
 
 //----------
@@ -48,44 +22,10 @@ bool GjkBasic::chkIntersect(const IShape& shape1, const IShape& shape2,
                        bool& isValidDistance //to indicate whether distance if valid. Note, if input shape intersect, this param shd return false as we do not calculate the distance for intersecting shapes.
                        )
 {
-
-    bool isIntersect = false;
-
-    //initialize
+    //same iterations as the templated kernel, through the virtual IShape::support()
     distance = 0.0;
     isValidDistance = false;
-    d_ptr->mp_simplex->reset();
-    d_ptr->mp_support->reset();
-    VectorF searchDir = VectorFHelper::subtract_vector(shape2.centroid(), shape1.centroid()); //arbitrary search dir
-    VectorF spp0;
-    Support::ResultFlag result_flag = d_ptr->mp_support->support(&shape1, &shape2, searchDir, false, spp0);
-
-    isIntersect = result_flag == Support::ResultFlag::SUPPORT_ON_ORIGIN;
-    if(result_flag == Support::ResultFlag::SUPPORT_BEYOND_ORIGIN){
-        isIntersect = d_ptr->mp_simplex->update(spp0, searchDir);  //will call handle0D(v) in Simplex class. return searchDir as Origin - vertex[0]. bool return is ignored here.
-        Q_ASSERT(!isIntersect);
-        //iteration
-        int k = 0;
-        while(k++ < max_iteration()){
-            VectorF spp;
-            Support::ResultFlag result_flag = d_ptr->mp_support->support(&shape1, &shape2, searchDir, true, spp);
-            isIntersect = result_flag == Support::ResultFlag::SUPPORT_ON_ORIGIN;
-            if(isIntersect || result_flag == Support::ResultFlag::SUPPORT_SHORT_OF_ORIGIN) {
-                break;
-            }
-
-            isIntersect =  d_ptr->mp_simplex->update(spp, searchDir); //note searchDir is updated with the next search direction to use
-            if(isIntersect){
-                break;
-            }
-        }
-
-        //throws warning if max iteration was reached
-        if(k > max_iteration() - 1){
-            qWarning() << "[Gjk::chkIntersect] Maximum iteration reached while searching for origin in simplex. Results may not be accurate!";
-        }
-    } //if(result_flag == 1)
-    return(isIntersect);
+    return(intersect(shape1, shape2, eps_square(), max_iteration()));
 }
 
 RRTPLANNER_FRAMEWORK_ALGORITHM_GJK_END_NAMESPACE
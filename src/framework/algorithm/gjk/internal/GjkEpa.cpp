@@ -0,0 +1,31 @@
+#include <RrtPlannerLib/framework/algorithm/gjk/internal/GjkEpa.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/GjkKernel.h>
+
+RRTPLANNER_FRAMEWORK_ALGORITHM_GJK_BEGIN_NAMESPACE
+
+//----------
+GjkEpa::GjkEpa()
+    :Gjk()
+{
+
+}
+
+//----------
+GjkEpa::~GjkEpa()
+{
+
+}
+
+//----------
+bool GjkEpa::chkIntersect(const IShape& shape1, const IShape& shape2, double& distance, bool& isValidDistance)
+{
+    return(intersectMinDist(shape1, shape2, distance, isValidDistance, eps_square(), max_iteration()));
+}
+
+//----------
+bool GjkEpa::chkContact(const IShape& shape1, const IShape& shape2, GjkContact& contact)
+{
+    return(intersectContact(shape1, shape2, contact, eps_square(), max_iteration()));
+}
+
+RRTPLANNER_FRAMEWORK_ALGORITHM_GJK_END_NAMESPACE
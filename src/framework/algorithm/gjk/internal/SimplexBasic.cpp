@@ -1,54 +1,52 @@
 #include <RrtPlannerLib/framework/algorithm/gjk/internal/SimplexBasic.h>
-#include <RrtPlannerLib/framework/VectorFHelper.h>
 #include <QVector>
 
 
 RRTPLANNER_FRAMEWORK_ALGORITHM_GJK_BEGIN_NAMESPACE
 
 //function aliases for readability here
-static const auto& dot = VectorFHelper::dot_product;
-static const auto& subtract_vector = VectorFHelper::subtract_vector;
-static const auto& multiply = VectorFHelper::multiply_value;
-static const auto& cross_product_zVal = VectorFHelper::cross_product_zVal;
+static constexpr double dot(const Vec2& a, const Vec2& b) { return(a.dot(b)); }
 
 class SimplexBasicPrivate
 {
 public:
     SimplexBasicPrivate(Simplex* parent)
         :mp_parent(parent)
-    {}
+    {
+        m_vertexList.reserve(3); //2d simplex has at most 3 vertices. Avoids reallocation in update().
+    }
     SimplexBasicPrivate(const SimplexBasicPrivate& other) = delete; //non-copyable
     ~SimplexBasicPrivate() = default;
 
-    bool handle2D(VectorF& v);
-    bool handle1D(VectorF& v);
-    bool handle0D(VectorF& v);
+    bool handle2D(Vec2& v);
+    bool handle1D(Vec2& v);
+    bool handle0D(Vec2& v);
 
 public:
     Simplex* mp_parent{};
-    QVector<VectorF> m_vertexList;
+    QVector<Vec2> m_vertexList;
 };
 
 //----------
-bool SimplexBasicPrivate::handle2D(VectorF& v)
+bool SimplexBasicPrivate::handle2D(Vec2& v)
 {
     bool originInSimplex{false}; //for returning
-    v = VectorF{0.0, 0.0}; //init for returning
+    v = Vec2{0.0, 0.0}; //init for returning
 
-    //search direction
-    const VectorF& c  = m_vertexList.at(0);
-    const VectorF& b  = m_vertexList.at(1);
-    const VectorF& a  = m_vertexList.at(2);
-    VectorF ab = subtract_vector(b, a);
-    VectorF ac = subtract_vector(c, a);
-    VectorF ao = multiply(a, -1.0);
+    //search direction. Copies as vertices are popped below.
+    const Vec2 c  = m_vertexList.at(0);
+    const Vec2 b  = m_vertexList.at(1);
+    const Vec2 a  = m_vertexList.at(2);
+    Vec2 ab = b - a;
+    Vec2 ac = c - a;
+    Vec2 ao = -a;
 
     //qInfo() << "a: " << a << ", b: " << b << ", c: " << c;
     //qInfo() << "ab: " << ab << ", ac: " << ac << ", ao: " << ao;
 
     double zVal = ab.at(0)*ac.at(1) - ab.at(1)*ac.at(0); //z-value of ab cross ac
-    VectorF ac_perp = multiply(VectorF{-ac.at(1), ac.at(0)}, zVal);
-    VectorF ab_perp = multiply(VectorF{ab.at(1), -ab.at(0)}, zVal);
+    Vec2 ac_perp = Vec2{-ac.at(1), ac.at(0)} * zVal;
+    Vec2 ab_perp = Vec2{ab.at(1), -ab.at(0)} * zVal;
 
     //qInfo() << "zVal: " << zVal;
     //qInfo() << "ac_perp: " << ac_perp << ", ab_perp: " << ab_perp;
@@ -93,10 +91,6 @@ bool SimplexBasicPrivate::handle2D(VectorF& v)
         }
         else { //neither in RAC nor RAB
             //Update simplex
-            VectorF cb = subtract_vector(b, c);
-            VectorF ba = subtract_vector(a, b);
-            VectorF bo = multiply(b, -1.0);
-
             m_vertexList[0]  = c;
             m_vertexList[1]  = b;
             m_vertexList[2]  = a;
@@ -108,17 +102,17 @@ bool SimplexBasicPrivate::handle2D(VectorF& v)
 }
 
 //----------
-bool SimplexBasicPrivate::handle1D(VectorF& v)
+bool SimplexBasicPrivate::handle1D(Vec2& v)
 {
-    const VectorF& b = m_vertexList.at(0);
-    const VectorF& a = m_vertexList.at(1);
+    const Vec2& b = m_vertexList.at(0);
+    const Vec2& a = m_vertexList.at(1);
 
-    VectorF ab = subtract_vector(b, a);
-    VectorF ao =  multiply(a, -1.0);
+    Vec2 ab = b - a;
+    Vec2 ao = -a;
 
     //Update search direction
     double scalar = ao.at(0)*ab.at(1) - ao.at(1)*ab.at(0);
-    v = multiply(VectorF{ab.at(1), -ab.at(0)}, scalar);
+    v = Vec2{ab.at(1), -ab.at(0)} * scalar;
 
     //check origin on line AB
     double ao_dot_v = dot(ao, v);
@@ -128,9 +122,9 @@ bool SimplexBasicPrivate::handle1D(VectorF& v)
 }
 
 //----------
-bool SimplexBasicPrivate::handle0D(VectorF& v)
+bool SimplexBasicPrivate::handle0D(Vec2& v)
 {
-    v = multiply(m_vertexList.at(0), -1.0);
+    v = -m_vertexList.at(0);
     return(false);
 }
 
@@ -163,7 +157,7 @@ void SimplexBasic::reset()
 }
 
 //----------
-bool SimplexBasic::update(const VectorF& vertex, VectorF& v)
+bool SimplexBasic::update(const Vec2& vertex, Vec2& v)
 {
     bool isOriginInSimplex{false};
     d_ptr->m_vertexList.append(vertex);
@@ -1,57 +1,55 @@
 #include <RrtPlannerLib/framework/algorithm/gjk/internal/SimplexMinDist.h>
-#include <RrtPlannerLib/framework/VectorFHelper.h>
 #include <RrtPlannerLib/framework/FrameworkDefines.h>
 #include <QVector>
 
 RRTPLANNER_FRAMEWORK_ALGORITHM_GJK_BEGIN_NAMESPACE
 
 //function aliases for readability here
-static const auto& dot = VectorFHelper::dot_product;
-static const auto& subtract_vector = VectorFHelper::subtract_vector;
-static const auto& multiply = VectorFHelper::multiply_value;
-static const auto& cross_product_zVal = VectorFHelper::cross_product_zVal;
+static constexpr double dot(const Vec2& a, const Vec2& b) { return(a.dot(b)); }
+static constexpr double cross_product_zVal(const Vec2& a, const Vec2& b) { return(a.cross_zVal(b)); }
 
 class SimplexMinDistPrivate
 {
 public:
     SimplexMinDistPrivate(Simplex* parent)
         :mp_parent(parent)
-    {}
+    {
+        m_vertexList.reserve(3); //2d simplex has at most 3 vertices. Avoids reallocation in update().
+    }
     SimplexMinDistPrivate(const SimplexMinDistPrivate& other) = delete; //non-copyable
     ~SimplexMinDistPrivate() = default;
 
-    bool handle2D(VectorF& v);
-    bool handle1D(VectorF& v);
-    bool handle0D(VectorF& v);
+    bool handle2D(Vec2& v);
+    bool handle1D(Vec2& v);
+    bool handle0D(Vec2& v);
 
 public:
     Simplex* mp_parent{};
-    QVector<VectorF> m_vertexList;
+    QVector<Vec2> m_vertexList;
 };
 
 //----------
-bool SimplexMinDistPrivate::handle2D(VectorF& v)
+bool SimplexMinDistPrivate::handle2D(Vec2& v)
 {
     bool originInSimplex{false}; //for returning
-    v.resize(m_vertexList.at(0).size(), false); //init for returning
 
     //search direction
-    VectorF oc  = m_vertexList.at(0);
-    VectorF ob  = m_vertexList.at(1);
-    VectorF oa  = m_vertexList.at(2);
-    VectorF ab = subtract_vector(ob, oa);
-    VectorF ca = subtract_vector(oa, oc);
-    VectorF ao = multiply(oa, -1.0);
+    Vec2 oc  = m_vertexList.at(0);
+    Vec2 ob  = m_vertexList.at(1);
+    Vec2 oa  = m_vertexList.at(2);
+    Vec2 ab = ob - oa;
+    Vec2 ca = oa - oc;
+    Vec2 ao = -oa;
 
     double z_val = cross_product_zVal(ca, ab); //z value of ca x ab (up-vector)
     double sign_z = z_val < 0.0 ? -1.0 : 1.0;
 
-    VectorF ab_perp = multiply( VectorFHelper::vec2D_cross_z(ab), z_val); //ab x (ca x ab)
-    VectorF ca_perp = multiply( VectorFHelper::vec2D_cross_z(ca), z_val); //ca x (ca x ab)
+    Vec2 ab_perp = ab.cross_z() * z_val; //ab x (ca x ab)
+    Vec2 ca_perp = ca.cross_z() * z_val; //ca x (ca x ab)
 
     double up_ca = dot(oa, ca); //u'_ca
-    double vp_ca = dot(multiply(oc, -1.0), ca); //v'_ca (used for assert only)
-    double up_ab = dot(ob, ab); //u'_ab (used for assert only)
+    double vp_ca = dot(-oc, ca); //v'_ca
+    double up_ab = dot(ob, ab); //u'_ab
     double vp_ab = dot(ao, ab); //v'_ca
 
     double wp_ab = cross_product_zVal(oa, ob) * sign_z; //z value of oa X ob
@@ -59,7 +57,7 @@ bool SimplexMinDistPrivate::handle2D(VectorF& v)
     double wp_bc = cross_product_zVal(ob, oc) * sign_z; //z value of ob X oc (used for assert only)
 
     //function lambdas
-    auto dot_square = [](VectorF a, VectorF b) {
+    auto dot_square = [](const Vec2& a, const Vec2& b) {
         auto val = dot(a, b);
         return(val*val);
     };
@@ -74,7 +72,7 @@ bool SimplexMinDistPrivate::handle2D(VectorF& v)
         m_vertexList.pop_front(); //pop c
         m_vertexList.pop_front(); //pop b
     }
-    else if (dot_square(ao, ab_perp) < mp_parent->eps_square() * dot(ab_perp, ab_perp)) {//Case 2A: Origin on line AB
+    else if (vp_ab > 0 && up_ab > 0 && dot_square(ao, ab_perp) < mp_parent->eps_square() * dot(ab_perp, ab_perp)) {//Case 2A: Origin on segment AB
         originInSimplex = true;
     }
     else if (wp_ab < 0 && vp_ab > 0) {//Case 2B: Origin in RAB exclude line AB
@@ -82,12 +80,12 @@ bool SimplexMinDistPrivate::handle2D(VectorF& v)
 
         double ab_dot_ab = dot(ab, ab);
         Q_ASSERT(ab_dot_ab > TOL_SMALL);
-        v = subtract_vector(ao, multiply(ab, vp_ab/ab_dot_ab));
+        v = ao - ab * (vp_ab/ab_dot_ab);
 
         //Remove c
         m_vertexList.pop_front();
     }
-    else if (dot_square(oa, ca_perp) < mp_parent->eps_square() * dot(ca_perp, ca_perp)) {//Case 3A: Origin on line CA
+    else if (up_ca > 0 && vp_ca > 0 && dot_square(oa, ca_perp) < mp_parent->eps_square() * dot(ca_perp, ca_perp)) {//Case 3A: Origin on segment CA
         originInSimplex = true;
     }
     else if (wp_ca < 0 && up_ca > 0) {//Case 3B: Origin in RCA exclude line CA
@@ -95,7 +93,7 @@ bool SimplexMinDistPrivate::handle2D(VectorF& v)
 
         double ca_dot_ca = dot(ca, ca);
         Q_ASSERT(ca_dot_ca > TOL_SMALL);
-        v = subtract_vector(multiply(ca, up_ca/ca_dot_ca), oa);
+        v = ca * (up_ca/ca_dot_ca) - oa;
 
         //Remove b
         m_vertexList.remove(1);
@@ -110,15 +108,15 @@ bool SimplexMinDistPrivate::handle2D(VectorF& v)
 }
 
 //----------
-bool SimplexMinDistPrivate::handle1D(VectorF& v)
+bool SimplexMinDistPrivate::handle1D(Vec2& v)
 {
     bool originInSimplex{false};
 
-    const VectorF& b = m_vertexList.at(0);
-    const VectorF& a = m_vertexList.at(1);
+    const Vec2 b = m_vertexList.at(0);
+    const Vec2 a = m_vertexList.at(1);
 
-    VectorF ab = subtract_vector(b, a);
-    VectorF ao =  multiply(a, -1.0);
+    Vec2 ab = b - a;
+    Vec2 ao = -a;
     double ao_dot_ab = dot(ao, ab);
 
     if(ao_dot_ab <= 0.0) { //case 1: Origin in RA
@@ -128,7 +126,7 @@ bool SimplexMinDistPrivate::handle1D(VectorF& v)
     else{ //case 2: Origin in RAB
         double ab_dot_ab = dot(ab, ab);
         double s = ao_dot_ab/ab_dot_ab;
-        v = subtract_vector(ao, multiply(ab, s));
+        v = ao - ab * s;
 
         //check origin on line AB
         double v_dot_v = dot(v, v);
@@ -138,9 +136,9 @@ bool SimplexMinDistPrivate::handle1D(VectorF& v)
 }
 
 //----------
-bool SimplexMinDistPrivate::handle0D(VectorF& v)
+bool SimplexMinDistPrivate::handle0D(Vec2& v)
 {
-    v = multiply(m_vertexList.at(0), -1.0);
+    v = -m_vertexList.at(0);
     return(false);
 }
 
@@ -173,7 +171,7 @@ void SimplexMinDist::reset()
 }
 
 //----------
-bool SimplexMinDist::update(const VectorF& vertex, VectorF& v)
+bool SimplexMinDist::update(const Vec2& vertex, Vec2& v)
 {
     bool isOriginInSimplex{false};
     d_ptr->m_vertexList.append(vertex);
@@ -0,0 +1,85 @@
+#include <RrtPlannerLib/framework/algorithm/gjk/internal/SupportLanes.h>
+#include <cfloat>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+//no inline code shared with the rest of the library here, see SupportLanes.h
+namespace rrtplanner::framework::algorithm::gjk{
+
+namespace {
+    const int LANES = GJK_BATCH_LANES;
+}
+
+//----------
+void supportLanes(const double* x, const double* y, int n, const double* dx, const double* dy, double* sx, double* sy)
+{
+#if defined(__AVX2__)
+    static_assert(GJK_BATCH_LANES == 4, "AVX2 support step expects 4 lanes of doubles.");
+    __m256d dirX = _mm256_loadu_pd(dx);
+    __m256d dirY = _mm256_loadu_pd(dy);
+    __m256d best = _mm256_set1_pd(-DBL_MAX);
+    __m256d bestX = _mm256_setzero_pd();
+    __m256d bestY = _mm256_setzero_pd();
+    for(int j = 0; j < n; ++j){
+        __m256d vx = _mm256_loadu_pd(x + j*LANES);
+        __m256d vy = _mm256_loadu_pd(y + j*LANES);
+        __m256d val = _mm256_add_pd(_mm256_mul_pd(vx, dirX), _mm256_mul_pd(vy, dirY));
+        __m256d isGreater = _mm256_cmp_pd(val, best, _CMP_GT_OQ);
+        best = _mm256_blendv_pd(best, val, isGreater);
+        bestX = _mm256_blendv_pd(bestX, vx, isGreater);
+        bestY = _mm256_blendv_pd(bestY, vy, isGreater);
+    }
+    _mm256_storeu_pd(sx, bestX);
+    _mm256_storeu_pd(sy, bestY);
+#elif defined(__SSE2__)
+    //baseline of x86-64: two registers of two doubles, blend by and/andnot/or
+    static_assert(GJK_BATCH_LANES % 2 == 0, "SSE2 support step expects pairs of lanes.");
+    for(int h = 0; h < LANES; h += 2){
+        __m128d dirX = _mm_loadu_pd(dx + h);
+        __m128d dirY = _mm_loadu_pd(dy + h);
+        __m128d best = _mm_set1_pd(-DBL_MAX);
+        __m128d bestX = _mm_setzero_pd();
+        __m128d bestY = _mm_setzero_pd();
+        for(int j = 0; j < n; ++j){
+            __m128d vx = _mm_loadu_pd(x + j*LANES + h);
+            __m128d vy = _mm_loadu_pd(y + j*LANES + h);
+            __m128d val = _mm_add_pd(_mm_mul_pd(vx, dirX), _mm_mul_pd(vy, dirY));
+            __m128d isGreater = _mm_cmpgt_pd(val, best);
+            best = _mm_or_pd(_mm_and_pd(isGreater, val), _mm_andnot_pd(isGreater, best));
+            bestX = _mm_or_pd(_mm_and_pd(isGreater, vx), _mm_andnot_pd(isGreater, bestX));
+            bestY = _mm_or_pd(_mm_and_pd(isGreater, vy), _mm_andnot_pd(isGreater, bestY));
+        }
+        _mm_storeu_pd(sx + h, bestX);
+        _mm_storeu_pd(sy + h, bestY);
+    }
+#else
+    for(int l = 0; l < LANES; ++l){
+        double best = -DBL_MAX;
+        int jBest = 0;
+        for(int j = 0; j < n; ++j){
+            double val = x[j*LANES + l]*dx[l] + y[j*LANES + l]*dy[l];
+            if(val > best){
+                best = val;
+                jBest = j;
+            }
+        }
+        sx[l] = x[jBest*LANES + l];
+        sy[l] = y[jBest*LANES + l];
+    }
+#endif
+}
+
+//----------
+bool isSupportLanesAvx2()
+{
+#if defined(__AVX2__)
+    return(true);
+#else
+    return(false);
+#endif
+}
+
+};
@@ -0,0 +1,332 @@
+#include <RrtPlannerLib/framework/algorithm/rrt/ParallelRrt.h>
+#include <QSharedData>
+#include <QElapsedTimer>
+#include <QThread>
+#include <QVector>
+#include <QList>
+#include <QtGlobal>
+#include <algorithm>
+#include <random>
+
+RRTPLANNER_FRAMEWORK_ALGORITHM_RRT_BEGIN_NAMESPACE
+
+class ParallelRrtPrivate: public QSharedData
+{
+public:
+    ParallelRrtPrivate() = default;
+    ParallelRrtPrivate(const ParallelRrtPrivate& other) = default;
+    ~ParallelRrtPrivate() = default;
+
+public:
+    RrtStar m_prototype;        //problem and tuning of every tree, seeded by treeSeed()
+    quint32 m_seed{1};
+    int m_nThread{};
+
+    //solve() state
+    QVector<RrtStar> m_treeList;
+    int m_bestTree{-1};
+    double m_elapsed_ms{};
+};
+
+//----------
+ParallelRrt::ParallelRrt()
+    :d_ptr(new ParallelRrtPrivate)
+{
+
+}
+
+//----------
+ParallelRrt::ParallelRrt(const ParallelRrt& other)
+    :d_ptr(other.d_ptr)
+{
+
+}
+
+//----------
+ParallelRrt& ParallelRrt::operator=(const ParallelRrt& other)
+{
+    if(this != &other){
+        this->d_ptr = other.d_ptr;
+    }
+    return(*this);
+}
+
+//----------
+ParallelRrt::~ParallelRrt()
+{
+
+}
+
+//----------
+void ParallelRrt::setSMap(const SMap& sMap)
+{
+    d_ptr->m_prototype.setSMap(sMap);
+}
+
+//----------
+void ParallelRrt::setVessel(const Vessel& vessel)
+{
+    d_ptr->m_prototype.setVessel(vessel);
+}
+
+//----------
+void ParallelRrt::setObstacleSet(const gjk::ObstacleSet& obstacleSet)
+{
+    d_ptr->m_prototype.setObstacleSet(obstacleSet);
+}
+
+//----------
+void ParallelRrt::setGoal(const Vec2& posNE, double radius)
+{
+    d_ptr->m_prototype.setGoal(posNE, radius);
+}
+
+//----------
+void ParallelRrt::clearGoal()
+{
+    d_ptr->m_prototype.clearGoal();
+}
+
+//----------
+void ParallelRrt::setMaxIteration(int maxIteration)
+{
+    d_ptr->m_prototype.setMaxIteration(maxIteration);
+}
+
+//----------
+int ParallelRrt::maxIteration() const
+{
+    return(d_ptr->m_prototype.maxIteration());
+}
+
+//----------
+void ParallelRrt::setTimeBudget_ms(qint64 timeBudget_ms)
+{
+    d_ptr->m_prototype.setTimeBudget_ms(timeBudget_ms);
+}
+
+//----------
+qint64 ParallelRrt::timeBudget_ms() const
+{
+    return(d_ptr->m_prototype.timeBudget_ms());
+}
+
+//----------
+void ParallelRrt::setStepMax(double stepMax)
+{
+    d_ptr->m_prototype.setStepMax(stepMax);
+}
+
+//----------
+double ParallelRrt::stepMax() const
+{
+    return(d_ptr->m_prototype.stepMax());
+}
+
+//----------
+void ParallelRrt::setGoalBias(double goalBias)
+{
+    d_ptr->m_prototype.setGoalBias(goalBias);
+}
+
+//----------
+double ParallelRrt::goalBias() const
+{
+    return(d_ptr->m_prototype.goalBias());
+}
+
+//----------
+void ParallelRrt::setClearance(double clearance)
+{
+    d_ptr->m_prototype.setClearance(clearance);
+}
+
+//----------
+double ParallelRrt::clearance() const
+{
+    return(d_ptr->m_prototype.clearance());
+}
+
+//----------
+void ParallelRrt::setSeed(quint32 seed)
+{
+    d_ptr->m_seed = seed;
+}
+
+//----------
+quint32 ParallelRrt::seed() const
+{
+    return(d_ptr->m_seed);
+}
+
+//----------
+void ParallelRrt::setInformed(bool informed)
+{
+    d_ptr->m_prototype.setInformed(informed);
+}
+
+//----------
+bool ParallelRrt::isInformed() const
+{
+    return(d_ptr->m_prototype.isInformed());
+}
+
+//----------
+void ParallelRrt::setThreadCount(int nThread)
+{
+    d_ptr->m_nThread = std::max(nThread, 0);
+}
+
+//----------
+int ParallelRrt::threadCount() const
+{
+    return(d_ptr->m_nThread);
+}
+
+//----------
+quint32 ParallelRrt::treeSeed(quint32 seed, int idx)
+{
+    //seed_seq is fully specified by the standard, so the seeds are the same on every platform
+    std::seed_seq seq{seed, static_cast<quint32>(idx)};
+    quint32 ret;
+    seq.generate(&ret, &ret + 1);
+    return(ret);
+}
+
+//----------
+bool ParallelRrt::solve(QString* resultsDesc)
+{
+    QElapsedTimer timer;
+    timer.start();
+
+    ParallelRrtPrivate* d = d_ptr.data();
+    int nThread = d->m_nThread > 0? d->m_nThread : QThread::idealThreadCount();
+    nThread = std::max(nThread, 1);
+
+    //the trees are detached from the prototype here, so that the threads share nothing but read-only data
+    d->m_treeList.fill(d->m_prototype, nThread);
+    d->m_bestTree = -1;
+    for(int t = 0; t < nThread; ++t){
+        d->m_treeList[t].setSeed(treeSeed(d->m_seed, t));
+    }
+    RrtStar* treeList = d->m_treeList.data();
+    QVector<QString> descList(nThread);
+    QString* desc = descList.data();
+
+    QList<QThread*> threadList;
+    for(int t = 0; t < nThread; ++t){
+        auto work = [=](){
+            treeList[t].solve(desc + t);
+        };
+        if(t < nThread - 1){
+            threadList.append(QThread::create(work));
+            threadList.last()->start();
+        }
+        else{
+            work();
+        }
+    }
+    for(QThread* thread: threadList){
+        thread->wait();
+    }
+    qDeleteAll(threadList);
+
+    //merge: the cheapest path, the first tree on ties
+    for(int t = 0; t < nThread; ++t){
+        const RrtStar& tree = d->m_treeList.at(t);
+        if(tree.isSolved() && (d->m_bestTree < 0 || tree.cost() < d->m_treeList.at(d->m_bestTree).cost())){
+            d->m_bestTree = t;
+        }
+    }
+    d->m_elapsed_ms = timer.nsecsElapsed() * 1e-6;
+
+    if(resultsDesc){
+        if(nNode() == 0){
+            *resultsDesc = descList.first();    //the trees could not start, e.g. the problem is not set
+        }
+        else{
+            *resultsDesc = QString("[ParallelRrt::solve] %1 trees, %2 iterations, %3 nodes, %4 ms, %5 nodes/s, solved: %6.")
+                    .arg(nThread).arg(nIteration()).arg(nNode()).arg(d->m_elapsed_ms, 0, 'f', 1)
+                    .arg(nodeRate(), 0, 'f', 0).arg(d->m_bestTree >= 0);
+        }
+    }
+    return(d->m_bestTree >= 0);
+}
+
+//----------
+bool ParallelRrt::isSolved() const
+{
+    return(d_ptr->m_bestTree >= 0);
+}
+
+//----------
+double ParallelRrt::cost() const
+{
+    return(d_ptr->m_bestTree >= 0? d_ptr->m_treeList.at(d_ptr->m_bestTree).cost() : -1.0);
+}
+
+//----------
+bool ParallelRrt::path(Plan& plan, QString* resultsDesc) const
+{
+    if(d_ptr->m_bestTree < 0){
+        if(resultsDesc){
+            *resultsDesc = "[ParallelRrt::path] Not solved.";
+        }
+        return(false);
+    }
+    return(d_ptr->m_treeList.at(d_ptr->m_bestTree).path(plan, resultsDesc));
+}
+
+//----------
+int ParallelRrt::nTree() const
+{
+    return(d_ptr->m_treeList.size());
+}
+
+//----------
+const RrtStar& ParallelRrt::tree(int idx) const
+{
+    Q_ASSERT(idx >= 0 && idx < d_ptr->m_treeList.size());
+    return(d_ptr->m_treeList.at(idx));
+}
+
+//----------
+int ParallelRrt::bestTree() const
+{
+    return(d_ptr->m_bestTree);
+}
+
+//----------
+int ParallelRrt::nNode() const
+{
+    int ret = 0;
+    for(const RrtStar& tree: d_ptr->m_treeList){
+        ret += tree.nNode();
+    }
+    return(ret);
+}
+
+//----------
+int ParallelRrt::nIteration() const
+{
+    int ret = 0;
+    for(const RrtStar& tree: d_ptr->m_treeList){
+        ret += tree.nIteration();
+    }
+    return(ret);
+}
+
+//----------
+double ParallelRrt::elapsed_ms() const
+{
+    return(d_ptr->m_elapsed_ms);
+}
+
+//----------
+double ParallelRrt::nodeRate() const
+{
+    return(d_ptr->m_elapsed_ms > 0.0? nNode() / (1e-3 * d_ptr->m_elapsed_ms) : 0.0);
+}
+
+
+RRTPLANNER_FRAMEWORK_ALGORITHM_RRT_END_NAMESPACE
@@ -0,0 +1,665 @@
+#include <RrtPlannerLib/framework/algorithm/rrt/RrtStar.h>
+#include <RrtPlannerLib/framework/algorithm/rrt/KdTree.h>
+#include <RrtPlannerLib/framework/algorithm/rrt/internal/InformedSampling.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/Polygon.h>
+#include <RrtPlannerLib/framework/EllMap.h>
+#include <RrtPlannerLib/framework/RootData.h>
+#include <RrtPlannerLib/framework/SMapSampler.h>
+#include <RrtPlannerLib/framework/VesRectangle.h>
+#include <RrtPlannerLib/framework/FrameworkDefines.h>
+#include <QSharedData>
+#include <QElapsedTimer>
+#include <QVector>
+#include <QtGlobal>
+#include <QDebug>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <math.h> //for M_PI
+
+RRTPLANNER_FRAMEWORK_ALGORITHM_RRT_BEGIN_NAMESPACE
+
+class RrtStarPrivate: public QSharedData
+{
+public:
+    RrtStarPrivate() = default;
+    RrtStarPrivate(const RrtStarPrivate& other) = default;
+    ~RrtStarPrivate() = default;
+
+    /**
+     * @brief Sizes the node pool and the scratch lists to the iteration budget, and empties the tree.
+     */
+    void resetTree();
+
+    /**
+     * @brief Cheapest node of the goal region, -1 if none.
+     */
+    int bestGoalNode() const;
+
+    /**
+     * @brief Writes the footprint vertices at posNE, with heading theta [rad], to vertex.
+     */
+    void placeFootprint(const Vec2& posNE, double theta, Vec2* vertex) const;
+
+    /**
+     * @brief True if the footprint, aligned with the edge from posA to posB, clears the obstacles when swept along it.
+     */
+    bool isEdgeFree(const Vec2& posA, const Vec2& posB);
+
+    /**
+     * @brief True if the footprint clears the obstacles while it turns about the root, from the vessel heading to the
+     * heading of the edge from the root to posB, the shortest way.
+     */
+    bool isRootTurnFree(const Vec2& posB);
+
+    /**
+     * @brief Appends a node to the pool as the last child of parent.
+     */
+    int appendNode(const Vec2& posNE, int parent, double cost, int planIdx, int segIdx);
+
+    /**
+     * @brief Moves node idx under newParent with the given cost, and shifts the cost of its subtree accordingly.
+     */
+    void reparent(int idx, int newParent, double cost);
+
+public:
+    //problem
+    SMap m_sMap;
+    bool m_sMapSet{false};
+    Vec2 m_rootPosNE;
+    double m_rootHdg_deg{};
+    double m_lon0_deg{};
+    bool m_vesselSet{false};
+    QVector<Vec2> m_footprint{Vec2()};  //vessel coordinates (u, v), a point if no VesRectangle
+    double m_footprintRadius{};         //[m] distance of the farthest footprint vertex from the vessel position
+    gjk::ObstacleSet m_obstacleSet;
+    bool m_goalSet{false};
+    Vec2 m_goalPosNE;
+    double m_goalRadius{};
+
+    //budget and tuning
+    int m_maxIteration{RRT_MAX_ITERATION};
+    qint64 m_timeBudget_ms{};
+    double m_stepMax{};
+    double m_goalBias{RRT_GOAL_BIAS};
+    double m_clearance{};
+    quint32 m_seed{1};
+    bool m_informed{false};
+
+    //solve() state
+    double m_stepMaxUsed{};
+    Vec2 m_goalPosNEUsed;
+    double m_goalRadiusUsed{};
+    SMapSampler m_sampler;              //SMap volume distribution, built from m_sMap
+    double m_sampleArea{};              //[m^2] area of the SMap corridor ahead of the root
+    std::mt19937 m_rng;
+    int m_nIteration{};
+    int m_nInformedSample{};
+    int m_nInformedFallback{};
+    int m_goalNode{-1};
+
+    //node pool, m_nNode entries in use
+    int m_nNode{};
+    QVector<Vec2> m_pos;
+    QVector<int> m_parent;
+    QVector<double> m_cost;
+    QVector<int> m_firstChild;
+    QVector<int> m_nextSibling;
+    QVector<int> m_planIdx;             //EllMap sector of the node, warm start of EllMap::locateSector()
+    QVector<int> m_segIdx;
+    KdTree<2> m_kdTree;                 //node positions, same indices as the pool
+
+    //scratch, reserved by resetTree()
+    QVector<int> m_nearList;
+    QVector<double> m_nearDistList;
+    QVector<int> m_stack;
+    QVector<int> m_goalNodeList;
+    QVector<int> m_hitIdxList;
+    gjk::Polygon m_sweep;
+};
+
+//----------
+void RrtStarPrivate::resetTree()
+{
+    int capacity = m_maxIteration + 1;
+    m_pos.resize(capacity);
+    m_parent.resize(capacity);
+    m_cost.resize(capacity);
+    m_firstChild.resize(capacity);
+    m_nextSibling.resize(capacity);
+    m_planIdx.resize(capacity);
+    m_segIdx.resize(capacity);
+    m_kdTree.clear();
+    m_kdTree.reserve(capacity);
+    m_nearList.clear();
+    m_nearList.reserve(capacity);
+    m_nearDistList.clear();
+    m_nearDistList.reserve(capacity);
+    m_stack.clear();
+    m_stack.reserve(capacity);
+    m_goalNodeList.clear();
+    m_goalNodeList.reserve(capacity);
+    m_sweep.vertexList().resize(2 * m_footprint.size());
+    m_nNode = 0;
+    m_nIteration = 0;
+    m_nInformedSample = 0;
+    m_nInformedFallback = 0;
+    m_goalNode = -1;
+}
+
+//----------
+int RrtStarPrivate::bestGoalNode() const
+{
+    int ret = -1;
+    for(int idx: m_goalNodeList){
+        if(ret < 0 || m_cost.at(idx) < m_cost.at(ret)){
+            ret = idx;
+        }
+    }
+    return(ret);
+}
+
+//----------
+void RrtStarPrivate::placeFootprint(const Vec2& posNE, double theta, Vec2* vertex) const
+{
+    double cosTheta = std::cos(theta);
+    double sinTheta = std::sin(theta);
+    for(int k = 0; k < m_footprint.size(); ++k){
+        const Vec2& uv = m_footprint.at(k);
+        vertex[k] = posNE + Vec2(-uv[IDX_U]*cosTheta - uv[IDX_V]*sinTheta, -uv[IDX_U]*sinTheta + uv[IDX_V]*cosTheta);
+    }
+}
+
+//----------
+bool RrtStarPrivate::isEdgeFree(const Vec2& posA, const Vec2& posB)
+{
+    if(m_obstacleSet.size() == 0){
+        return(true);
+    }
+
+    //a convex footprint translated along the edge sweeps the hull of its start and end copies
+    Vec2 edge = posB - posA;
+    double theta = std::atan2(edge[IDX_EASTING], edge[IDX_NORTHING]);
+    Vec2* sweep = m_sweep.vertexList().data();
+    placeFootprint(posA, theta, sweep);
+    placeFootprint(posB, theta, sweep + m_footprint.size());
+    return(m_obstacleSet.chkIntersect(m_sweep, m_hitIdxList, nullptr, m_clearance) == 0);
+}
+
+//----------
+bool RrtStarPrivate::isRootTurnFree(const Vec2& posB)
+{
+    if(m_obstacleSet.size() == 0 || m_footprintRadius <= 0.0){
+        return(true);
+    }
+
+    //the turn is checked as the hulls of consecutive copies RRT_TURN_STEP_DEG apart. The footprint points move on
+    //arcs, which bulge out of these hulls by at most the sagitta, added to the clearance.
+    Vec2 edge = posB - m_rootPosNE;
+    double hdgFrom = m_rootHdg_deg * M_PI / 180.0;
+    double dHdg = std::remainder(std::atan2(edge[IDX_EASTING], edge[IDX_NORTHING]) - hdgFrom, 2.0 * M_PI);
+    int nStep = std::max(static_cast<int>(std::ceil(std::fabs(dHdg) / (RRT_TURN_STEP_DEG * M_PI / 180.0))), 1);
+    double step = dHdg / nStep;
+    double sagitta = m_footprintRadius * (1.0 - std::cos(0.5 * step));
+
+    int n = m_footprint.size();
+    Vec2* sweep = m_sweep.vertexList().data();
+    placeFootprint(m_rootPosNE, hdgFrom, sweep);
+    for(int k = 1; k <= nStep; ++k){
+        placeFootprint(m_rootPosNE, hdgFrom + k * step, sweep + n);
+        if(m_obstacleSet.chkIntersect(m_sweep, m_hitIdxList, nullptr, m_clearance + sagitta) != 0){
+            return(false);
+        }
+        std::copy(sweep + n, sweep + 2 * n, sweep);
+    }
+    return(true);
+}
+
+//----------
+int RrtStarPrivate::appendNode(const Vec2& posNE, int parent, double cost, int planIdx, int segIdx)
+{
+    Q_ASSERT(m_nNode < m_pos.size());
+    int idx = m_nNode++;
+    m_pos[idx] = posNE;
+    m_parent[idx] = parent;
+    m_cost[idx] = cost;
+    m_firstChild[idx] = -1;
+    m_nextSibling[idx] = -1;
+    m_planIdx[idx] = planIdx;
+    m_segIdx[idx] = segIdx;
+    m_kdTree.insert({posNE[IDX_NORTHING], posNE[IDX_EASTING]});
+    if(parent >= 0){
+        m_nextSibling[idx] = m_firstChild.at(parent);
+        m_firstChild[parent] = idx;
+    }
+    return(idx);
+}
+
+//----------
+void RrtStarPrivate::reparent(int idx, int newParent, double cost)
+{
+    //unlink from the old parent
+    int oldParent = m_parent.at(idx);
+    if(m_firstChild.at(oldParent) == idx){
+        m_firstChild[oldParent] = m_nextSibling.at(idx);
+    }
+    else{
+        int sibling = m_firstChild.at(oldParent);
+        while(m_nextSibling.at(sibling) != idx){
+            sibling = m_nextSibling.at(sibling);
+        }
+        m_nextSibling[sibling] = m_nextSibling.at(idx);
+    }
+
+    m_parent[idx] = newParent;
+    m_nextSibling[idx] = m_firstChild.at(newParent);
+    m_firstChild[newParent] = idx;
+
+    //the whole subtree moves by the same cost change
+    double delta = cost - m_cost.at(idx);
+    m_cost[idx] = cost;
+    m_stack.clear();
+    for(int child = m_firstChild.at(idx); child >= 0; child = m_nextSibling.at(child)){
+        m_stack.append(child);
+    }
+    while(!m_stack.isEmpty()){
+        int node = m_stack.takeLast();
+        m_cost[node] += delta;
+        for(int child = m_firstChild.at(node); child >= 0; child = m_nextSibling.at(child)){
+            m_stack.append(child);
+        }
+    }
+}
+
+//----------
+RrtStar::RrtStar()
+    :d_ptr(new RrtStarPrivate)
+{
+
+}
+
+//----------
+RrtStar::RrtStar(const RrtStar& other)
+    :d_ptr(other.d_ptr)
+{
+
+}
+
+//----------
+RrtStar& RrtStar::operator=(const RrtStar& other)
+{
+    if(this != &other){
+        this->d_ptr = other.d_ptr;
+    }
+    return(*this);
+}
+
+//----------
+RrtStar::~RrtStar()
+{
+
+}
+
+//----------
+void RrtStar::setSMap(const SMap& sMap)
+{
+    d_ptr->m_sMap = sMap;
+    d_ptr->m_sMapSet = true;
+}
+
+//----------
+void RrtStar::setVessel(const Vessel& vessel)
+{
+    RrtStarPrivate* d = d_ptr.data();
+    d->m_rootPosNE = vessel.posNE();
+    d->m_rootHdg_deg = vessel.hdg_deg();
+    d->m_lon0_deg = vessel.lon0_deg();
+    d->m_vesselSet = true;
+
+    d->m_footprint = QVector<Vec2>{Vec2()};
+    d->m_footprintRadius = 0.0;
+    const VesRectangle* p_rectangle = dynamic_cast<const VesRectangle*>(vessel.vesShape().data());
+    if(p_rectangle){
+        const QList<VectorF> polygon = p_rectangle->polygon();
+        d->m_footprint.clear();
+        for(const VectorF& vertex: polygon){
+            d->m_footprint.append(Vec2(vertex.at(IDX_U), vertex.at(IDX_V)));
+            d->m_footprintRadius = std::max(d->m_footprintRadius, d->m_footprint.last().norm2());
+        }
+    }
+}
+
+//----------
+void RrtStar::setObstacleSet(const gjk::ObstacleSet& obstacleSet)
+{
+    d_ptr->m_obstacleSet = obstacleSet;
+}
+
+//----------
+void RrtStar::setGoal(const Vec2& posNE, double radius)
+{
+    Q_ASSERT(radius > 0.0);
+    d_ptr->m_goalPosNE = posNE;
+    d_ptr->m_goalRadius = radius;
+    d_ptr->m_goalSet = true;
+}
+
+//----------
+void RrtStar::clearGoal()
+{
+    d_ptr->m_goalSet = false;
+}
+
+//----------
+void RrtStar::setMaxIteration(int maxIteration)
+{
+    Q_ASSERT(maxIteration >= 0);
+    d_ptr->m_maxIteration = std::max(maxIteration, 0);
+}
+
+//----------
+int RrtStar::maxIteration() const
+{
+    return(d_ptr->m_maxIteration);
+}
+
+//----------
+void RrtStar::setTimeBudget_ms(qint64 timeBudget_ms)
+{
+    d_ptr->m_timeBudget_ms = std::max(timeBudget_ms, qint64(0));
+}
+
+//----------
+qint64 RrtStar::timeBudget_ms() const
+{
+    return(d_ptr->m_timeBudget_ms);
+}
+
+//----------
+void RrtStar::setStepMax(double stepMax)
+{
+    d_ptr->m_stepMax = std::max(stepMax, 0.0);
+}
+
+//----------
+double RrtStar::stepMax() const
+{
+    return(d_ptr->m_stepMax);
+}
+
+//----------
+void RrtStar::setGoalBias(double goalBias)
+{
+    d_ptr->m_goalBias = std::min(std::max(goalBias, 0.0), 1.0);
+}
+
+//----------
+double RrtStar::goalBias() const
+{
+    return(d_ptr->m_goalBias);
+}
+
+//----------
+void RrtStar::setClearance(double clearance)
+{
+    d_ptr->m_clearance = std::max(clearance, 0.0);
+}
+
+//----------
+double RrtStar::clearance() const
+{
+    return(d_ptr->m_clearance);
+}
+
+//----------
+void RrtStar::setSeed(quint32 seed)
+{
+    d_ptr->m_seed = seed;
+}
+
+//----------
+quint32 RrtStar::seed() const
+{
+    return(d_ptr->m_seed);
+}
+
+//----------
+void RrtStar::setInformed(bool informed)
+{
+    d_ptr->m_informed = informed;
+}
+
+//----------
+bool RrtStar::isInformed() const
+{
+    return(d_ptr->m_informed);
+}
+
+//----------
+bool RrtStar::solve(QString* resultsDesc)
+{
+    QElapsedTimer timer;
+    timer.start();
+
+    RrtStarPrivate* d = d_ptr.data();
+    d->resetTree();
+    if(!d->m_sMapSet || !d->m_vesselSet){
+        if(resultsDesc){
+            *resultsDesc = "[RrtStar::solve] The SMap and the vessel need to be set first.";
+        }
+        return(false);
+    }
+    if(!d->m_sampler.build(d->m_sMap)){
+        if(resultsDesc){
+            *resultsDesc = "[RrtStar::solve] The SMap has no volume, it needs to be reset() at the vessel position.";
+        }
+        return(false);
+    }
+    const EllMap& ellMap = d->m_sMap.ellMap();
+    const RootData& rootData = d->m_sMap.rootData();
+
+    d->m_stepMaxUsed = d->m_stepMax > 0.0? d->m_stepMax : RRT_STEP_FRACTION * d->m_sMap.lh0();
+    d->m_goalPosNEUsed = d->m_goalPosNE;
+    d->m_goalRadiusUsed = d->m_goalRadius;
+    if(!d->m_goalSet){
+        const SPlan& sPlanNominal = d->m_sMap.at(d->m_sMap.idxNominal());
+        double dx = sPlanNominal.getCrosstrack();
+        d->m_goalRadiusUsed = 0.5 * d->m_stepMaxUsed;
+        if(!d->m_sampler.posNE(dx, sPlanNominal.getLh(), d->m_goalPosNEUsed)){
+            if(resultsDesc){
+                *resultsDesc = "[RrtStar::solve] The end of the arclength horizon on the nominal plan is out of the EllMap.";
+            }
+            return(false);
+        }
+    }
+
+    //area sampled, for the RRT* radius gamma sqrt(log(n)/n), with gamma above 2 sqrt(1.5 area/pi) in 2d
+    const QList<SPlan>& sPlanList = d->m_sMap.SPlanList_const_ref();
+    double area{};
+    for(int i = 1; i < sPlanList.size(); ++i){
+        area += 0.5 * (sPlanList.at(i - 1).getLh() + sPlanList.at(i).getLh()) * \
+                (sPlanList.at(i).getCrosstrack() - sPlanList.at(i - 1).getCrosstrack());
+    }
+    d->m_sampleArea = area;
+    const double gamma = 2.0 * std::sqrt(1.5 * area / M_PI) * 1.1;
+    const double stepMax = d->m_stepMaxUsed;
+
+    d->appendNode(d->m_rootPosNE, -1, 0.0, rootData.planIdx(), rootData.segIdx());
+    if((d->m_rootPosNE - d->m_goalPosNEUsed).norm2() <= d->m_goalRadiusUsed){
+        d->m_goalNodeList.append(0);
+    }
+
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    d->m_rng.seed(d->m_seed);
+    for(; d->m_nIteration < d->m_maxIteration; ++d->m_nIteration){
+        if(d->m_timeBudget_ms > 0 && timer.elapsed() >= d->m_timeBudget_ms){
+            break;
+        }
+
+        //informed sampling once a path is known, rewiring may have made it cheaper
+        Vec2 sample = d->m_goalPosNEUsed;
+        if(unit(d->m_rng) >= d->m_goalBias){
+            int goalNode = d->m_informed? d->bestGoalNode() : -1;
+            bool isInformed = goalNode >= 0
+                    && sampleInformed(d->m_rootPosNE, d->m_goalPosNEUsed, d->m_goalRadiusUsed, d->m_cost.at(goalNode),
+                                      d->m_sampleArea, ellMap, d->m_planIdx.at(0), d->m_segIdx.at(0), d->m_rng, sample);
+            if(isInformed){
+                ++d->m_nInformedSample;
+            }
+            else{
+                if(goalNode >= 0){
+                    ++d->m_nInformedFallback;
+                }
+                //SMap volume, without rejection. posNE() only fails past the end of an offset plan.
+                SMapSample sMapSample;
+                double u0 = unit(d->m_rng);
+                double u1 = unit(d->m_rng);
+                double u2 = unit(d->m_rng);
+                double u3 = unit(d->m_rng);
+                d->m_sampler.sample(u0, u1, u2, u3, sMapSample);
+                if(!d->m_sampler.posNE(sMapSample.dx, sMapSample.ell, sample)){
+                    continue;
+                }
+            }
+        }
+
+        //nearest node, steered towards the sample
+        double dist;
+        int nearest = d->m_kdTree.nearest({sample[IDX_NORTHING], sample[IDX_EASTING]}, &dist);
+        if(dist < TOL_SMALL){
+            continue;
+        }
+        Vec2 posNew = dist > stepMax? d->m_pos.at(nearest) + (stepMax / dist) * (sample - d->m_pos.at(nearest)) : sample;
+
+        int planIdx, segIdx;
+        if(!ellMap.locateSector(posNew, d->m_planIdx.at(nearest), d->m_segIdx.at(nearest), planIdx, segIdx)){
+            continue;
+        }
+        if(!d->isEdgeFree(d->m_pos.at(nearest), posNew) || (nearest == 0 && !d->isRootTurnFree(posNew))){
+            continue;
+        }
+
+        //cheapest valid parent among the near nodes
+        int n = d->m_nNode + 1;
+        double radius = std::min(stepMax, gamma * std::sqrt(std::log(static_cast<double>(n)) / n));
+        d->m_kdTree.radius({posNew[IDX_NORTHING], posNew[IDX_EASTING]}, radius, d->m_nearList, &d->m_nearDistList);
+        int parent = nearest;
+        double cost = d->m_cost.at(nearest) + (posNew - d->m_pos.at(nearest)).norm2();
+        for(int k = 0; k < d->m_nearList.size(); ++k){
+            int idx = d->m_nearList.at(k);
+            double costTmp = d->m_cost.at(idx) + d->m_nearDistList.at(k);
+            if(costTmp < cost && d->m_nearDistList.at(k) >= TOL_SMALL && d->isEdgeFree(d->m_pos.at(idx), posNew) && \
+               (idx != 0 || d->isRootTurnFree(posNew))){
+                parent = idx;
+                cost = costTmp;
+            }
+        }
+        int idxNew = d->appendNode(posNew, parent, cost, planIdx, segIdx);
+
+        //rewire the near nodes that get cheaper through the new node
+        for(int k = 0; k < d->m_nearList.size(); ++k){
+            int idx = d->m_nearList.at(k);
+            double costTmp = cost + d->m_nearDistList.at(k);
+            if(idx != parent && costTmp < d->m_cost.at(idx) - TOL_SMALL && d->m_nearDistList.at(k) >= TOL_SMALL && \
+               d->isEdgeFree(posNew, d->m_pos.at(idx))){
+                d->reparent(idx, idxNew, costTmp);
+            }
+        }
+        if((posNew - d->m_goalPosNEUsed).norm2() <= d->m_goalRadiusUsed){
+            d->m_goalNodeList.append(idxNew);
+        }
+    }
+
+    //rewiring may have changed the cheapest goal node
+    d->m_goalNode = d->bestGoalNode();
+    if(resultsDesc){
+        *resultsDesc = QString("[RrtStar::solve] %1 iterations, %2 nodes, %3 ms, solved: %4.")
+                .arg(d->m_nIteration).arg(d->m_nNode).arg(timer.elapsed()).arg(d->m_goalNode >= 0);
+    }
+    return(d->m_goalNode >= 0);
+}
+
+//----------
+bool RrtStar::isSolved() const
+{
+    return(d_ptr->m_goalNode >= 0);
+}
+
+//----------
+double RrtStar::cost() const
+{
+    return(d_ptr->m_goalNode >= 0? d_ptr->m_cost.at(d_ptr->m_goalNode) : -1.0);
+}
+
+//----------
+bool RrtStar::path(Plan& plan, QString* resultsDesc) const
+{
+    const RrtStarPrivate* d = d_ptr.constData();
+    if(d->m_goalNode < 0){
+        if(resultsDesc){
+            *resultsDesc = "[RrtStar::path] Not solved.";
+        }
+        return(false);
+    }
+
+    QVector<Waypt> wayptList;
+    for(int idx = d->m_goalNode; idx >= 0; idx = d->m_parent.at(idx)){
+        wayptList.append(Waypt(d->m_pos.at(idx), d->m_lon0_deg));
+    }
+    std::reverse(wayptList.begin(), wayptList.end());
+
+    Plan planTmp;
+    if(!planTmp.setPlan(wayptList, 0, resultsDesc)){
+        return(false);
+    }
+    plan = planTmp;
+    return(true);
+}
+
+//----------
+int RrtStar::nNode() const
+{
+    return(d_ptr->m_nNode);
+}
+
+//----------
+int RrtStar::nIteration() const
+{
+    return(d_ptr->m_nIteration);
+}
+
+//----------
+int RrtStar::nInformedSample() const
+{
+    return(d_ptr->m_nInformedSample);
+}
+
+//----------
+int RrtStar::nInformedFallback() const
+{
+    return(d_ptr->m_nInformedFallback);
+}
+
+//----------
+Vec2 RrtStar::nodePosNE(int idx) const
+{
+    Q_ASSERT(idx >= 0 && idx < d_ptr->m_nNode);
+    return(d_ptr->m_pos.at(idx));
+}
+
+//----------
+int RrtStar::nodeParent(int idx) const
+{
+    Q_ASSERT(idx >= 0 && idx < d_ptr->m_nNode);
+    return(d_ptr->m_parent.at(idx));
+}
+
+//----------
+double RrtStar::nodeCost(int idx) const
+{
+    Q_ASSERT(idx >= 0 && idx < d_ptr->m_nNode);
+    return(d_ptr->m_cost.at(idx));
+}
+
+
+RRTPLANNER_FRAMEWORK_ALGORITHM_RRT_END_NAMESPACE
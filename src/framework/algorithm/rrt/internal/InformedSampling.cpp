@@ -0,0 +1,41 @@
+#include <RrtPlannerLib/framework/algorithm/rrt/internal/InformedSampling.h>
+#include <RrtPlannerLib/framework/algorithm/rrt/RrtDefines.h>
+#include <RrtPlannerLib/framework/FrameworkDefines.h>
+#include <algorithm>
+#include <cmath>
+#include <math.h> //for M_PI
+
+RRTPLANNER_FRAMEWORK_ALGORITHM_RRT_BEGIN_NAMESPACE
+
+//----------
+bool sampleInformed(const Vec2& rootNE, const Vec2& goalNE, double goalRadius, double costBest, double areaMax,
+                    const EllMap& ellMap, int planIdx, int segIdx, std::mt19937& rng, Vec2& posNE)
+{
+    Vec2 axis = goalNE - rootNE;
+    double cMin = axis.norm2();
+    double c = costBest + goalRadius;
+    double a = 0.5 * c;
+    double b = 0.5 * std::sqrt(std::max(c * c - cMin * cMin, 0.0));
+    if(M_PI * a * b >= areaMax){
+        return(false);
+    }
+
+    Vec2 centre = 0.5 * (rootNE + goalNE);
+    Vec2 uVec = cMin > TOL_SMALL? (1.0 / cMin) * axis : Vec2(1.0, 0.0);
+    Vec2 vVec(-uVec[1], uVec[0]);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    for(int attempt = 0; attempt < RRT_SAMPLE_ATTEMPT_MAX; ++attempt){
+        //uniform in the unit disc, stretched to the ellipse, kept if within the EllMap corridor
+        double r = std::sqrt(unit(rng));
+        double theta = 2.0 * M_PI * unit(rng);
+        Vec2 pos = centre + (a * r * std::cos(theta)) * uVec + (b * r * std::sin(theta)) * vVec;
+        int planIdxPos, segIdxPos;
+        if(ellMap.locateSector(pos, planIdx, segIdx, planIdxPos, segIdxPos)){
+            posNE = pos;
+            return(true);
+        }
+    }
+    return(false);
+}
+
+RRTPLANNER_FRAMEWORK_ALGORITHM_RRT_END_NAMESPACE
@@ -1,10 +1,19 @@
 #include "EllMapQTests.h"
+#include "TestScenario.h"
 #include <RrtPlannerLib/framework/FrameworkDefines.h>
+#include <RrtPlannerLib/framework/PlanHelper.h>
 #include <RrtPlannerLib/framework/UtilHelper.h>
 #include <RrtPlannerLib/framework/VectorF.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/GjkFactory.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/Gjk.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/PointShape.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/Polygon.h>
 #include <QtTest/QtTest>
+#include <QScopedPointer>
+#include <QThread>
 #include <QtGlobal>
 #include <QVector>
+#include <cmath>
 
 
 using namespace rrtplanner::framework;
@@ -29,6 +38,35 @@ public:
     }
 };
 
+//reference for locateSector: exhaustive ring search around (planIdx_0, segIdx_0), alternating port/stbd plans,
+//with gjk point in sector polygon tests.
+static bool ringSearch(const EllMap& ellMap, const Vec2& pos, int planIdx_0, int segIdx_0, int& planIdx, int& segIdx)
+{
+    QScopedPointer<algorithm::gjk::Gjk> p_gjk(algorithm::gjk::GjkFactory::getGjk(algorithm::gjk::GjkFactory::GjkType::Basic));
+    int nPlan = ellMap.size();
+    int nSeg = ellMap.at(0).nSegment();
+    algorithm::gjk::PointShape usv(pos);
+    for(int np = 0, side = 1; np < nPlan - 1; ++np){
+        side = -side;
+        planIdx = UtilHelper::mod(planIdx_0 + side*static_cast<int>(ceil(0.5*np)), nPlan-1);
+        for(int ns = 0; ns < nSeg; ++ns){
+            segIdx = UtilHelper::mod(segIdx_0 + ns, nSeg);
+            const Segment& segCurr = ellMap.at(planIdx).segmentList().at(segIdx);
+            const Segment& segRhs = ellMap.at(planIdx+1).segmentList().at(segIdx);
+            algorithm::gjk::Polygon polysec{segCurr.wayptPrev().coord_const_ref(), segCurr.wayptNext().coord_const_ref(),
+                                            segRhs.wayptPrev().coord_const_ref(), segRhs.wayptNext().coord_const_ref()};
+            double distance;
+            bool isValidDistance;
+            if(p_gjk->chkIntersect(usv, polysec, distance, isValidDistance)){
+                return(true);
+            }
+        }
+    }
+    planIdx = -1;
+    segIdx = -1;
+    return(false);
+}
+
 //----------
 EllMapQTests::EllMapQTests()
 {
@@ -173,6 +211,39 @@ void EllMapQTests::verify_buildEllMap()
     } 
 }
 
+//----------
+void EllMapQTests::verify_boundingBox_data()
+{
+    verify_buildEllMap_data();
+}
+
+//----------
+void EllMapQTests::verify_boundingBox()
+{
+    QFETCH(MockPlan, planNominal);
+    QFETCH(double, crossTrackHorizon);
+    QFETCH(QVector<MockPlan>, planList_expect);
+
+    EllMap ellMap;
+    QVERIFY(ellMap.buildEllMap(planNominal, crossTrackHorizon));
+
+    //bounding box spanned by the waypoints of all plans
+    Vec2 minNE, maxNE;
+    QVERIFY(ellMap.boundingBox(minNE, maxNE));
+    Vec2 minNE_expect = planList_expect.first().wayptList().first().coord_const_ref();
+    Vec2 maxNE_expect = minNE_expect;
+    for(const MockPlan& plan: planList_expect){
+        for(const Waypt& waypt: plan.wayptList()){
+            const Vec2& coord = waypt.coord_const_ref();
+            minNE_expect = Vec2(std::min(minNE_expect[0], coord[0]), std::min(minNE_expect[1], coord[1]));
+            maxNE_expect = Vec2(std::max(maxNE_expect[0], coord[0]), std::max(maxNE_expect[1], coord[1]));
+        }
+    }
+    QVERIFY(minNE.compare(minNE_expect, 1e-6));
+    QVERIFY(maxNE.compare(maxNE_expect, 1e-6));
+    QVERIFY(!EllMap().boundingBox(minNE, maxNE));
+}
+
 //----------
 void EllMapQTests::verify_locateSector_data()
 {
@@ -218,6 +289,108 @@ void EllMapQTests::verify_locateSector()
     QCOMPARE(segIdx, segIdx_expect);
 }
 
+//----------
+void EllMapQTests::verify_locateSector_ringSearch_data()
+{
+    QTest::addColumn<Plan>("planNominal");
+    QTest::addColumn<double>("crossTrackHorizon");
+
+    Plan planNominal;
+    planNominal.setPlan(QVector<Waypt>{Waypt{0.0, 0.0, 0.0, 0},
+                                       Waypt{1000.0, 1000.0, 0.0, 1},
+                                       Waypt{2000.0, 1000.0, 0.0, 2},
+                                       Waypt{3000.0, 0.0, 0.0, 3},
+                                       Waypt{4000.0, 0.0, 0.0, 4}},
+                        0);
+    QTest::newRow("Test 1") << planNominal << 2500.0;
+    QTest::newRow("Test 2 (long route)") << TestScenario::longRoute(30) << 1000.0;
+}
+
+//----------
+void EllMapQTests::verify_locateSector_ringSearch()
+{
+    QFETCH(Plan, planNominal);
+    QFETCH(double, crossTrackHorizon);
+
+    EllMap ellMap;
+    QVERIFY(ellMap.buildEllMap(planNominal, crossTrackHorizon));
+    int nPlan = ellMap.size();
+    int nSeg = ellMap.at(0).nSegment();
+
+    //probes: plan nodes (on sector boundaries) and points in between
+    QVector<Vec2> probeList;
+    for(int i = 0; i < nPlan; i += 3){
+        for(const Segment& seg: ellMap.at(i).segmentList()){
+            probeList.append(seg.wayptPrev().coord_const_ref());
+            probeList.append(seg.wayptPrev().coord_const_ref() + 0.37 * seg.length() * seg.tVec() + 7.0 * seg.nVec());
+        }
+    }
+    probeList.append(Vec2(-1e6, -1e6)); //outside
+
+    for(const Vec2& pos: probeList){
+        for(int planIdx_0: {0, nPlan/2, nPlan - 2}){
+            for(int segIdx_0: {0, nSeg/2}){
+                int planIdx_expect, segIdx_expect;
+                bool found_expect = ringSearch(ellMap, pos, planIdx_0, segIdx_0, planIdx_expect, segIdx_expect);
+                int planIdx, segIdx;
+                bool found = ellMap.locateSector(VectorF(pos), planIdx_0, segIdx_0, planIdx, segIdx);
+                QCOMPARE(found, found_expect);
+                if(found){
+                    QCOMPARE(planIdx, planIdx_expect);
+                    QCOMPARE(segIdx, segIdx_expect);
+                }
+            }
+        }
+    }
+}
+
+//----------
+void EllMapQTests::verify_locateSector_warmStart_data()
+{
+    QTest::addColumn<Plan>("planNominal");
+    QTest::addColumn<double>("crossTrackHorizon");
+    QTest::addColumn<double>("crossTrack");
+
+    QTest::newRow("Test 1 (on nominal plan)") << TestScenario::longRoute(30) << 1000.0 << 0.0;
+    QTest::newRow("Test 2 (port)") << TestScenario::longRoute(30) << 1000.0 << -123.4;
+    QTest::newRow("Test 3 (stbd, outer plans)") << TestScenario::longRoute(30) << 1000.0 << 617.3;
+}
+
+//----------
+void EllMapQTests::verify_locateSector_warmStart()
+{
+    //usv track sampled along the nominal plan, each tick starting from the sector of the previous tick.
+    //the walk from the previous sector has to return the same sector as the ring search.
+    QFETCH(Plan, planNominal);
+    QFETCH(double, crossTrackHorizon);
+    QFETCH(double, crossTrack);
+
+    EllMap ellMap;
+    QVERIFY(ellMap.buildEllMap(planNominal, crossTrackHorizon));
+
+    int planIdx_prev = -1;
+    int segIdx_prev = -1;
+    int nFound = 0;
+    for(const Segment& seg: planNominal.segmentList()){
+        for(double s = 0.5; s < seg.length(); s += 7.3){
+            VectorF posNE(seg.wayptPrev().coord_const_ref() + s * seg.tVec() + crossTrack * seg.nVec());
+            int planIdx, segIdx;
+            bool found = ellMap.locateSector(posNE, planIdx_prev, segIdx_prev, planIdx, segIdx);
+            int planIdx_expect, segIdx_expect;
+            bool found_expect = ringSearch(ellMap, posNE, planIdx_prev, segIdx_prev, planIdx_expect, segIdx_expect);
+            QCOMPARE(found, found_expect);
+            QCOMPARE(planIdx, planIdx_expect);
+            QCOMPARE(segIdx, segIdx_expect);
+            if(found){
+                planIdx_prev = planIdx;
+                segIdx_prev = segIdx;
+                ++nFound;
+            }
+        }
+    }
+    QVERIFY(nFound > 0);
+}
+
 //----------
 void EllMapQTests::verify_getRootData_data()
 {
@@ -300,3 +473,311 @@ void EllMapQTests::verify_getRootData()
     }
 }
 
+//----------
+void EllMapQTests::verify_getRootData_crossTrackPlan_data()
+{
+    QTest::addColumn<Plan>("planNominal");
+    QTest::addColumn<double>("crossTrackHorizon");
+
+    Plan planNominal;
+    planNominal.setPlan(QVector<Waypt>{Waypt{0.0, 0.0, 0.0, 0},
+                                       Waypt{1000.0, 1000.0, 0.0, 1},
+                                       Waypt{2000.0, 1000.0, 0.0, 2},
+                                       Waypt{3000.0, 0.0, 0.0, 3},
+                                       Waypt{4000.0, 0.0, 0.0, 4}},
+                        0);
+    QTest::newRow("Test 1") << planNominal << 2500.0;
+    QTest::newRow("Test 2 (long route)") << TestScenario::longRoute(30) << 1000.0;
+}
+
+//----------
+void EllMapQTests::verify_getRootData_crossTrackPlan()
+{
+    //reference: offset plan through the position, built from the sector's reference plan with
+    //PlanHelper::getCrossTrackPlan
+    QFETCH(Plan, planNominal);
+    QFETCH(double, crossTrackHorizon);
+
+    EllMap ellMap;
+    QVERIFY(ellMap.buildEllMap(planNominal, crossTrackHorizon));
+    int nPlan = ellMap.size();
+    int nSeg = ellMap.at(0).nSegment();
+    int idxNominal = -1;
+    for(int i = 0; i < nPlan; ++i){
+        if(ellMap.at(i).testProperty(Plan::Property::IS_NOMINAL)){
+            idxNominal = i;
+        }
+    }
+    QVERIFY(idxNominal >= 0);
+
+    int nCompared = 0;
+    RootData rootData;
+    for(int planIdx = 0; planIdx < nPlan - 1; ++planIdx){
+        const Plan& planRef = ellMap.at(planIdx < idxNominal? planIdx + 1 : planIdx);
+        for(int segIdx = 0; segIdx < nSeg; ++segIdx){
+            const Segment& segCurr = ellMap.at(planIdx).segmentList().at(segIdx);
+            const Segment& segRhs = ellMap.at(planIdx + 1).segmentList().at(segIdx);
+            //getCrossTrackPlan does not accept the zero length segments of a reference plan with dummy segments
+            bool hasDummy = false;
+            for(const Segment& seg: planRef.segmentList()){
+                hasDummy = hasDummy || seg.length() < TOL_SMALL;
+            }
+            if(hasDummy || segCurr.length() < TOL_SMALL || segRhs.length() < TOL_SMALL){
+                continue;
+            }
+
+            //probe inside the sector, away from its boundaries
+            Vec2 pos = 0.25 * (segCurr.wayptPrev().coord_const_ref() + segCurr.wayptNext().coord_const_ref() +
+                               segRhs.wayptPrev().coord_const_ref() + segRhs.wayptNext().coord_const_ref());
+            rootData.setPlanIdx(planIdx);
+            rootData.setSegIdx(segIdx);
+            QVERIFY(ellMap.getRootData(VectorF(pos), rootData));
+            if(rootData.planIdx() != planIdx || rootData.segIdx() != segIdx){
+                continue; //centroid of a non-convex sector
+            }
+
+            const Segment& segRef = planRef.segmentList().at(segIdx);
+            double dx_ref = (pos - segRef.wayptPrev().coord_const_ref()).dot(segRef.nVec());
+            bool res_ok;
+            Plan planOffset = PlanHelper::getCrossTrackPlan(planRef, 2.0*abs(dx_ref), dx_ref, QVector<int>(), TOL_SMALL, &res_ok);
+            QVERIFY(res_ok);
+            const Segment& segOffset = planOffset.segmentList().at(segIdx);
+            double cumLength = segIdx > 0? planOffset.segmentList().at(segIdx - 1).lengthCumulative() : 0.0;
+            double d_ell = (pos - segOffset.wayptPrev().coord_const_ref()).norm2();
+
+            QVERIFY(UtilHelper::compare(rootData.dx(), planRef.crossTrack() + dx_ref, 1e-6));
+            QVERIFY(UtilHelper::compare(rootData.L(), segOffset.length(), 1e-6));
+            QVERIFY(UtilHelper::compare(rootData.ell(), cumLength + d_ell, 1e-6));
+            QVERIFY(UtilHelper::compare(rootData.f_ell(), d_ell / segOffset.length(), 1e-6));
+            ++nCompared;
+        }
+    }
+    QVERIFY(nCompared > 0);
+}
+
+//----------
+void EllMapQTests::verify_getRootData_batch_data()
+{
+    QTest::addColumn<int>("nThread");
+
+    QTest::newRow("Test 1 (calling thread)") << 1;
+    QTest::newRow("Test 2 (4 threads)") << 4;
+    QTest::newRow("Test 3 (ideal thread count)") << 0;
+}
+
+//----------
+void EllMapQTests::verify_getRootData_batch()
+{
+    //reference: successive single position calls sharing one RootData
+    QFETCH(int, nThread);
+
+    Plan planNominal = TestScenario::longRoute(30);
+    EllMap ellMap;
+    QVERIFY(ellMap.buildEllMap(planNominal, 1000.0));
+
+    //track along the nominal plan at several crosstracks, with a few positions outside of the ell map
+    QVector<Vec2> posNEList;
+    for(double crossTrack: {-123.4, 0.5, 617.3, 5000.0}){
+        for(const Segment& seg: planNominal.segmentList()){
+            for(double s = 0.5; s < seg.length(); s += 3.7){
+                posNEList.append(seg.wayptPrev().coord_const_ref() + s * seg.tVec() + crossTrack * seg.nVec());
+            }
+        }
+    }
+    QVERIFY(posNEList.size() > 4 * 512); //enough positions for several threads
+
+    RootDataBatch batch;
+    int nFound = ellMap.getRootData(posNEList, batch, nThread);
+    QCOMPARE(batch.size(), posNEList.size());
+
+    RootData rootData;
+    int nFound_expect = 0;
+    for(int i = 0; i < posNEList.size(); ++i){
+        bool found = ellMap.getRootData(VectorF(posNEList.at(i)), rootData);
+        nFound_expect += found? 1 : 0;
+        QCOMPARE(batch.isInPoly(i), found);
+        if(nThread == 1){
+            //same warm start chain => same sector, also on sector boundaries
+            QCOMPARE(batch.planIdx().at(i), rootData.planIdx());
+            QCOMPARE(batch.segIdx().at(i), rootData.segIdx());
+        }
+        QVERIFY(UtilHelper::compare(batch.dx().at(i), rootData.dx(), 1e-6));
+        QVERIFY(UtilHelper::compare(batch.ell().at(i), rootData.ell(), 1e-6));
+        QVERIFY(UtilHelper::compare(batch.f_ell().at(i), rootData.f_ell(), 1e-6));
+        QVERIFY(UtilHelper::compare(batch.L().at(i), rootData.L(), 1e-6));
+    }
+    QCOMPARE(nFound, nFound_expect);
+    QVERIFY(nFound > 0 && nFound < posNEList.size());
+}
+
+//----------
+void EllMapQTests::verify_getPosNE_data()
+{
+    QTest::addColumn<Plan>("planNominal");
+    QTest::addColumn<double>("crossTrackHorizon");
+
+    Plan planNominal;
+    planNominal.setPlan(QVector<Waypt>{Waypt{0.0, 0.0, 0.0, 0},
+                                       Waypt{1000.0, 1000.0, 0.0, 1},
+                                       Waypt{2000.0, 1000.0, 0.0, 2},
+                                       Waypt{3000.0, 0.0, 0.0, 3},
+                                       Waypt{4000.0, 0.0, 0.0, 4}},
+                        0);
+    QTest::newRow("Test 1") << planNominal << 2500.0;
+    QTest::newRow("Test 2 (long route)") << TestScenario::longRoute(30) << 1000.0;
+}
+
+//----------
+void EllMapQTests::verify_getPosNE()
+{
+    //reference: getRootData, of which getPosNE is the inverse
+    QFETCH(Plan, planNominal);
+    QFETCH(double, crossTrackHorizon);
+
+    EllMap ellMap;
+    Vec2 posNE(-1.0, -1.0);
+    QVERIFY(!ellMap.getPosNE(0.0, 0.0, posNE));
+    QVERIFY(ellMap.buildEllMap(planNominal, crossTrackHorizon));
+
+    //positions along the nominal plan at several crosstracks
+    int nCompared = 0;
+    RootData rootData;
+    for(double crossTrack: {-0.9 * crossTrackHorizon, -123.4, 0.5, 0.5 * crossTrackHorizon}){
+        for(const Segment& seg: planNominal.segmentList()){
+            for(double s = 0.5; s < seg.length(); s += 37.3){
+                Vec2 pos = seg.wayptPrev().coord_const_ref() + s * seg.tVec() + crossTrack * seg.nVec();
+                if(!ellMap.getRootData(VectorF(pos), rootData)){
+                    continue;
+                }
+                QVERIFY(ellMap.getPosNE(rootData.dx(), rootData.ell(), posNE));
+                QVERIFY2(posNE.compare(pos, 1e-6),
+                         qPrintable(QString("dx %1, ell %2").arg(rootData.dx()).arg(rootData.ell())));
+                ++nCompared;
+            }
+        }
+    }
+    QVERIFY(nCompared > 100);
+
+    //ends of the plans and out of range coordinates
+    const Plan& planFirst = ellMap.at(0);
+    const Plan& planLast = ellMap.at(ellMap.size() - 1);
+    QVERIFY(ellMap.getPosNE(planFirst.crossTrack(), 0.0, posNE));
+    QVERIFY(posNE.compare(planFirst.segmentList().first().wayptPrev().coord_const_ref(), 1e-6));
+    QVERIFY(ellMap.getPosNE(planLast.crossTrack(), planLast.length(), posNE));
+    QVERIFY(posNE.compare(planLast.segmentList().last().wayptNext().coord_const_ref(), 1e-6));
+    Vec2 posNE_prev = posNE;
+    QVERIFY(!ellMap.getPosNE(0.0, -1.0, posNE));
+    QVERIFY(!ellMap.getPosNE(0.0, ellMap.planNominal().length() + 1.0, posNE));
+    QVERIFY(!ellMap.getPosNE(planFirst.crossTrack() - 1.0, 0.0, posNE));
+    QVERIFY(!ellMap.getPosNE(planLast.crossTrack() + 1.0, 0.0, posNE));
+    QCOMPARE(posNE, posNE_prev);
+}
+
+//----------
+void EllMapQTests::verify_concurrentQueries_data()
+{
+    QTest::addColumn<int>("nThread");
+    QTest::addColumn<bool>("isCopy"); //each thread queries its own copy sharing the data, else the same object
+
+    QTest::newRow("Test 1 (2 threads, same object)") << 2 << false;
+    QTest::newRow("Test 2 (8 threads, same object)") << 8 << false;
+    QTest::newRow("Test 3 (8 threads, shared copies)") << 8 << true;
+}
+
+//----------
+void EllMapQTests::verify_concurrentQueries()
+{
+    //reference: the same queries on the calling thread. QTest macros are not thread-safe, so the threads only
+    //record their results and the comparison runs here.
+    QFETCH(int, nThread);
+    QFETCH(bool, isCopy);
+
+    Plan planNominal = TestScenario::longRoute(30);
+    EllMap ellMap;
+    QVERIFY(ellMap.buildEllMap(planNominal, 1000.0));
+
+    QVector<Vec2> posNEList;
+    for(double crossTrack: {-456.7, 12.3, 789.1, 3000.0}){
+        for(const Segment& seg: planNominal.segmentList()){
+            for(double s = 0.5; s < seg.length(); s += 11.3){
+                posNEList.append(seg.wayptPrev().coord_const_ref() + s * seg.tVec() + crossTrack * seg.nVec());
+            }
+        }
+    }
+
+    struct Result{
+        QVector<int> planIdx;       //getRootData, warm started along the track
+        QVector<double> ell;
+        QVector<double> dx;
+        QVector<int> planIdxCold;   //locateSector from a far away start sector
+        QVector<int> segIdxCold;
+        int nSegNominal{};          //touches the shared plan list as well
+    };
+    auto runQueries = [&posNEList](const EllMap& map, int offset, Result& result){
+        int nPos = posNEList.size();
+        int nSeg = map.at(0).nSegment();
+        RootData rootData;
+        for(int k = 0; k < nPos; ++k){
+            int i = (k + offset) % nPos; //threads start at different positions
+            bool found = map.getRootData(VectorF(posNEList.at(i)), rootData);
+            result.planIdx[i] = found? rootData.planIdx() : -1;
+            result.ell[i] = rootData.ell();
+            result.dx[i] = rootData.dx();
+            int planIdx, segIdx;
+            if(!map.locateSector(VectorF(posNEList.at(i)), (i * 7) % (map.size() - 1), (i * 13) % nSeg, planIdx, segIdx)){
+                planIdx = segIdx = -1;
+            }
+            result.planIdxCold[i] = planIdx;
+            result.segIdxCold[i] = segIdx;
+        }
+        result.nSegNominal = map.planNominal().nSegment();
+    };
+    auto resized = [&posNEList](){
+        Result ret;
+        ret.planIdx.resize(posNEList.size());
+        ret.ell.resize(posNEList.size());
+        ret.dx.resize(posNEList.size());
+        ret.planIdxCold.resize(posNEList.size());
+        ret.segIdxCold.resize(posNEList.size());
+        return(ret);
+    };
+
+    Result expect = resized();
+    runQueries(ellMap, 0, expect);
+
+    QVector<Result> resultList(nThread, resized());
+    QList<QThread*> threadList;
+    for(int t = 0; t < nThread; ++t){
+        Result* p_result = &resultList[t];
+        int offset = t * posNEList.size() / nThread;
+        threadList.append(QThread::create([&ellMap, &runQueries, isCopy, offset, p_result](){
+            for(int repeat = 0; repeat < 5; ++repeat){
+                if(isCopy){
+                    EllMap copy(ellMap);
+                    runQueries(copy, offset, *p_result);
+                }
+                else{
+                    runQueries(ellMap, offset, *p_result);
+                }
+            }
+        }));
+    }
+    for(QThread* thread: threadList){
+        thread->start();
+    }
+    for(QThread* thread: threadList){
+        thread->wait();
+    }
+    qDeleteAll(threadList);
+
+    for(const Result& result: resultList){
+        QCOMPARE(result.planIdx, expect.planIdx);
+        QCOMPARE(result.planIdxCold, expect.planIdxCold);
+        QCOMPARE(result.segIdxCold, expect.segIdxCold);
+        QCOMPARE(result.nSegNominal, expect.nSegNominal);
+        for(int i = 0; i < posNEList.size(); ++i){
+            QVERIFY(UtilHelper::compare(result.ell.at(i), expect.ell.at(i), 1e-6));
+            QVERIFY(UtilHelper::compare(result.dx.at(i), expect.dx.at(i), 1e-6));
+        }
+    }
+}
@@ -20,10 +20,24 @@ private:
 private slots:
     void verify_buildEllMap_data();
     void verify_buildEllMap();
+    void verify_boundingBox_data();
+    void verify_boundingBox();
     void verify_locateSector_data();
     void verify_locateSector();
+    void verify_locateSector_ringSearch_data();
+    void verify_locateSector_ringSearch();
+    void verify_locateSector_warmStart_data();
+    void verify_locateSector_warmStart();
     void verify_getRootData_data();
     void verify_getRootData();
+    void verify_getRootData_crossTrackPlan_data();
+    void verify_getRootData_crossTrackPlan();
+    void verify_getRootData_batch_data();
+    void verify_getRootData_batch();
+    void verify_getPosNE_data();
+    void verify_getPosNE();
+    void verify_concurrentQueries_data();
+    void verify_concurrentQueries();
 };
 
 #endif
@@ -0,0 +1,275 @@
+#include "SMapSamplerQTests.h"
+#include <RrtPlannerLib/framework/SMapSampler.h>
+#include <RrtPlannerLib/framework/SMap.h>
+#include <RrtPlannerLib/framework/Plan.h>
+#include <RrtPlannerLib/framework/UtilHelper.h>
+#include <RrtPlannerLib/framework/EllMap.h>
+#include <RrtPlannerLib/framework/RootData.h>
+#include <RrtPlannerLib/framework/VectorF.h>
+#include <QtTest/QtTest>
+#include <QtGlobal>
+#include <cmath>
+#include <random>
+
+using namespace rrtplanner::framework;
+
+Q_DECLARE_METATYPE(SMapSampler::IntervalSearch)
+
+namespace
+{
+//the SMap of SMapQTests::verify_reset
+SMap createSMap()
+{
+    Plan planNominal;
+    planNominal.setPlan(QVector<Waypt>{Waypt{0.0, 0.0, 0.0, 0},
+                                Waypt{1000.0, 1000.0, 0.0, 1},
+                                Waypt{2000.0, 1000.0, 0.0, 2},
+                                Waypt{3000.0, 0.0, 0.0, 3},
+                                Waypt{4000.0, 0.0, 0.0, 4}},
+                 0);
+    planNominal.setProperty(Plan::Property::IS_NOMINAL);
+    EllMap ellMap;
+    bool buildOk = ellMap.buildEllMap(planNominal, 2500.0);
+    Q_ASSERT(buildOk);
+
+    SMap sMap;
+    sMap.setEllMap(ellMap, 2500.0, 375.0, 7.7167, 15.4333);
+    bool resetOk = sMap.reset(VectorF{2200, 0});
+    Q_ASSERT(resetOk);
+    Q_UNUSED(buildOk);
+    Q_UNUSED(resetOk);
+    return(sMap);
+}
+
+//composite Simpson rule, exact for the piecewise polynomials below when the kinks are panel ends
+template<class F>
+double simpson(const F& f, double a, double b, int nPanel)
+{
+    double h = (b - a) / nPanel;
+    double sum{};
+    for(int k = 0; k < nPanel; ++k){
+        double x0 = a + k * h;
+        sum += f(x0) + 4.0 * f(x0 + 0.5 * h) + f(x0 + h);
+    }
+    return(sum * h / 6.0);
+}
+
+//chi-square statistic of values in [0, 1] against the uniform distribution, over nBin bins
+double chiSquareUniform(const QVector<double>& valueList, int nBin)
+{
+    QVector<int> count(nBin, 0);
+    for(double value: valueList){
+        ++count[std::min(std::max(static_cast<int>(value * nBin), 0), nBin - 1)];
+    }
+    double expect = static_cast<double>(valueList.size()) / nBin;
+    double chi2{};
+    for(int c: count){
+        chi2 += (c - expect) * (c - expect) / expect;
+    }
+    return(chi2);
+}
+}
+
+//----------
+SMapSamplerQTests::SMapSamplerQTests()
+{
+
+}
+
+//----------
+SMapSamplerQTests::~SMapSamplerQTests()
+{
+    cleanUp();
+}
+
+//----------
+void SMapSamplerQTests::setup()
+{
+
+}
+
+//----------
+void SMapSamplerQTests::cleanUp()
+{
+
+}
+
+//----------
+void SMapSamplerQTests::verify_build_data()
+{
+    QTest::addColumn<SMapSampler::IntervalSearch>("intervalSearch");
+
+    QTest::newRow("Binary search") << SMapSampler::IntervalSearch::BINARY_SEARCH;
+    QTest::newRow("Alias") << SMapSampler::IntervalSearch::ALIAS;
+}
+
+//----------
+void SMapSamplerQTests::verify_build()
+{
+    QFETCH(SMapSampler::IntervalSearch, intervalSearch);
+
+    //an SMap without reset has no volume
+    SMapSampler sampler;
+    QVERIFY(sampler.isEmpty());
+    QVERIFY(!sampler.build(SMap(), intervalSearch));
+    QVERIFY(sampler.isEmpty());
+
+    SMap sMap = createSMap();
+    QVERIFY(sampler.build(sMap, intervalSearch));
+    QVERIFY(!sampler.isEmpty());
+    QCOMPARE(sampler.intervalSearch(), intervalSearch);
+    QCOMPARE(sampler.nInterval(), sMap.size() - 1);
+
+    //the volumes integrated by the sampler match vol_cum
+    double volumeSum{};
+    for(int i = 0; i < sampler.nInterval(); ++i){
+        double volCumIncrement = sMap.at(i + 1).getVol_cum() - sMap.at(i).getVol_cum();
+        QVERIFY(UtilHelper::compare(sampler.intervalVolume(i), volCumIncrement, 1e-4));
+        volumeSum += sampler.intervalVolume(i);
+    }
+    QVERIFY(UtilHelper::compare(volumeSum, 1.0, 1e-9));
+
+    sampler.clear();
+    QVERIFY(sampler.isEmpty());
+}
+
+//----------
+void SMapSamplerQTests::verify_sample_data()
+{
+    QTest::addColumn<SMapSampler::IntervalSearch>("intervalSearch");
+
+    QTest::newRow("Binary search") << SMapSampler::IntervalSearch::BINARY_SEARCH;
+    QTest::newRow("Alias") << SMapSampler::IntervalSearch::ALIAS;
+}
+
+//----------
+void SMapSamplerQTests::verify_sample()
+{
+    QFETCH(SMapSampler::IntervalSearch, intervalSearch);
+
+    SMap sMap = createSMap();
+    SMapSampler sampler;
+    QVERIFY(sampler.build(sMap, intervalSearch));
+
+    const int n = 200000;
+    std::mt19937 rng(7);
+    QVector<double> dxList, ellList, speedList, tList;
+    sampler.sample(rng, n, dxList, ellList, speedList, &tList);
+    QCOMPARE(dxList.size(), n);
+    QCOMPARE(ellList.size(), n);
+    QCOMPARE(speedList.size(), n);
+    QCOMPARE(tList.size(), n);
+
+    //samples are within the volume, and the share of each interval is its volume
+    const double tol = 1e-6;
+    QVector<int> count(sampler.nInterval(), 0);
+    for(int k = 0; k < n; ++k){
+        double dx = dxList.at(k);
+        QVERIFY(dx >= sMap.at(0).getCrosstrack() - tol && dx <= sMap.at(sMap.size() - 1).getCrosstrack() + tol);
+        int i = 0;
+        while(i < sampler.nInterval() - 1 && dx > sMap.at(i + 1).getCrosstrack()){
+            ++i;
+        }
+        ++count[i];
+        double f = (dx - sMap.at(i).getCrosstrack()) / (sMap.at(i + 1).getCrosstrack() - sMap.at(i).getCrosstrack());
+        double lh = sMap.at(i).getLh() + f * (sMap.at(i + 1).getLh() - sMap.at(i).getLh());
+        QVERIFY(ellList.at(k) >= 0.0 && ellList.at(k) <= lh + tol);
+        QVERIFY(tList.at(k) >= 0.0 && tList.at(k) <= sMap.th0() + tol);
+        QVERIFY(speedList.at(k) >= sMap.umin() - tol && speedList.at(k) <= sMap.umax() + tol);
+    }
+    for(int i = 0; i < sampler.nInterval(); ++i){
+        double share = static_cast<double>(count.at(i)) / n;
+        double sigma = std::sqrt(sampler.intervalVolume(i) * (1.0 - sampler.intervalVolume(i)) / n);
+        QVERIFY(std::fabs(share - sampler.intervalVolume(i)) < 5.0 * sigma + 1e-4);
+    }
+
+    //analytic densities: the time span at ell is min(th0, ell/umin) - ell/umax, the density of ell given dx is that
+    //span, and the density of dx within an interval is the area of the (ell, t) section at lh(dx). Each sample is
+    //mapped through its conditional CDF, computed by quadrature, which must then be uniform (probability integral
+    //transform), as must t within its span given ell
+    const double th0 = sMap.th0();
+    const double umin = sMap.umin();
+    const double umax = sMap.umax();
+    const double ellCone = umin > 0.0? th0 * umin : 0.0;
+    auto span = [&](double ell){
+        return((umin > 0.0? std::min(th0, ell / umin) : th0) - ell / umax);
+    };
+    auto sectionArea = [&](double ell){
+        double ell1 = std::min(ellCone, ell);
+        return(simpson(span, 0.0, ell1, 2) + simpson(span, ell1, ell, 2));
+    };
+    QVector<double> dxCdfList, ellCdfList, tCdfList;
+    for(int k = 0; k < n; k += 10){
+        double dx = dxList.at(k);
+        int i = 0;
+        while(i < sampler.nInterval() - 1 && dx > sMap.at(i + 1).getCrosstrack()){
+            ++i;
+        }
+        double x0 = sMap.at(i).getCrosstrack();
+        double width = sMap.at(i + 1).getCrosstrack() - x0;
+        double lh0 = sMap.at(i).getLh();
+        double lh1 = sMap.at(i + 1).getLh();
+        auto dxDensity = [&](double f){ return(sectionArea(lh0 + f * (lh1 - lh0))); };
+        double f = std::min(std::max((dx - x0) / width, 0.0), 1.0);
+        dxCdfList.append(simpson(dxDensity, 0.0, f, 32) / simpson(dxDensity, 0.0, 1.0, 32));
+
+        double ell = ellList.at(k);
+        ellCdfList.append(sectionArea(ell) / sectionArea(lh0 + f * (lh1 - lh0)));
+
+        double tLo = ell / umax;
+        tCdfList.append((tList.at(k) - tLo) / span(ell));
+    }
+    //chi-square of 9 degrees of freedom, 27.88 at the 0.1% level
+    QVERIFY2(chiSquareUniform(dxCdfList, 10) < 27.88, "dx within its interval");
+    QVERIFY2(chiSquareUniform(ellCdfList, 10) < 27.88, "ell given dx");
+    QVERIFY2(chiSquareUniform(tCdfList, 10) < 27.88, "t given ell");
+
+    //the single sample overload maps the variates deterministically, the binary search is monotone in u0
+    SMapSample s0, s1;
+    sampler.sample(0.3, 0.5, 0.5, 0.5, s0);
+    sampler.sample(0.3, 0.5, 0.5, 0.5, s1);
+    QCOMPARE(s0.dx, s1.dx);
+    QCOMPARE(s0.ell, s1.ell);
+    QCOMPARE(s0.speed, s1.speed);
+    if(intervalSearch == SMapSampler::IntervalSearch::BINARY_SEARCH){
+        int intervalPrev = -1;
+        for(int k = 0; k <= 100; ++k){
+            double u0 = k < 100? k / 100.0 : 1.0 - 1e-12;   //up to the last interval, whatever its volume
+            sampler.sample(u0, 0.5, 0.5, 0.5, s0);
+            QVERIFY(s0.interval >= intervalPrev);
+            intervalPrev = s0.interval;
+        }
+        QCOMPARE(intervalPrev, sampler.nInterval() - 1);
+    }
+}
+
+//----------
+void SMapSamplerQTests::verify_posNE()
+{
+    SMap sMap = createSMap();
+    SMapSampler sampler;
+    QVERIFY(sampler.build(sMap));
+
+    //the root itself
+    const RootData& root = sMap.rootData();
+    Vec2 posNE;
+    QVERIFY(sampler.posNE(root.dx(), 0.0, posNE));
+    QVERIFY(std::fabs(posNE[0] - root.posNE().at(0)) < 1e-3);
+    QVERIFY(std::fabs(posNE[1] - root.posNE().at(1)) < 1e-3);
+
+    //samples map back to their crosstrack
+    std::mt19937 rng(11);
+    QVector<double> dxList, ellList, speedList;
+    sampler.sample(rng, 200, dxList, ellList, speedList);
+    int nInside{};
+    for(int k = 0; k < dxList.size(); ++k){
+        if(!sampler.posNE(dxList.at(k), ellList.at(k), posNE)){
+            continue;
+        }
+        ++nInside;
+        RootData rootData;
+        QVERIFY(sMap.ellMap().getRootData(VectorF(posNE), rootData));
+        QVERIFY(std::fabs(rootData.dx() - dxList.at(k)) < 1e-3);
+    }
+    QVERIFY(nInside > 0);
+}
@@ -0,0 +1,27 @@
+#ifndef RRTPLANNER_LIB_SMAPSAMPLERQTESTS_H
+#define RRTPLANNER_LIB_SMAPSAMPLERQTESTS_H
+
+#include <QObject>
+#include <QScopedPointer>
+
+class SMapSamplerQTests : public QObject
+{
+    Q_OBJECT
+
+public:
+    SMapSamplerQTests();
+    ~SMapSamplerQTests();
+
+private:
+    void setup();
+    void cleanUp();
+
+private slots:
+    void verify_build_data();
+    void verify_build();
+    void verify_sample_data();
+    void verify_sample();
+    void verify_posNE();
+};
+
+#endif
@@ -0,0 +1,155 @@
+#include "SectorGridQTests.h"
+#include <RrtPlannerLib/framework/SectorGrid.h>
+#include <RrtPlannerLib/framework/SectorTable.h>
+#include <RrtPlannerLib/framework/SegmentArrays.h>
+#include <RrtPlannerLib/framework/EllMap.h>
+#include <RrtPlannerLib/framework/Plan.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/GjkFactory.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/Gjk.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/PointShape.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/Polygon.h>
+#include <QtTest/QtTest>
+#include <QtGlobal>
+#include <QScopedPointer>
+#include <cmath>
+
+using namespace rrtplanner::framework;
+using namespace rrtplanner::framework::algorithm::gjk;
+
+//----------
+static QVector<SegmentArrays> segArraysOf(const EllMap& ellMap)
+{
+    QVector<SegmentArrays> segArraysList;
+    for(int i = 0; i < ellMap.size(); ++i){
+        segArraysList.append(SegmentArrays(ellMap.at(i)));
+    }
+    return(segArraysList);
+}
+
+//----------
+SectorGridQTests::SectorGridQTests()
+{
+
+}
+
+//----------
+SectorGridQTests::~SectorGridQTests()
+{
+
+}
+
+//----------
+void SectorGridQTests::verify_build_data()
+{
+    QTest::addColumn<int>("nPlan");
+    QTest::addColumn<bool>("isEmpty_expect");
+
+    QTest::newRow("Test 1 (no plan)") << 0 << true;
+    QTest::newRow("Test 2 (single plan, no sector)") << 1 << true;
+    QTest::newRow("Test 3 (two plans)") << 2 << false;
+}
+
+//----------
+void SectorGridQTests::verify_build()
+{
+    QFETCH(int, nPlan);
+    QFETCH(bool, isEmpty_expect);
+
+    QVector<SegmentArrays> segArraysList;
+    for(int i = 0; i < nPlan; ++i){
+        Plan plan;
+        QVERIFY(plan.setPlan(QVector<Waypt>{Waypt(0.0, 100.0*i, 0.0, 0), Waypt(1000.0, 100.0*i, 0.0, 1)}));
+        segArraysList.append(SegmentArrays(plan));
+    }
+
+    SectorTable sectorTable;
+    sectorTable.build(segArraysList);
+    SectorGrid grid;
+    grid.build(sectorTable, 1.0);
+    QCOMPARE(grid.isEmpty(), isEmpty_expect);
+
+    SectorGrid::CandidateList candidateList;
+    grid.candidates(Vec2(500.0, 50.0), candidateList);
+    QCOMPARE(candidateList.size(), isEmpty_expect? 0 : 1);
+    if(!isEmpty_expect){
+        QCOMPARE(grid.planIdx(candidateList.at(0)), 0);
+        QCOMPARE(grid.segIdx(candidateList.at(0)), 0);
+    }
+    grid.candidates(Vec2(-500.0, 50.0), candidateList); //outside of every sector
+    QVERIFY(candidateList.isEmpty());
+
+    grid.clear();
+    QVERIFY(grid.isEmpty());
+    grid.candidates(Vec2(500.0, 50.0), candidateList);
+    QVERIFY(candidateList.isEmpty());
+}
+
+//----------
+void SectorGridQTests::verify_candidates_data()
+{
+    QTest::addColumn<Plan>("planNominal");
+    QTest::addColumn<double>("crossTrackHorizon");
+
+    Plan planNominal;
+    planNominal.setPlan(QVector<Waypt>{Waypt{0.0, 0.0, 0.0, 0},
+                                       Waypt{1000.0, 1000.0, 0.0, 1},
+                                       Waypt{2000.0, 1000.0, 0.0, 2},
+                                       Waypt{3000.0, 0.0, 0.0, 3},
+                                       Waypt{4000.0, 0.0, 0.0, 4}},
+                        0);
+    QTest::newRow("Test 1") << planNominal << 2500.0;
+
+    QVector<Waypt> wayptList;
+    for(int i = 0; i < 40; ++i){
+        wayptList.append(Waypt{300.0*i, 400.0*std::sin(0.7*i) + 150.0*std::sin(2.3*i), 0.0, i});
+    }
+    planNominal.setPlan(wayptList, 0);
+    QTest::newRow("Test 2 (zig-zag)") << planNominal << 1000.0;
+}
+
+//----------
+void SectorGridQTests::verify_candidates()
+{
+    QFETCH(Plan, planNominal);
+    QFETCH(double, crossTrackHorizon);
+
+    EllMap ellMap;
+    QVERIFY(ellMap.buildEllMap(planNominal, crossTrackHorizon));
+    QVector<SegmentArrays> segArraysList = segArraysOf(ellMap);
+
+    SectorTable sectorTable;
+    sectorTable.build(segArraysList);
+    SectorGrid grid;
+    grid.build(sectorTable, 1.0);
+    QVERIFY(!grid.isEmpty());
+
+    //every sector containing a probe (brute force) must be listed as a candidate of the probe's cell
+    QScopedPointer<Gjk> p_gjk(GjkFactory::getGjk(GjkFactory::GjkType::Basic));
+    int nSeg = segArraysList.first().size();
+    double minN = -crossTrackHorizon, maxN = planNominal.segmentList().last().wayptNext().coord_const_ref()[0] + crossTrackHorizon;
+    double minE = -2.0*crossTrackHorizon, maxE = 2.0*crossTrackHorizon;
+    int nProbe = 60;
+    int nInside = 0;
+    for(int iN = 0; iN < nProbe; ++iN){
+        for(int iE = 0; iE < nProbe; ++iE){
+            Vec2 pos(minN + (maxN - minN) * (iN + 0.37) / nProbe, minE + (maxE - minE) * (iE + 0.61) / nProbe);
+            PointShape point(pos);
+            SectorGrid::CandidateList candidateList;
+            grid.candidates(pos, candidateList);
+            for(int p = 0; p < segArraysList.size() - 1; ++p){
+                for(int s = 0; s < nSeg; ++s){
+                    Polygon polysec{segArraysList.at(p).nodePrev(s), segArraysList.at(p).nodeNext(s),
+                                    segArraysList.at(p+1).nodePrev(s), segArraysList.at(p+1).nodeNext(s)};
+                    double distance;
+                    bool isValidDistance;
+                    if(!p_gjk->chkIntersect(point, polysec, distance, isValidDistance)){
+                        continue;
+                    }
+                    ++nInside;
+                    QVERIFY(candidateList.contains(p * nSeg + s));
+                }
+            }
+        }
+    }
+    QVERIFY(nInside > 0);
+}
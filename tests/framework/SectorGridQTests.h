@@ -0,0 +1,21 @@
+#ifndef RRTPLANNER_LIB_SECTORGRIDQTESTS_H
+#define RRTPLANNER_LIB_SECTORGRIDQTESTS_H
+
+#include <QObject>
+
+class SectorGridQTests : public QObject
+{
+    Q_OBJECT
+
+public:
+    SectorGridQTests();
+    ~SectorGridQTests();
+
+private slots:
+    void verify_build_data();
+    void verify_build();
+    void verify_candidates_data();
+    void verify_candidates();
+};
+
+#endif
@@ -0,0 +1,235 @@
+#include "SectorTableQTests.h"
+#include <RrtPlannerLib/framework/SectorTable.h>
+#include <RrtPlannerLib/framework/SegmentArrays.h>
+#include <RrtPlannerLib/framework/EllMap.h>
+#include <RrtPlannerLib/framework/Plan.h>
+#include <RrtPlannerLib/framework/FrameworkDefines.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/GjkFactory.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/Gjk.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/PointShape.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/Polygon.h>
+#include <QtTest/QtTest>
+#include <QtGlobal>
+#include <QScopedPointer>
+#include <cmath>
+
+using namespace rrtplanner::framework;
+using namespace rrtplanner::framework::algorithm::gjk;
+
+class MockPlan: public Plan
+{
+public:
+    MockPlan()
+        :Plan(){}
+    virtual ~MockPlan(){}
+    //sectors next to dummy segments need plans with zero length segments, which verifyPlanInput disallows.
+    bool setPlan_skipCheck(const QVector<Waypt>& wayptList)
+    {
+        return(setPlan(wayptList, QVector<int>(), nullptr, false));
+    }
+};
+
+//----------
+SectorTableQTests::SectorTableQTests()
+{
+
+}
+
+//----------
+SectorTableQTests::~SectorTableQTests()
+{
+
+}
+
+//----------
+void SectorTableQTests::verify_build()
+{
+    QVector<SegmentArrays> segArraysList;
+    for(int i = 0; i < 3; ++i){
+        Plan plan;
+        QVERIFY(plan.setPlan(QVector<Waypt>{Waypt(0.0, 10.0*i, 0.0, 0), Waypt(100.0, 10.0*i, 0.0, 1), Waypt(200.0, 10.0*i, 0.0, 2)}));
+        segArraysList.append(SegmentArrays(plan));
+    }
+
+    SectorTable sectorTable;
+    sectorTable.build(segArraysList);
+    QCOMPARE(sectorTable.size(), 4);
+    QCOMPARE(sectorTable.nSeg(), 2);
+
+    int sectorIdx = 1 * sectorTable.nSeg() + 1; //plan 1, seg 1
+    QCOMPARE(sectorTable.planIdx(sectorIdx), 1);
+    QCOMPARE(sectorTable.segIdx(sectorIdx), 1);
+    QVERIFY(sectorTable.vertex(sectorIdx, 0) == Vec2(100.0, 10.0));
+    QVERIFY(sectorTable.vertex(sectorIdx, 1) == Vec2(200.0, 10.0));
+    QVERIFY(sectorTable.vertex(sectorIdx, 2) == Vec2(100.0, 20.0));
+    QVERIFY(sectorTable.vertex(sectorIdx, 3) == Vec2(200.0, 20.0));
+
+    sectorTable.clear();
+    QCOMPARE(sectorTable.size(), 0);
+
+    sectorTable.build(QVector<SegmentArrays>{segArraysList.first()}); //a single plan has no sector
+    QCOMPARE(sectorTable.size(), 0);
+}
+
+//----------
+void SectorTableQTests::verify_contains_data()
+{
+    QTest::addColumn<QVector<Waypt>>("wayptListCurr");
+    QTest::addColumn<QVector<Waypt>>("wayptListRhs");
+    QTest::addColumn<Vec2>("pos");
+    QTest::addColumn<bool>("contains_expect");
+
+    QVector<Waypt> curr{Waypt(0.0, 0.0, 0.0, 0), Waypt(100.0, 0.0, 0.0, 1)};
+    QVector<Waypt> rhs{Waypt(0.0, 50.0, 0.0, 0), Waypt(100.0, 60.0, 0.0, 1)};
+    QTest::newRow("Test 1 (quad, inside)") << curr << rhs << Vec2(50.0, 25.0) << true;
+    QTest::newRow("Test 2 (quad, outside)") << curr << rhs << Vec2(50.0, 60.0) << false;
+    QTest::newRow("Test 3 (quad, on edge)") << curr << rhs << Vec2(50.0, 0.0) << true;
+    QTest::newRow("Test 4 (quad, on vertex)") << curr << rhs << Vec2(100.0, 60.0) << true;
+    QTest::newRow("Test 5 (quad, beyond end)") << curr << rhs << Vec2(100.1, 30.0) << false;
+
+    //crossed vertex order is irrelevant, the sector is the convex hull
+    QVector<Waypt> rhsCrossed{Waypt(100.0, 60.0, 0.0, 0), Waypt(0.0, 50.0, 0.0, 1)};
+    QTest::newRow("Test 6 (crossed quad, inside)") << curr << rhsCrossed << Vec2(50.0, 25.0) << true;
+
+    QVector<Waypt> dummy{Waypt(0.0, 0.0, 0.0, 0), Waypt(0.0, 0.0, 0.0, 1)};
+    QTest::newRow("Test 7 (triangle, inside)") << dummy << rhs << Vec2(20.0, 40.0) << true;
+    QTest::newRow("Test 8 (triangle, outside)") << dummy << rhs << Vec2(90.0, 10.0) << false;
+
+    QVector<Waypt> dummyFar{Waypt(100.0, 0.0, 0.0, 0), Waypt(100.0, 0.0, 0.0, 1)};
+    QTest::newRow("Test 9 (segment, on it)") << dummy << dummyFar << Vec2(50.0, 0.0) << true;
+    QTest::newRow("Test 10 (segment, beyond end)") << dummy << dummyFar << Vec2(150.0, 0.0) << false;
+    QTest::newRow("Test 11 (segment, off line)") << dummy << dummyFar << Vec2(50.0, 1.0) << false;
+
+    QTest::newRow("Test 12 (point, on it)") << dummy << dummy << Vec2(0.0, 0.0) << true;
+    QTest::newRow("Test 13 (point, off it)") << dummy << dummy << Vec2(0.0, 0.01) << false;
+}
+
+//----------
+void SectorTableQTests::verify_contains()
+{
+    QFETCH(QVector<Waypt>, wayptListCurr);
+    QFETCH(QVector<Waypt>, wayptListRhs);
+    QFETCH(Vec2, pos);
+    QFETCH(bool, contains_expect);
+
+    MockPlan planCurr, planRhs;
+    QVERIFY(planCurr.setPlan_skipCheck(wayptListCurr));
+    QVERIFY(planRhs.setPlan_skipCheck(wayptListRhs));
+
+    SectorTable sectorTable;
+    sectorTable.build(QVector<SegmentArrays>{SegmentArrays(planCurr), SegmentArrays(planRhs)});
+    QCOMPARE(sectorTable.size(), 1);
+    QCOMPARE(sectorTable.contains(0, pos, TOL_SMALL), contains_expect);
+}
+
+//----------
+void SectorTableQTests::verify_contains_vs_gjk()
+{
+    //same membership as the gjk point vs sector polygon test it replaces, away from sector boundaries
+    QVector<Waypt> wayptList;
+    for(int i = 0; i < 12; ++i){
+        wayptList.append(Waypt{300.0*i, 400.0*std::sin(0.7*i) + 150.0*std::sin(2.3*i), 0.0, i});
+    }
+    Plan planNominal;
+    QVERIFY(planNominal.setPlan(wayptList, 0));
+    EllMap ellMap;
+    QVERIFY(ellMap.buildEllMap(planNominal, 1000.0));
+
+    QVector<SegmentArrays> segArraysList;
+    for(int i = 0; i < ellMap.size(); ++i){
+        segArraysList.append(SegmentArrays(ellMap.at(i)));
+    }
+    SectorTable sectorTable;
+    sectorTable.build(segArraysList);
+
+    QScopedPointer<Gjk> p_gjk(GjkFactory::getGjk(GjkFactory::GjkType::Basic));
+    int nProbe = 40;
+    int nInside = 0;
+    for(int k = 0; k < sectorTable.size(); ++k){
+        Polygon polysec{sectorTable.vertex(k, 0), sectorTable.vertex(k, 1), sectorTable.vertex(k, 2), sectorTable.vertex(k, 3)};
+        for(int iN = 0; iN < nProbe; ++iN){
+            for(int iE = 0; iE < nProbe; ++iE){
+                Vec2 pos(-1500.0 + 6000.0 * (iN + 0.37) / nProbe, -2500.0 + 5000.0 * (iE + 0.61) / nProbe);
+                double distance;
+                bool isValidDistance;
+                bool isInPoly_gjk = p_gjk->chkIntersect(PointShape(pos), polysec, distance, isValidDistance);
+                bool isInPoly = sectorTable.contains(k, pos, TOL_SMALL);
+                QCOMPARE(isInPoly, isInPoly_gjk);
+                nInside += isInPoly? 1 : 0;
+            }
+        }
+    }
+    QVERIFY(nInside > 0);
+}
+
+//----------
+void SectorTableQTests::verify_neighbours()
+{
+    //segment 1 is a dummy segment of plans 1 and 2 => sector (0, 1) is a triangle, sector (1, 1) a segment
+    MockPlan plan0, plan1, plan2;
+    QVERIFY(plan0.setPlan_skipCheck(QVector<Waypt>{Waypt(0.0, 0.0, 0.0, 0), Waypt(100.0, 0.0, 0.0, 1), Waypt(200.0, 0.0, 0.0, 2), Waypt(300.0, 0.0, 0.0, 3)}));
+    QVERIFY(plan1.setPlan_skipCheck(QVector<Waypt>{Waypt(0.0, 50.0, 0.0, 0), Waypt(150.0, 50.0, 0.0, 1), Waypt(150.0, 50.0, 0.0, 2), Waypt(300.0, 50.0, 0.0, 3)}));
+    QVERIFY(plan2.setPlan_skipCheck(QVector<Waypt>{Waypt(0.0, 100.0, 0.0, 0), Waypt(150.0, 100.0, 0.0, 1), Waypt(150.0, 100.0, 0.0, 2), Waypt(300.0, 100.0, 0.0, 3)}));
+
+    SectorTable sectorTable;
+    sectorTable.build(QVector<SegmentArrays>{SegmentArrays(plan0), SegmentArrays(plan1), SegmentArrays(plan2)});
+    QCOMPARE(sectorTable.size(), 6);
+    auto k = [](int planIdx, int segIdx){ return(planIdx * 3 + segIdx); };
+
+    QVERIFY(!sectorTable.isDegenerate(k(0, 1)));
+    QVERIFY(sectorTable.isDegenerate(k(1, 1)));
+
+    QCOMPARE(sectorTable.neighbour(k(0, 0), SectorTable::Side::SegPrev), -1);
+    QCOMPARE(sectorTable.neighbour(k(0, 0), SectorTable::Side::SegNext), k(0, 1));
+    QCOMPARE(sectorTable.neighbour(k(0, 0), SectorTable::Side::Port), -1);
+    QCOMPARE(sectorTable.neighbour(k(0, 0), SectorTable::Side::Stbd), k(1, 0));
+    QCOMPARE(sectorTable.neighbour(k(0, 1), SectorTable::Side::Stbd), -1); //degenerate
+    QCOMPARE(sectorTable.neighbour(k(0, 2), SectorTable::Side::SegNext), -1);
+    QCOMPARE(sectorTable.neighbour(k(1, 0), SectorTable::Side::SegNext), k(1, 2)); //skips the dummy segment
+    QCOMPARE(sectorTable.neighbour(k(1, 2), SectorTable::Side::SegPrev), k(1, 0));
+    QCOMPARE(sectorTable.neighbour(k(1, 0), SectorTable::Side::Port), k(0, 0));
+    QCOMPARE(sectorTable.neighbour(k(1, 2), SectorTable::Side::Stbd), -1);
+
+    //depth: positive inside, distance to the closest side
+    QVERIFY(std::abs(sectorTable.depth(k(0, 0), Vec2(50.0, 10.0)) - 10.0) < TOL_SMALL);
+    QVERIFY(sectorTable.depth(k(0, 0), Vec2(50.0, -10.0)) < 0.0);
+    QVERIFY(sectorTable.depth(k(0, 1), Vec2(140.0, 10.0)) > 0.0); //triangle
+    QVERIFY(sectorTable.depth(k(1, 1), Vec2(150.0, 75.0)) <= 0.0); //segment
+}
+
+//----------
+void SectorTableQTests::verify_exitSide_data()
+{
+    QTest::addColumn<Vec2>("pos");
+    QTest::addColumn<bool>("found_expect");
+    QTest::addColumn<int>("side_expect");
+
+    //sector vertices (0, 0), (100, 0), (0, 50), (150, 50)
+    QTest::newRow("Test 1 (inside)") << Vec2(50.0, 25.0) << false << -1;
+    QTest::newRow("Test 2 (port)") << Vec2(50.0, -10.0) << true << static_cast<int>(SectorTable::Side::Port);
+    QTest::newRow("Test 3 (stbd)") << Vec2(50.0, 70.0) << true << static_cast<int>(SectorTable::Side::Stbd);
+    QTest::newRow("Test 4 (seg prev)") << Vec2(-10.0, 25.0) << true << static_cast<int>(SectorTable::Side::SegPrev);
+    QTest::newRow("Test 5 (seg next)") << Vec2(200.0, 25.0) << true << static_cast<int>(SectorTable::Side::SegNext);
+    QTest::newRow("Test 6 (furthest side wins)") << Vec2(110.0, -40.0) << true << static_cast<int>(SectorTable::Side::Port);
+}
+
+//----------
+void SectorTableQTests::verify_exitSide()
+{
+    QFETCH(Vec2, pos);
+    QFETCH(bool, found_expect);
+    QFETCH(int, side_expect);
+
+    Plan planCurr, planRhs;
+    QVERIFY(planCurr.setPlan(QVector<Waypt>{Waypt(0.0, 0.0, 0.0, 0), Waypt(100.0, 0.0, 0.0, 1)}));
+    QVERIFY(planRhs.setPlan(QVector<Waypt>{Waypt(0.0, 50.0, 0.0, 0), Waypt(150.0, 50.0, 0.0, 1)}));
+    SectorTable sectorTable;
+    sectorTable.build(QVector<SegmentArrays>{SegmentArrays(planCurr), SegmentArrays(planRhs)});
+
+    SectorTable::Side side;
+    bool found = sectorTable.exitSide(0, pos, side);
+    QCOMPARE(found, found_expect);
+    if(found){
+        QCOMPARE(static_cast<int>(side), side_expect);
+    }
+}
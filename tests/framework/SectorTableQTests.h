@@ -0,0 +1,24 @@
+#ifndef RRTPLANNER_LIB_SECTORTABLEQTESTS_H
+#define RRTPLANNER_LIB_SECTORTABLEQTESTS_H
+
+#include <QObject>
+
+class SectorTableQTests : public QObject
+{
+    Q_OBJECT
+
+public:
+    SectorTableQTests();
+    ~SectorTableQTests();
+
+private slots:
+    void verify_build();
+    void verify_contains_data();
+    void verify_contains();
+    void verify_contains_vs_gjk();
+    void verify_neighbours();
+    void verify_exitSide_data();
+    void verify_exitSide();
+};
+
+#endif
@@ -0,0 +1,70 @@
+#include "SegmentArraysQTests.h"
+#include <RrtPlannerLib/framework/SegmentArrays.h>
+#include <RrtPlannerLib/framework/Plan.h>
+#include <RrtPlannerLib/framework/FrameworkDefines.h>
+#include <QtTest/QtTest>
+#include <QtGlobal>
+
+using namespace rrtplanner::framework;
+
+//----------
+SegmentArraysQTests::SegmentArraysQTests()
+{
+
+}
+
+//----------
+SegmentArraysQTests::~SegmentArraysQTests()
+{
+
+}
+
+//----------
+void SegmentArraysQTests::verify_set_data()
+{
+    QTest::addColumn<QVector<Waypt>>("wayptList");
+    QTest::addColumn<double>("crossTrack");
+
+    QVector<Waypt> wayptList;
+    wayptList.append(Waypt(0, 0, 103, 0));
+    wayptList.append(Waypt(1000, 1000, 103, 1));
+    wayptList.append(Waypt(2000, 1000, 103, 2));
+    wayptList.append(Waypt(3000, 0, 103, 3));
+    wayptList.append(Waypt(4000, 0, 103, 3));
+    QTest::newRow("Test 1 (4 segments)") << wayptList << (double)10.0;
+
+    wayptList = QVector<Waypt>{Waypt(0, 0, 103, 0), Waypt(500, 0, 103, 1)};
+    QTest::newRow("Test 2 (single segment)") << wayptList << (double)-25.0;
+}
+
+//----------
+void SegmentArraysQTests::verify_set()
+{
+    QFETCH(QVector<Waypt>, wayptList);
+    QFETCH(double, crossTrack);
+
+    Plan plan;
+    QVERIFY(plan.setPlan(wayptList));
+    plan.setCrossTrack(crossTrack);
+
+    SegmentArrays segArrays(plan);
+    QCOMPARE(segArrays.size(), plan.nSegment());
+    QCOMPARE(segArrays.crossTrack(), crossTrack);
+
+    //arrays are a copy, so values are expected to be identical
+    for(int i = 0; i < plan.nSegment(); ++i){
+        const Segment& seg = plan.segmentList().at(i);
+        QVERIFY(segArrays.nodePrev(i) == seg.wayptPrev().coord_const_ref());
+        QVERIFY(segArrays.nodeNext(i) == seg.wayptNext().coord_const_ref());
+        QVERIFY(segArrays.tVec(i) == seg.tVec());
+        QVERIFY(segArrays.nVec(i) == seg.nVec());
+        QVERIFY(segArrays.bVecPrev(i) == seg.bVecPrev());
+        QVERIFY(segArrays.bVecNext(i) == seg.bVecNext());
+        QCOMPARE(segArrays.length(i), seg.length());
+        QCOMPARE(segArrays.lengthCumulative(i), seg.lengthCumulative());
+        QCOMPARE(segArrays.lengthCumulativePrev(i), i > 0? plan.segmentList().at(i - 1).lengthCumulative() : 0.0);
+    }
+
+    segArrays.clear();
+    QCOMPARE(segArrays.size(), 0);
+}
@@ -0,0 +1,19 @@
+#ifndef RRTPLANNER_LIB_SEGMENTARRAYSQTESTS_H
+#define RRTPLANNER_LIB_SEGMENTARRAYSQTESTS_H
+
+#include <QObject>
+
+class SegmentArraysQTests : public QObject
+{
+    Q_OBJECT
+
+public:
+    SegmentArraysQTests();
+    ~SegmentArraysQTests();
+
+private slots:
+    void verify_set_data();
+    void verify_set();
+};
+
+#endif
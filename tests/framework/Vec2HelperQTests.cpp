@@ -0,0 +1,102 @@
+#include "Vec2HelperQTests.h"
+#include <RrtPlannerLib/framework/Vec2Helper.h>
+#include <RrtPlannerLib/framework/UblasHelper.h>
+#include <RrtPlannerLib/framework/VectorF.h>
+#include <RrtPlannerLib/framework/FrameworkDefines.h>
+#include <QtTest/QtTest>
+#include <QtGlobal>
+
+using namespace rrtplanner::framework;
+namespace bnu = boost::numeric::ublas;
+
+//----------
+Vec2HelperQTests::Vec2HelperQTests()
+{
+
+}
+
+//----------
+Vec2HelperQTests::~Vec2HelperQTests()
+{
+
+}
+
+//----------
+void Vec2HelperQTests::verify_solve_data()
+{
+    QTest::addColumn<Vec2>("col0");
+    QTest::addColumn<Vec2>("col1");
+    QTest::addColumn<Vec2>("y");
+    QTest::addColumn<Vec2>("x_expect");
+    QTest::addColumn<bool>("res_expect");
+
+    //same system as UblasHelperQTests "Test - dim 2"
+    QTest::newRow("Test 1") << Vec2{1.0, 5.0} << Vec2{-3.0, 2.0} << Vec2{4.0, -2.0} << Vec2{0.117647, -1.294118} << true;
+
+    //orthonormal columns => x are the components along the columns
+    QTest::newRow("Test 2 (orthonormal)") << Vec2{0.6, 0.8} << Vec2{-0.8, 0.6} << Vec2{3.0, 4.0} << Vec2{5.0, 0.0} << true;
+
+    //singular
+    QTest::newRow("Test 3 (singular)") << Vec2{1.0, 2.0} << Vec2{-2.0, -4.0} << Vec2{1.0, 1.0} << Vec2{} << false;
+    QTest::newRow("Test 4 (zero column)") << Vec2{1.0, 2.0} << Vec2{} << Vec2{1.0, 1.0} << Vec2{} << false;
+}
+
+//----------
+void Vec2HelperQTests::verify_solve()
+{
+    QFETCH(Vec2, col0);
+    QFETCH(Vec2, col1);
+    QFETCH(Vec2, y);
+    QFETCH(Vec2, x_expect);
+    QFETCH(bool, res_expect);
+
+    Vec2 x;
+    bool res = Vec2Helper::solve(col0, col1, y, TOL_SMALL, x);
+    QCOMPARE(res, res_expect);
+
+    //consistent with the general ublas solver
+    bnu::matrix<double> M = UblasHelper::concatenate_col_vectors(VectorF(col0).data_const_ref(),
+                                                                 VectorF(col1).data_const_ref());
+    bnu::vector<double> x_ublas;
+    bool res_ublas = UblasHelper::solve(M, VectorF(y).data_const_ref(), TOL_SMALL, x_ublas);
+    QCOMPARE(res, res_ublas);
+
+    if(res){
+        QVERIFY(x.compare(x_expect, 1e-6));
+        QVERIFY(x.compare(Vec2(x_ublas[0], x_ublas[1]), 1e-12));
+    }
+}
+
+//----------
+void Vec2HelperQTests::verify_intersectLines_data()
+{
+    QTest::addColumn<Vec2>("p0");
+    QTest::addColumn<Vec2>("d0");
+    QTest::addColumn<Vec2>("p1");
+    QTest::addColumn<Vec2>("d1");
+    QTest::addColumn<Vec2>("posIntersect_expect");
+    QTest::addColumn<bool>("res_expect");
+
+    QTest::newRow("Test 1 (perpendicular)") << Vec2{0.0, 0.0} << Vec2{1.0, 0.0} << Vec2{5.0, -3.0} << Vec2{0.0, 2.0} << Vec2{5.0, 0.0} << true;
+    QTest::newRow("Test 2 (bisectors)") << Vec2{0.0, 0.0} << Vec2{0.707107, 0.707107} << Vec2{1000.0, 0.0} << Vec2{-0.707107, 0.707107} << Vec2{500.0, 500.0} << true;
+    QTest::newRow("Test 3 (parallel)") << Vec2{0.0, 0.0} << Vec2{1.0, 1.0} << Vec2{0.0, 1.0} << Vec2{2.0, 2.0} << Vec2{} << false;
+}
+
+//----------
+void Vec2HelperQTests::verify_intersectLines()
+{
+    QFETCH(Vec2, p0);
+    QFETCH(Vec2, d0);
+    QFETCH(Vec2, p1);
+    QFETCH(Vec2, d1);
+    QFETCH(Vec2, posIntersect_expect);
+    QFETCH(bool, res_expect);
+
+    Vec2 s;
+    bool res = Vec2Helper::intersectLines(p0, d0, p1, d1, TOL_SMALL, s);
+    QCOMPARE(res, res_expect);
+    if(res){
+        QVERIFY((p0 + s[0]*d0).compare(posIntersect_expect, 1e-3));
+        QVERIFY((p1 + s[1]*d1).compare(posIntersect_expect, 1e-3));
+    }
+}
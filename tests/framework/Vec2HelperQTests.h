@@ -0,0 +1,21 @@
+#ifndef RRTPLANNER_LIB_VEC2HELPERQTESTS_H
+#define RRTPLANNER_LIB_VEC2HELPERQTESTS_H
+
+#include <QObject>
+
+class Vec2HelperQTests : public QObject
+{
+    Q_OBJECT
+
+public:
+    Vec2HelperQTests();
+    ~Vec2HelperQTests();
+
+private slots:
+    void verify_solve_data();
+    void verify_solve();
+    void verify_intersectLines_data();
+    void verify_intersectLines();
+};
+
+#endif
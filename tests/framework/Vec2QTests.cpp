@@ -0,0 +1,96 @@
+#include "Vec2QTests.h"
+#include <RrtPlannerLib/framework/Vec2.h>
+#include <RrtPlannerLib/framework/VectorF.h>
+#include <RrtPlannerLib/framework/VectorFHelper.h>
+#include <RrtPlannerLib/framework/FrameworkDefines.h>
+#include <QtTest/QtTest>
+#include <QtGlobal>
+#include <type_traits>
+
+using namespace rrtplanner::framework;
+
+//----------
+Vec2QTests::Vec2QTests()
+{
+
+}
+
+//----------
+Vec2QTests::~Vec2QTests()
+{
+
+}
+
+//----------
+void Vec2QTests::verify_constructors()
+{
+    QVERIFY(std::is_trivially_copyable<Vec2>::value);
+
+    Vec2 v1;
+    QCOMPARE(v1.size(), 2);
+    QCOMPARE(v1[IDX_NORTHING], 0.0);
+    QCOMPARE(v1[IDX_EASTING], 0.0);
+
+    constexpr Vec2 v2{1.5, -2.5};
+    static_assert(v2[0] == 1.5 && v2.at(1) == -2.5, "Vec2 is expected to be usable in constant expressions");
+    QCOMPARE(v2[IDX_NORTHING], 1.5);
+    QCOMPARE(v2[IDX_EASTING], -2.5);
+
+    Vec2 v3 = v2;
+    v3[IDX_EASTING] = 4.0;
+    QCOMPARE(v2[IDX_EASTING], -2.5);
+    QCOMPARE(v3[IDX_EASTING], 4.0);
+}
+
+//----------
+void Vec2QTests::verify_arithmetic()
+{
+    const Vec2 a{1.0, 2.0};
+    const Vec2 b{-3.0, 0.5};
+
+    QVERIFY((a + b) == Vec2(-2.0, 2.5));
+    QVERIFY((a - b) == Vec2(4.0, 1.5));
+    QVERIFY((a * 2.0) == Vec2(2.0, 4.0));
+    QVERIFY((2.0 * a) == Vec2(2.0, 4.0));
+    QVERIFY(-a == Vec2(-1.0, -2.0));
+
+    Vec2 c = a;
+    c += b;
+    QVERIFY(c == Vec2(-2.0, 2.5));
+    c -= b;
+    QVERIFY(c == a);
+    c *= -1.0;
+    QVERIFY(c == -a);
+}
+
+//----------
+void Vec2QTests::verify_products()
+{
+    const double tol = 1e-12;
+    const Vec2 a{3.0, 4.0};
+    const Vec2 b{-1.0, 2.0};
+
+    //compare against VectorFHelper results
+    QVERIFY(abs(a.dot(b) - VectorFHelper::dot_product(VectorF{3.0, 4.0}, VectorF{-1.0, 2.0})) < tol);
+    QVERIFY(abs(a.cross_zVal(b) - VectorFHelper::cross_product_zVal(VectorF{3.0, 4.0}, VectorF{-1.0, 2.0})) < tol);
+    QVERIFY(VectorFHelper::compare(a.cross_z(), VectorFHelper::vec2D_cross_z(VectorF{3.0, 4.0}), tol));
+    QVERIFY(abs(a.norm2() - 5.0) < tol);
+    QVERIFY(abs(a.norm2_square() - 25.0) < tol);
+
+    QVERIFY(a.compare(Vec2(3.0, 4.0 + 0.5*TOL_SMALL), TOL_SMALL));
+    QVERIFY(!a.compare(Vec2(3.0, 4.0 + 2.0*TOL_SMALL), TOL_SMALL));
+}
+
+//----------
+void Vec2QTests::verify_vectorF_conversion()
+{
+    const Vec2 a{7.0, -8.0};
+    VectorF vf = a;
+    QCOMPARE(vf.size(), 2);
+    QCOMPARE(vf[IDX_NORTHING], 7.0);
+    QCOMPARE(vf[IDX_EASTING], -8.0);
+
+    vf[IDX_NORTHING] = 1.0;
+    Vec2 b = vf;
+    QVERIFY(b == Vec2(1.0, -8.0));
+}
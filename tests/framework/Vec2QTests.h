@@ -0,0 +1,21 @@
+#ifndef RRTPLANNER_LIB_VEC2QTESTS_H
+#define RRTPLANNER_LIB_VEC2QTESTS_H
+
+#include <QObject>
+
+class Vec2QTests : public QObject
+{
+    Q_OBJECT
+
+public:
+    Vec2QTests();
+    ~Vec2QTests();
+
+private slots:
+    void verify_constructors();
+    void verify_arithmetic();
+    void verify_products();
+    void verify_vectorF_conversion();
+};
+
+#endif
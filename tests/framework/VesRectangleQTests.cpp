@@ -52,6 +52,7 @@ void VesRectangleQTests::verify_constructor()
     QVERIFY(UtilHelper::compare(diff, 0.0, 1e-3));
 
     VesRectangle r2;
+    QCOMPARE(r2.rotation(), 0.0);
     r2.setDimensions(length, width);
     QCOMPARE(r2.length(), length);
     QCOMPARE(r2.width(), width);
@@ -0,0 +1,181 @@
+#include "CSpaceObstacleSetQTests.h"
+#include "TestScenario.h"
+#include <RrtPlannerLib/framework/algorithm/gjk/CSpaceObstacleSet.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/GjkKernel.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/Polygon.h>
+#include <RrtPlannerLib/framework/VesRectangle.h>
+#include <RrtPlannerLib/framework/VectorF.h>
+#include <RrtPlannerLib/framework/FrameworkDefines.h>
+#include <QtTest/QtTest>
+#include <QtGlobal>
+#include <cmath>
+#include <math.h> //for M_PI
+
+
+using namespace rrtplanner::framework;
+using namespace rrtplanner::framework::algorithm::gjk;
+
+namespace {
+    //footprint of a VesRectangle in vessel coordinates (u, v)
+    Polygon hullFootprint(double length, double width, const Vec2& offset, double rotation)
+    {
+        VesRectangle hull(length, width);
+        hull.setOffset(VectorF{offset[0], offset[1]});
+        hull.setRotation(rotation);
+        Polygon ret;
+        for(const VectorF& pt: hull.polygon()){
+            ret.vertexList().append(Vec2(pt.at(IDX_U), pt.at(IDX_V)));
+        }
+        return(ret);
+    }
+}
+
+//----------
+CSpaceObstacleSetQTests::CSpaceObstacleSetQTests()
+{
+
+}
+
+//----------
+CSpaceObstacleSetQTests::~CSpaceObstacleSetQTests()
+{
+    cleanUp();
+}
+
+//----------
+void CSpaceObstacleSetQTests::setup()
+{
+
+}
+
+//----------
+void CSpaceObstacleSetQTests::cleanUp()
+{
+
+}
+
+//----------
+void CSpaceObstacleSetQTests::verify_append()
+{
+    //point footprint: the C-space obstacle is the obstacle itself, counter-clockwise from its smallest vertex
+    CSpaceObstacleSet cSpace;
+    QCOMPARE(cSpace.size(), 0);
+    QCOMPARE(cSpace.nHeadingBucket(), CSPACE_HEADING_BUCKETS);
+
+    Polygon box{Vec2(2.0, 1.0), Vec2(0.0, 1.0), Vec2(0.0, 0.0), Vec2(1.0, 0.0), Vec2(2.0, 0.0)};
+    QCOMPARE(cSpace.append(box), 0);
+    QCOMPARE(cSpace.append(QVector<Vec2>{Vec2(5.0, 5.0)}), 1);
+    QCOMPARE(cSpace.size(), 2);
+    for(int b: {0, cSpace.nHeadingBucket() - 1}){
+        QCOMPARE(cSpace.cObstacle(0, b), (QVector<Vec2>{Vec2(0.0, 0.0), Vec2(2.0, 0.0), Vec2(2.0, 1.0), Vec2(0.0, 1.0)}));
+        QCOMPARE(cSpace.cObstacle(1, b), (QVector<Vec2>{Vec2(5.0, 5.0)}));
+    }
+
+    QCOMPARE(cSpace.headingBucket(0.0), 0);
+    QCOMPARE(cSpace.headingBucket(7.0), 1);
+    QCOMPARE(cSpace.headingBucket(367.0), 1);
+    QCOMPARE(cSpace.headingBucket(-1.0), cSpace.nHeadingBucket() - 1);
+    QCOMPARE(cSpace.headingBucket(360.0), 0);
+
+    //copies are independent
+    CSpaceObstacleSet copy(cSpace);
+    copy.append(box);
+    QCOMPARE(copy.size(), 3);
+    QCOMPARE(cSpace.size(), 2);
+
+    cSpace.clear();
+    QCOMPARE(cSpace.size(), 0);
+    QVector<int> hitIdxList{7};
+    QCOMPARE(cSpace.chkIntersect(GjkPose{Vec2(1.0, 0.5), 0.0}, hitIdxList), 0);
+    QVERIFY(hitIdxList.isEmpty());
+    QVERIFY(!cSpace.chkIntersect(GjkPose{Vec2(1.0, 0.5), 0.0}));
+}
+
+//----------
+void CSpaceObstacleSetQTests::verify_chkIntersect_data()
+{
+    QTest::addColumn<Polygon>("footprint");
+    QTest::addColumn<int>("nHeadingBucket");
+    QTest::addColumn<Polygon>("obstacle");
+
+    Polygon hull = hullFootprint(20.0, 6.0, Vec2(0.0, 0.0), 0.0);
+    Polygon hullOffset = hullFootprint(20.0, 6.0, Vec2(4.0, 1.0), 10.0);
+    Polygon box{Vec2(50.0, -5.0), Vec2(60.0, -5.0), Vec2(60.0, 5.0), Vec2(50.0, 5.0)};
+
+    QTest::newRow("hull, box") << hull << CSPACE_HEADING_BUCKETS << box;
+    QTest::newRow("hull, box, coarse buckets") << hull << 8 << box;
+    QTest::newRow("hull, point") << hull << CSPACE_HEADING_BUCKETS << Polygon{Vec2(20.0, 30.0)};
+    QTest::newRow("hull, segment") << hull << 36 << Polygon{Vec2(20.0, 30.0), Vec2(35.0, 22.0)};
+    QTest::newRow("offset hull, 64-gon") << hullOffset << CSPACE_HEADING_BUCKETS
+                                         << TestScenario::regularPolygon(64, 25.0, Vec2(-40.0, 10.0), 0.1);
+    QTest::newRow("triangle footprint, unordered obstacle") << Polygon{Vec2(-8.0, -3.0), Vec2(-8.0, 3.0), Vec2(10.0, 0.0)} << 24
+                                                            << Polygon{Vec2(5.0, 5.0), Vec2(-5.0, -5.0), Vec2(5.0, -5.0), Vec2(-5.0, 5.0), Vec2(0.0, 0.0)};
+    QTest::newRow("point footprint") << Polygon{Vec2(0.0, 0.0)} << CSPACE_HEADING_BUCKETS << box;
+}
+
+//----------
+void CSpaceObstacleSetQTests::verify_chkIntersect()
+{
+    QFETCH(Polygon, footprint);
+    QFETCH(int, nHeadingBucket);
+    QFETCH(Polygon, obstacle);
+
+    //the obstacle among others far away, which the bounding boxes cull
+    CSpaceObstacleSet cSpace(footprint.vertexList_const_ref(), nHeadingBucket);
+    cSpace.append(TestScenario::regularPolygon(5, 4.0, Vec2(1000.0, 1000.0), 0.0));
+    int idx = cSpace.append(obstacle);
+    cSpace.append(TestScenario::regularPolygon(7, 6.0, Vec2(-1000.0, 500.0), 0.3));
+    QCOMPARE(cSpace.nHeadingBucket(), nHeadingBucket);
+
+    //a pose may be reported up to 2 rMax sin(half bucket width) away from the obstacle, and must be if intersecting
+    double rMax = 0.0;
+    for(const Vec2& uv: footprint.vertexList_const_ref()){
+        rMax = std::max(rMax, uv.norm2());
+    }
+    double distanceMax = 2.0 * rMax * std::sin(M_PI / nHeadingBucket) + 1e-6;
+
+    const Vec2 centre = obstacle.centroid();
+    const double halfSpan = rMax + 30.0;
+    const int nGrid = 41;
+    ConvexView footprintView(footprint.vertexList_const_ref().constData(), footprint.vertexList_const_ref().size());
+    ConvexView obstacleView(obstacle.vertexList_const_ref().constData(), obstacle.vertexList_const_ref().size());
+    int nHit = 0, nMiss = 0;
+    for(int i = 0; i < nGrid; ++i){
+        for(int j = 0; j < nGrid; ++j){
+            GjkPose pose{centre + Vec2(halfSpan * (2.0 * i / (nGrid - 1) - 1.0), halfSpan * (2.0 * j / (nGrid - 1) - 1.0)),
+                         std::fmod(37.3 * (i * nGrid + j), 720.0) - 360.0};
+
+            GjkContact contact;
+            bool isIntersect = intersectContact(PoseView<ConvexView>(footprintView, pose), obstacleView, contact);
+            QVector<int> hitIdxList;
+            int nHitPose = cSpace.chkIntersect(pose, hitIdxList);
+            QCOMPARE(cSpace.chkIntersect(pose), nHitPose > 0);
+            QVERIFY(nHitPose == 0 || hitIdxList == QVector<int>{idx});
+            if(isIntersect){
+                QVERIFY(nHitPose == 1);
+            }
+            else if(contact.distance > distanceMax){
+                QVERIFY(nHitPose == 0);
+            }
+            nHit += nHitPose;
+            nMiss += nHitPose == 0? 1 : 0;
+        }
+    }
+    QVERIFY(nHit > 0);
+    QVERIFY(nMiss > 0);
+
+    //footprint vertex on an obstacle vertex within a bucket, where the arc of the footprint vertex bulges most
+    double bucketWidth = 360.0 / nHeadingBucket;
+    for(const Vec2& uv: footprint.vertexList_const_ref()){
+        for(const Vec2& vertex: obstacle.vertexList_const_ref()){
+            for(int b = 0; b < nHeadingBucket; b += 3){
+                for(double fraction: {0.25, 0.5}){
+                    double heading = (b + fraction) * bucketWidth;
+                    GjkPose pose{Vec2(0.0, 0.0), heading};
+                    pose.position = vertex - pose.toWorld(uv);
+                    QVERIFY(cSpace.chkIntersect(pose));
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,25 @@
+#ifndef RRTPLANNER_LIB_CSPACEOBSTACLESETQTESTS_H
+#define RRTPLANNER_LIB_CSPACEOBSTACLESETQTESTS_H
+
+#include <QObject>
+#include <QScopedPointer>
+
+class CSpaceObstacleSetQTests : public QObject
+{
+    Q_OBJECT
+
+public:
+    CSpaceObstacleSetQTests();
+    ~CSpaceObstacleSetQTests();
+
+private:
+    void setup();
+    void cleanUp();
+
+private slots:
+    void verify_append();
+    void verify_chkIntersect_data();
+    void verify_chkIntersect();
+};
+
+#endif
@@ -0,0 +1,163 @@
+#include "ConvexPolygonQTests.h"
+#include "TestScenario.h"
+#include <RrtPlannerLib/framework/algorithm/gjk/ConvexPolygon.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/Polygon.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/Gjk.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/GjkFactory.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/GjkKernel.h>
+#include <RrtPlannerLib/framework/UtilHelper.h>
+#include <QtTest/QtTest>
+#include <QtGlobal>
+#include <cmath>
+
+
+using namespace rrtplanner::framework;
+using namespace rrtplanner::framework::algorithm::gjk;
+
+//----------
+ConvexPolygonQTests::ConvexPolygonQTests()
+{
+
+}
+
+//----------
+ConvexPolygonQTests::~ConvexPolygonQTests()
+{
+    cleanUp();
+}
+
+//----------
+void ConvexPolygonQTests::setup()
+{
+
+}
+
+//----------
+void ConvexPolygonQTests::cleanUp()
+{
+
+}
+
+//----------
+void ConvexPolygonQTests::verify_construct_data()
+{
+    QTest::addColumn<QVector<Vec2>>("vertexList");
+    QTest::addColumn<bool>("isConvex_expect");
+    QTest::addColumn<int>("size_expect");
+
+    QVector<Vec2> square{Vec2(0.0, 0.0), Vec2(1.0, 0.0), Vec2(1.0, 1.0), Vec2(0.0, 1.0)};
+    QTest::newRow("ccw") << square << true << 4;
+    QTest::newRow("closed") << QVector<Vec2>{square.at(0), square.at(1), square.at(2), square.at(3), square.at(0)} << true << 4;
+    QTest::newRow("cw") << QVector<Vec2>{square.at(3), square.at(2), square.at(1), square.at(0)} << true << 4;
+    QTest::newRow("collinear") << QVector<Vec2>{Vec2(0.0, 0.0), Vec2(0.5, 0.0), Vec2(1.0, 0.0), Vec2(1.0, 1.0), Vec2(0.0, 1.0), Vec2(0.0, 0.5)} << true << 4;
+    QTest::newRow("repeated") << QVector<Vec2>{Vec2(0.0, 0.0), Vec2(1.0, 0.0), Vec2(1.0, 0.0), Vec2(1.0, 1.0), Vec2(0.0, 1.0)} << true << 4;
+    QTest::newRow("non-convex") << QVector<Vec2>{Vec2(0.0, 0.0), Vec2(1.0, 0.0), Vec2(0.2, 0.2), Vec2(0.0, 1.0)} << false << 4;
+    QTest::newRow("winds twice") << QVector<Vec2>{Vec2(1.0, 0.0), Vec2(-0.81, 0.59), Vec2(0.31, -0.95), Vec2(0.31, 0.95), Vec2(-0.81, -0.59)} << false << 5;
+    QTest::newRow("segment") << QVector<Vec2>{Vec2(0.0, 0.0), Vec2(1.0, 0.0)} << false << 2;
+}
+
+//----------
+void ConvexPolygonQTests::verify_construct()
+{
+    QFETCH(QVector<Vec2>, vertexList);
+    QFETCH(bool, isConvex_expect);
+    QFETCH(int, size_expect);
+
+    ConvexPolygon polygon(vertexList);
+    QCOMPARE(polygon.isConvex(), isConvex_expect);
+    QCOMPARE(polygon.size(), size_expect);
+    if(polygon.isConvex()){
+        for(int i = 0; i < polygon.size(); ++i){ //ccw
+            const Vec2& a = polygon.at(i);
+            const Vec2& b = polygon.at((i + 1) % polygon.size());
+            const Vec2& c = polygon.at((i + 2) % polygon.size());
+            QVERIFY((b - a).cross_zVal(c - b) > 0.0);
+        }
+    }
+}
+
+//----------
+void ConvexPolygonQTests::verify_support_data()
+{
+    QTest::addColumn<QVector<Vec2>>("vertexList");
+    QTest::addColumn<double>("dAngle");
+
+    for(int nVertex: {3, 4, 7, 50, 500}){
+        QVector<Vec2> vertexList = TestScenario::regularPolygon(nVertex, 10.0 + nVertex, Vec2(100.0, -40.0)).vertexList();
+        for(double dAngle: {0.01, 0.37, 2.9}){ //small steps => warm start, large steps => binary search
+            QTest::newRow(qPrintable(QString("n=%1;dAngle=%2").arg(nVertex).arg(dAngle))) << vertexList << dAngle;
+        }
+    }
+    //irregular hull, with the angle search starting at a short edge
+    QTest::newRow("irregular") << QVector<Vec2>{Vec2(0.0, 0.0), Vec2(1e-3, -1.0), Vec2(50.0, -20.0), Vec2(200.0, 0.0),
+                                                Vec2(150.0, 90.0), Vec2(10.0, 60.0)} << 0.13;
+}
+
+//----------
+void ConvexPolygonQTests::verify_support()
+{
+    QFETCH(QVector<Vec2>, vertexList);
+    QFETCH(double, dAngle);
+
+    Polygon polygon;
+    polygon.vertexList() = vertexList;
+    ConvexPolygon convexPolygon(vertexList);
+    QVERIFY(convexPolygon.isConvex());
+
+    //support vertices may differ on ties, their projections may not
+    for(int k = 0; k < 2000; ++k){
+        double angle = k * dAngle;
+        Vec2 dir(std::cos(angle), std::sin(angle));
+        double val = convexPolygon.support(dir).dot(dir);
+        double val_expect = polygon.support(dir).dot(dir);
+        QVERIFY2(std::abs(val - val_expect) < 1e-9 * (1.0 + std::abs(val_expect)),
+                 qPrintable(QString("k=%1: %2 vs %3").arg(k).arg(val, 0, 'g', 17).arg(val_expect, 0, 'g', 17)));
+    }
+}
+
+//----------
+void ConvexPolygonQTests::verify_chkIntersect_data()
+{
+    QTest::addColumn<QVector<Vec2>>("vertexList1");
+    QTest::addColumn<QVector<Vec2>>("vertexList2");
+
+    for(int nVertex: {4, 64, 300}){
+        QVector<Vec2> vertexList1 = TestScenario::regularPolygon(nVertex, 10.0, Vec2(0.0, 0.0)).vertexList();
+        for(double offset: {25.0, 19.0, 5.0}){
+            QVector<Vec2> vertexList2 = TestScenario::regularPolygon(nVertex, 10.0, Vec2(offset, 3.0)).vertexList();
+            QTest::newRow(qPrintable(QString("n=%1;offset=%2").arg(nVertex).arg(offset))) << vertexList1 << vertexList2;
+        }
+    }
+}
+
+//----------
+void ConvexPolygonQTests::verify_chkIntersect()
+{
+    QFETCH(QVector<Vec2>, vertexList1);
+    QFETCH(QVector<Vec2>, vertexList2);
+
+    Polygon polygon1, polygon2;
+    polygon1.vertexList() = vertexList1;
+    polygon2.vertexList() = vertexList2;
+    ConvexPolygon convexPolygon1(vertexList1);
+    ConvexPolygon convexPolygon2(vertexList2);
+
+    QScopedPointer<Gjk> p_gjk(GjkFactory::getGjk(GjkFactory::GjkType::MinDist));
+    double distance_expect, distance;
+    bool isValidDistance_expect, isValidDistance;
+    bool intersect_expect = p_gjk->chkIntersect(polygon1, polygon2, distance_expect, isValidDistance_expect);
+
+    bool isIntersect = p_gjk->chkIntersect(convexPolygon1, convexPolygon2, distance, isValidDistance);
+    QCOMPARE(isIntersect, intersect_expect);
+    QCOMPARE(isValidDistance, isValidDistance_expect);
+    if(isValidDistance){
+        QVERIFY(UtilHelper::compare(distance, distance_expect, 1e-9));
+    }
+
+    isIntersect = intersectMinDist(convexPolygon1, convexPolygon2, distance, isValidDistance);
+    QCOMPARE(isIntersect, intersect_expect);
+    QCOMPARE(isValidDistance, isValidDistance_expect);
+    if(isValidDistance){
+        QVERIFY(UtilHelper::compare(distance, distance_expect, 1e-9));
+    }
+}
@@ -0,0 +1,28 @@
+#ifndef RRTPLANNER_LIB_CONVEXPOLYGONQTESTS_H
+#define RRTPLANNER_LIB_CONVEXPOLYGONQTESTS_H
+
+#include <QObject>
+#include <QScopedPointer>
+
+class ConvexPolygonQTests : public QObject
+{
+    Q_OBJECT
+
+public:
+    ConvexPolygonQTests();
+    ~ConvexPolygonQTests();
+
+private:
+    void setup();
+    void cleanUp();
+
+private slots:
+    void verify_construct_data();
+    void verify_construct();
+    void verify_support_data();
+    void verify_support();
+    void verify_chkIntersect_data();
+    void verify_chkIntersect();
+};
+
+#endif
@@ -0,0 +1,117 @@
+#include "GjkBatchQTests.h"
+#include "TestScenario.h"
+#include <RrtPlannerLib/framework/algorithm/gjk/GjkBatch.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/Polygon.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/Gjk.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/GjkFactory.h>
+#include <QtTest/QtTest>
+#include <QtGlobal>
+#include <cmath>
+
+
+using namespace rrtplanner::framework;
+using namespace rrtplanner::framework::algorithm::gjk;
+
+//----------
+GjkBatchQTests::GjkBatchQTests()
+{
+
+}
+
+//----------
+GjkBatchQTests::~GjkBatchQTests()
+{
+    cleanUp();
+}
+
+//----------
+void GjkBatchQTests::setup()
+{
+
+}
+
+//----------
+void GjkBatchQTests::cleanUp()
+{
+
+}
+
+//----------
+void GjkBatchQTests::verify_append()
+{
+    GjkBatch batch;
+    QCOMPARE(batch.size(), 0);
+
+    Polygon triangle{Vec2(0.0, 0.0), Vec2(1.0, 0.0), Vec2(0.0, 1.0)};
+    QCOMPARE(batch.append(triangle, triangle), 0);
+    QCOMPARE(batch.append(QVector<Vec2>{Vec2(5.0, 5.0)}, triangle.vertexList_const_ref()), 1);
+    QCOMPARE(batch.size(), 2);
+
+    QVector<bool> isIntersectList;
+    batch.chkIntersect(isIntersectList);
+    QCOMPARE(isIntersectList, (QVector<bool>{true, false}));
+
+    batch.clear();
+    QCOMPARE(batch.size(), 0);
+    batch.chkIntersect(isIntersectList);
+    QVERIFY(isIntersectList.isEmpty());
+}
+
+//----------
+void GjkBatchQTests::verify_chkIntersect_data()
+{
+    QTest::addColumn<int>("nPair");
+    QTest::addColumn<int>("nVertexMax");
+    QTest::addColumn<double>("spread"); //[m] centres of the second shapes within this of the first ones
+    QTest::addColumn<bool>("hasIntersect_expect"); //some of the pairs intersect
+
+    QTest::newRow("one pair") << 1 << 4 << 10.0 << false;
+    QTest::newRow("partial group") << 7 << 6 << 10.0 << true;
+    QTest::newRow("mixed sizes") << 203 << 12 << 15.0 << true;
+    QTest::newRow("points and segments") << 101 << 2 << 3.0 << false;
+    QTest::newRow("far apart") << 64 << 8 << 1000.0 << false;
+}
+
+//----------
+void GjkBatchQTests::verify_chkIntersect()
+{
+    //reference: GjkBasic and GjkMinDist pair by pair, results have to be the same to the last bit
+    QFETCH(int, nPair);
+    QFETCH(int, nVertexMax);
+    QFETCH(double, spread);
+    QFETCH(bool, hasIntersect_expect);
+
+    QVector<Polygon> shape1List, shape2List;
+    GjkBatch batch;
+    for(int i = 0; i < nPair; ++i){
+        int n1 = 1 + (i * 7) % nVertexMax;
+        int n2 = 1 + (i * 5 + 3) % nVertexMax;
+        Vec2 offset(spread * std::sin(1.3 * i), spread * std::cos(0.7 * i));
+        shape1List.append(TestScenario::ellipsePolygon(n1, 4.0 + i % 3, 2.0, Vec2(100.0, -50.0), 0.37 * i));
+        shape2List.append(TestScenario::ellipsePolygon(n2, 3.0, 1.0 + i % 4, Vec2(100.0, -50.0) + offset, 0.11 * i));
+        QCOMPARE(batch.append(shape1List.last(), shape2List.last()), i);
+    }
+
+    QVector<bool> isIntersectList;
+    batch.chkIntersect(isIntersectList);
+    QVector<bool> isIntersectList_minDist;
+    QVector<double> distanceList;
+    QVector<bool> isValidDistanceList;
+    batch.chkIntersect(isIntersectList_minDist, distanceList, isValidDistanceList);
+    QCOMPARE(isIntersectList.size(), nPair);
+    QCOMPARE(distanceList.size(), nPair);
+
+    QScopedPointer<Gjk> p_gjkBasic(GjkFactory::getGjk(GjkFactory::GjkType::Basic));
+    QScopedPointer<Gjk> p_gjkMinDist(GjkFactory::getGjk(GjkFactory::GjkType::MinDist));
+    int nIntersect = 0;
+    for(int i = 0; i < nPair; ++i){
+        double distance;
+        bool isValidDistance;
+        QCOMPARE(isIntersectList.at(i), p_gjkBasic->chkIntersect(shape1List.at(i), shape2List.at(i), distance, isValidDistance));
+        QCOMPARE(isIntersectList_minDist.at(i), p_gjkMinDist->chkIntersect(shape1List.at(i), shape2List.at(i), distance, isValidDistance));
+        QCOMPARE(isValidDistanceList.at(i), isValidDistance);
+        QCOMPARE(distanceList.at(i), isValidDistance? distance : 0.0);
+        nIntersect += isIntersectList.at(i)? 1 : 0;
+    }
+    QCOMPARE(nIntersect > 0, hasIntersect_expect);
+}
@@ -0,0 +1,25 @@
+#ifndef RRTPLANNER_LIB_GJKBATCHQTESTS_H
+#define RRTPLANNER_LIB_GJKBATCHQTESTS_H
+
+#include <QObject>
+#include <QScopedPointer>
+
+class GjkBatchQTests : public QObject
+{
+    Q_OBJECT
+
+public:
+    GjkBatchQTests();
+    ~GjkBatchQTests();
+
+private:
+    void setup();
+    void cleanUp();
+
+private slots:
+    void verify_append();
+    void verify_chkIntersect_data();
+    void verify_chkIntersect();
+};
+
+#endif
@@ -1,6 +1,8 @@
 #include "GjkQTests.h"
 #include <RrtPlannerLib/framework/algorithm/gjk/GjkFactory.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/GjkKernel.h>
 #include <RrtPlannerLib/framework/algorithm/gjk/Polygon.h>
+#include <RrtPlannerLib/framework/VesRectangle.h>
 #include <RrtPlannerLib/framework/VectorF.h>
 #include <RrtPlannerLib/framework/VectorFHelper.h>
 #include <RrtPlannerLib/framework/FrameworkDefines.h>
@@ -8,11 +10,23 @@
 #include <QtTest/QtTest>
 #include <QtGlobal>
 
+namespace {
+    //unit square [0,1]x[0,1] moved by offset
+    Polygon shiftedSquare(const Vec2& offset)
+    {
+        Polygon ret{Vec2(0.0, 0.0), Vec2(1.0, 0.0), Vec2(1.0, 1.0), Vec2(0.0, 1.0)};
+        for(Vec2& vertex: ret.vertexList()){
+            vertex += offset;
+        }
+        return(ret);
+    }
+}
 
 //----------
 GjkQTests::GjkQTests()
     :mp_gjk(GjkFactory::getGjk(GjkFactory::GjkType::Basic)),
-      mp_gjkMinDist(GjkFactory::getGjk(GjkFactory::GjkType::MinDist))
+      mp_gjkMinDist(GjkFactory::getGjk(GjkFactory::GjkType::MinDist)),
+      mp_gjkEpa(GjkFactory::getGjk(GjkFactory::GjkType::Epa))
 {
 
 }
@@ -76,6 +90,14 @@ void GjkQTests::verify_chkIntersect_data()
     distance_valid_expect = false;
     QTest::newRow("Test 4 - intersect") << polygon1 << polygon2 << intersect_expect<< distance_expect << distance_valid_expect;
 
+    //test 5: the origin falls on the line of a simplex edge, outside the edge
+    polygon1 = Polygon{Vec2(3.5572508769558606, -0.26517738914010652), Vec2(-2.5995259151712693, 2.4427070773359989), Vec2(-1.1696114187445414, -3.3699201738997888)};
+    polygon2 = Polygon{Vec2(-4.173010904022223, -1.3780782624453831), Vec2(-4.9927284667129257, -0.83432583792915338), Vec2(-5.2075500546494968, -2.0216940492863857)};
+    intersect_expect = false;
+    distance_expect = 2.4406;
+    distance_valid_expect = true;
+    QTest::newRow("Test 5 - no intersect, origin on edge line") << polygon1 << polygon2 << intersect_expect<< distance_expect << distance_valid_expect;
+
 }
 
 //----------
@@ -103,3 +125,360 @@ void GjkQTests::verify_chkIntersect()
     }
 
 }
+
+//----------
+void GjkQTests::verify_kernel_data()
+{
+    verify_chkIntersect_data();
+}
+
+//----------
+void GjkQTests::verify_kernel()
+{
+    QFETCH(Polygon, polygon1);
+    QFETCH(Polygon, polygon2);
+    QFETCH(bool, intersect_expect);
+    QFETCH(double, distance_expect);
+    QFETCH(bool, distance_valid_expect);
+
+    const QVector<Vec2>& vertexList1 = polygon1.vertexList_const_ref();
+    const QVector<Vec2>& vertexList2 = polygon2.vertexList_const_ref();
+    ConvexView view1(vertexList1.constData(), vertexList1.size());
+    ConvexView view2(vertexList2.constData(), vertexList2.size());
+
+    QCOMPARE(intersect(view1, view2), intersect_expect);
+    QCOMPARE(intersect(polygon1, polygon2), intersect_expect); //through IShape
+
+    double distance;
+    bool isValidDistance;
+    QCOMPARE(intersectMinDist(view1, view2, distance, isValidDistance), intersect_expect);
+    QCOMPARE(isValidDistance, distance_valid_expect);
+    if(isValidDistance){
+        QVERIFY(UtilHelper::compare(distance, distance_expect, 1e-3));
+    }
+
+    //same iterations as the virtual implementation => same distance
+    double distance_gjk;
+    bool isValidDistance_gjk;
+    mp_gjkMinDist->chkIntersect(polygon1, polygon2, distance_gjk, isValidDistance_gjk);
+    QCOMPARE(isValidDistance, isValidDistance_gjk);
+    QCOMPARE(distance, distance_gjk);
+}
+
+//----------
+void GjkQTests::verify_kernel_point_data()
+{
+    QTest::addColumn<Vec2>("pt");
+    QTest::addColumn<bool>("intersect_expect");
+    QTest::addColumn<double>("distance_expect");
+
+    //unit square [0,1]x[0,1]
+    QTest::newRow("inside") << Vec2(0.25, 0.5) << true << 0.0;
+    QTest::newRow("on edge") << Vec2(1.0, 0.5) << true << 0.0;
+    QTest::newRow("on vertex") << Vec2(1.0, 1.0) << true << 0.0;
+    QTest::newRow("outside edge") << Vec2(0.5, -2.0) << false << 2.0;
+    QTest::newRow("outside vertex") << Vec2(4.0, 5.0) << false << 5.0;
+}
+
+//----------
+void GjkQTests::verify_kernel_point()
+{
+    QFETCH(Vec2, pt);
+    QFETCH(bool, intersect_expect);
+    QFETCH(double, distance_expect);
+
+    const Vec2 square[4] = {Vec2(0.0, 0.0), Vec2(1.0, 0.0), Vec2(1.0, 1.0), Vec2(0.0, 1.0)};
+    ConvexView view(square, 4);
+
+    QCOMPARE(intersect(PointView(pt), view), intersect_expect);
+    QCOMPARE(intersect(view, PointView(pt)), intersect_expect);
+
+    double distance;
+    bool isValidDistance;
+    QCOMPARE(intersectMinDist(PointView(pt), view, distance, isValidDistance), intersect_expect);
+    QCOMPARE(isValidDistance, !intersect_expect);
+    if(isValidDistance){
+        QVERIFY(UtilHelper::compare(distance, distance_expect, 1e-9));
+    }
+}
+
+//----------
+void GjkQTests::verify_chkContact_data()
+{
+    QTest::addColumn<Polygon>("polygon1");
+    QTest::addColumn<Polygon>("polygon2");
+    QTest::addColumn<bool>("intersect_expect");
+    QTest::addColumn<double>("distance_expect"); //separation if apart, depth if intersecting
+    QTest::addColumn<Vec2>("normal_expect");
+
+    const Polygon square = shiftedSquare(Vec2(0.0, 0.0));
+
+    QTest::newRow("apart") << square << shiftedSquare(Vec2(2.5, 0.3)) << false << 1.5 << Vec2(1.0, 0.0);
+    QTest::newRow("apart corner") << square << shiftedSquare(Vec2(-4.0, -5.0)) << false << 5.0 << Vec2(-0.6, -0.8);
+    QTest::newRow("overlap +n") << square << shiftedSquare(Vec2(0.9, 0.2)) << true << 0.1 << Vec2(1.0, 0.0);
+    QTest::newRow("overlap -e") << square << shiftedSquare(Vec2(0.3, -0.8)) << true << 0.2 << Vec2(0.0, -1.0);
+    QTest::newRow("touching") << square << shiftedSquare(Vec2(1.0, 0.5)) << true << 0.0 << Vec2(1.0, 0.0);
+    QTest::newRow("point inside") << square << Polygon{Vec2(0.75, 0.4)} << true << 0.25 << Vec2(1.0, 0.0);
+    QTest::newRow("triangle in quad") << Polygon{Vec2(-10.0, -10.0), Vec2(30.0, -10.0), Vec2(30.0, 10.0), Vec2(-10.0, 10.0)}
+                                       << Polygon{Vec2(20.0, 0.0), Vec2(28.0, -2.0), Vec2(28.0, 2.0)} << true << 10.0 << Vec2(1.0, 0.0);
+}
+
+//----------
+void GjkQTests::verify_chkContact()
+{
+    QFETCH(Polygon, polygon1);
+    QFETCH(Polygon, polygon2);
+    QFETCH(bool, intersect_expect);
+    QFETCH(double, distance_expect);
+    QFETCH(Vec2, normal_expect);
+
+    GjkContact contact;
+    bool isIntersect = mp_gjkEpa->chkContact(polygon1, polygon2, contact);
+    QCOMPARE(isIntersect, intersect_expect);
+    QVERIFY(contact.isValid);
+    QVERIFY(UtilHelper::compare(isIntersect? contact.depth : contact.distance, distance_expect, 1e-3));
+    if(distance_expect > 0.0){ //normal not unique when touching
+        QVERIFY(UtilHelper::compare((contact.normal - normal_expect).norm2(), 0.0, 1e-6));
+    }
+
+    //witness points: on the shapes and consistent with distance/depth
+    Vec2 gap = contact.witness2 - contact.witness1;
+    if(isIntersect){
+        QVERIFY(UtilHelper::compare((gap + contact.normal * contact.depth).norm2(), 0.0, 1e-3));
+    }
+    else{
+        QVERIFY(UtilHelper::compare((gap - contact.normal * contact.distance).norm2(), 0.0, 1e-3));
+    }
+    QVERIFY(UtilHelper::compare(contact.witness1.dot(contact.normal), polygon1.support(contact.normal).dot(contact.normal), 1e-3));
+    QVERIFY(UtilHelper::compare(contact.witness2.dot(contact.normal), polygon2.support(-contact.normal).dot(contact.normal), 1e-3));
+
+    //moving shape2 out by depth along the normal leaves the shapes touching
+    if(isIntersect){
+        Polygon polygon2Moved(polygon2);
+        for(Vec2& vertex: polygon2Moved.vertexList()){
+            vertex += contact.normal * (contact.depth + 1e-2);
+        }
+        double distance;
+        bool isValidDistance;
+        QVERIFY(!mp_gjkMinDist->chkIntersect(polygon1, polygon2Moved, distance, isValidDistance));
+        QVERIFY(UtilHelper::compare(distance, 1e-2, 1e-3));
+    }
+
+    //MinDist: closest points only, Basic: nothing
+    GjkContact contactMinDist;
+    QCOMPARE(mp_gjkMinDist->chkContact(polygon1, polygon2, contactMinDist), intersect_expect);
+    QCOMPARE(contactMinDist.isValid, !isIntersect);
+    if(!isIntersect){
+        QVERIFY(UtilHelper::compare(contactMinDist.distance, contact.distance, 1e-3));
+        QVERIFY(UtilHelper::compare((contactMinDist.witness1 - contact.witness1).norm2(), 0.0, 1e-3));
+        QVERIFY(UtilHelper::compare((contactMinDist.witness2 - contact.witness2).norm2(), 0.0, 1e-3));
+    }
+    GjkContact contactBasic;
+    QCOMPARE(mp_gjk->chkContact(polygon1, polygon2, contactBasic), intersect_expect);
+    QVERIFY(!contactBasic.isValid);
+}
+
+//----------
+void GjkQTests::verify_chkSeparation_data()
+{
+    QTest::addColumn<Polygon>("polygon1");
+    QTest::addColumn<Polygon>("polygon2");
+    QTest::addColumn<double>("distanceMin");
+    QTest::addColumn<bool>("separated_expect");
+    QTest::addColumn<double>("distance_expect"); //exact if not separated, else lower bound
+
+    const Polygon square = shiftedSquare(Vec2(0.0, 0.0));
+
+    QTest::newRow("clear") << square << shiftedSquare(Vec2(2.5, 0.3)) << 1.0 << true << 1.0;
+    QTest::newRow("too close") << square << shiftedSquare(Vec2(2.5, 0.3)) << 2.0 << false << 1.5;
+    QTest::newRow("far away") << square << shiftedSquare(Vec2(800.0, -600.0)) << 50.0 << true << 50.0;
+    QTest::newRow("intersect") << square << shiftedSquare(Vec2(0.5, 0.5)) << 1.0 << false << 0.0;
+    QTest::newRow("zero clearance") << square << shiftedSquare(Vec2(0.0, 1.2)) << 0.0 << true << 0.0;
+}
+
+//----------
+void GjkQTests::verify_chkSeparation()
+{
+    QFETCH(Polygon, polygon1);
+    QFETCH(Polygon, polygon2);
+    QFETCH(double, distanceMin);
+    QFETCH(bool, separated_expect);
+    QFETCH(double, distance_expect);
+
+    GjkContact contact;
+    bool isSeparated = mp_gjkMinDist->chkSeparation(polygon1, polygon2, distanceMin, contact);
+    QCOMPARE(isSeparated, separated_expect);
+
+    double distance;
+    bool isValidDistance;
+    bool isIntersect = mp_gjkMinDist->chkIntersect(polygon1, polygon2, distance, isValidDistance);
+    if(isSeparated){
+        QVERIFY(contact.distance > distance_expect);
+        QVERIFY(contact.distance <= distance + 1e-3); //lower bound
+    }
+    else if(!isIntersect){
+        QVERIFY(contact.isValid);
+        QVERIFY(UtilHelper::compare(contact.distance, distance_expect, 1e-3));
+        QVERIFY(UtilHelper::compare((contact.witness2 - contact.witness1 - contact.normal * contact.distance).norm2(), 0.0, 1e-3));
+    }
+    else{
+        QVERIFY(!contact.isValid);
+        QCOMPARE(contact.distance, 0.0);
+    }
+}
+
+//----------
+void GjkQTests::verify_chkSweep_data()
+{
+    QTest::addColumn<Vec2>("positionStart");
+    QTest::addColumn<double>("headingStart");
+    QTest::addColumn<Vec2>("positionEnd");
+    QTest::addColumn<double>("headingEnd");
+    QTest::addColumn<Polygon>("obstacle");
+    QTest::addColumn<bool>("isContact_expect");
+    QTest::addColumn<double>("timeContact_expect"); //negative => only checked against sampled poses
+
+    auto box = [](double minN, double minE, double maxN, double maxE){
+        return(Polygon{Vec2(minN, minE), Vec2(maxN, minE), Vec2(maxN, maxE), Vec2(minN, maxE)});
+    };
+
+    //20 m x 6 m footprint, bow 10 m ahead of the pose
+    QTest::newRow("head on") << Vec2(0.0, 0.0) << 0.0 << Vec2(100.0, 0.0) << 0.0
+                             << box(50.0, -5.0, 60.0, 5.0) << true << 0.4;
+    QTest::newRow("pass by") << Vec2(0.0, 0.0) << 0.0 << Vec2(100.0, 0.0) << 0.0
+                             << box(50.0, 4.0, 60.0, 10.0) << false << 1.0;
+    QTest::newRow("thin wall") << Vec2(0.0, 0.0) << 0.0 << Vec2(200.0, 0.0) << 0.0
+                               << box(70.0, -50.0, 70.05, 50.0) << true << 0.3;
+    QTest::newRow("abeam") << Vec2(0.0, 0.0) << 90.0 << Vec2(0.0, 100.0) << 90.0
+                           << box(-2.0, 20.0, 2.0, 24.0) << true << 0.1;
+    QTest::newRow("start in contact") << Vec2(0.0, 0.0) << 0.0 << Vec2(100.0, 0.0) << 0.0
+                                      << box(-1.0, -1.0, 1.0, 1.0) << true << 0.0;
+    QTest::newRow("moving away") << Vec2(0.0, 0.0) << 0.0 << Vec2(-100.0, 0.0) << 0.0
+                                 << box(50.0, -5.0, 60.0, 5.0) << false << 1.0;
+    QTest::newRow("turn in place") << Vec2(0.0, 0.0) << 0.0 << Vec2(0.0, 0.0) << 90.0
+                                   << box(-1.0, 7.0, 1.0, 9.0) << true << -1.0;
+    QTest::newRow("turn through north") << Vec2(0.0, 0.0) << 330.0 << Vec2(40.0, 0.0) << 30.0
+                                        << box(25.0, -8.0, 30.0, -4.0) << true << -1.0;
+    QTest::newRow("turn and miss") << Vec2(0.0, 0.0) << 0.0 << Vec2(50.0, 50.0) << 90.0
+                                   << box(40.0, -20.0, 45.0, -10.0) << false << 1.0;
+}
+
+//----------
+void GjkQTests::verify_chkSweep()
+{
+    QFETCH(Vec2, positionStart);
+    QFETCH(double, headingStart);
+    QFETCH(Vec2, positionEnd);
+    QFETCH(double, headingEnd);
+    QFETCH(Polygon, obstacle);
+    QFETCH(bool, isContact_expect);
+    QFETCH(double, timeContact_expect);
+
+    VesRectangle hull(20.0, 6.0);
+    hull.setOffset(VectorF{0.0, 0.0});
+    Polygon footprint;
+    for(const VectorF& pt: hull.polygon()){
+        footprint.vertexList().append(Vec2(pt.at(IDX_U), pt.at(IDX_V)));
+    }
+    GjkPose poseStart{positionStart, headingStart};
+    GjkPose poseEnd{positionEnd, headingEnd};
+
+    double timeContact;
+    GjkContact contact;
+    bool isContact = mp_gjkMinDist->chkSweep(footprint, poseStart, poseEnd, obstacle, timeContact, contact);
+    QCOMPARE(isContact, isContact_expect);
+    if(timeContact_expect >= 0.0){
+        QVERIFY(UtilHelper::compare(timeContact, timeContact_expect, 1e-3));
+    }
+
+    //sampled poses: no contact before timeContact, and contact at it
+    auto distanceAt = [&](double t, bool& isIntersect){
+        GjkPose pose = GjkPose::interpolate(poseStart, poseEnd, t);
+        Polygon moved;
+        for(const Vec2& vertex: footprint.vertexList_const_ref()){
+            moved.vertexList().append(pose.toWorld(vertex));
+        }
+        GjkContact sampleContact;
+        isIntersect = mp_gjkEpa->chkContact(moved, obstacle, sampleContact);
+        return(sampleContact.distance);
+    };
+
+    const int nSample = 1000;
+    for(int i = 0; i <= nSample && i < timeContact * nSample; ++i){
+        bool isIntersect;
+        distanceAt(static_cast<double>(i) / nSample, isIntersect);
+        QVERIFY(!isIntersect);
+    }
+    if(isContact){
+        bool isIntersect;
+        QVERIFY(distanceAt(timeContact, isIntersect) <= SWEEP_DISTANCE_TOL + 1e-3);
+    }
+}
+
+//----------
+void GjkQTests::verify_chkIntersectCached_data()
+{
+    QTest::addColumn<Polygon>("polygon1");
+    QTest::addColumn<Polygon>("polygon2");
+    QTest::addColumn<Vec2>("stepPerTick"); //of polygon1
+
+    Polygon hull{Vec2(-10.0, -3.0), Vec2(10.0, -3.0), Vec2(10.0, 3.0), Vec2(-10.0, 3.0)};
+    Polygon obstacle{Vec2(40.0, 10.0), Vec2(55.0, 8.0), Vec2(60.0, 20.0), Vec2(45.0, 25.0)};
+
+    QTest::newRow("pass by") << hull << obstacle << Vec2(0.5, 0.05);
+    QTest::newRow("run through") << hull << obstacle << Vec2(0.5, 0.15);
+    QTest::newRow("fast") << hull << obstacle << Vec2(5.0, 1.5);
+    QTest::newRow("shapes swapped") << obstacle << hull << Vec2(-0.5, -0.15);
+}
+
+//----------
+void GjkQTests::verify_chkIntersectCached()
+{
+    QFETCH(Polygon, polygon1);
+    QFETCH(Polygon, polygon2);
+    QFETCH(Vec2, stepPerTick);
+
+    const quint64 pairId = (quint64(7) << 32) | 3;
+    GjkCache cache;
+    int nIntersect = 0;
+    for(int tick = 0; tick < 200; ++tick){
+        bool isIntersect = mp_gjkMinDist->chkIntersectCached(polygon1, polygon2, cache, pairId);
+        double distance;
+        bool isValidDistance;
+        QCOMPARE(isIntersect, mp_gjk->chkIntersect(polygon1, polygon2, distance, isValidDistance));
+        nIntersect += isIntersect? 1 : 0;
+
+        //the stored direction separates the shapes when they are apart
+        Vec2 searchDir;
+        QVERIFY(cache.searchDir(pairId, searchDir));
+        if(!isIntersect){
+            QVERIFY(polygon2.support(searchDir).dot(searchDir) < polygon1.support(-searchDir).dot(searchDir));
+        }
+
+        for(Vec2& vertex: polygon1.vertexList()){
+            vertex += stepPerTick;
+        }
+    }
+    QCOMPARE(cache.size(), 1);
+    QVERIFY(nIntersect < 200);
+
+    //a separated pair seeded with the cached direction settles with a single support on each shape
+    struct CountingView{
+        const Polygon& polygon;
+        int& nSupport;
+        Vec2 centroid() const { return(polygon.centroid()); }
+        Vec2 support(const Vec2& dir) const { ++nSupport; return(polygon.support(dir)); }
+    };
+    for(Vec2& vertex: polygon1.vertexList()){
+        vertex -= stepPerTick;
+    }
+    Vec2 searchDir;
+    cache.searchDir(pairId, searchDir);
+    int nSupport = 0;
+    if(!intersectWarmStart(CountingView{polygon1, nSupport}, CountingView{polygon2, nSupport}, searchDir)){
+        QCOMPARE(nSupport, 2);
+    }
+
+    cache.remove(pairId);
+    QCOMPARE(cache.size(), 0);
+}
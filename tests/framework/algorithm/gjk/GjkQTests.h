@@ -23,10 +23,23 @@ private:
 private slots:
     void verify_chkIntersect_data();
     void verify_chkIntersect();
+    void verify_kernel_data();
+    void verify_kernel();
+    void verify_kernel_point_data();
+    void verify_kernel_point();
+    void verify_chkContact_data();
+    void verify_chkContact();
+    void verify_chkSeparation_data();
+    void verify_chkSeparation();
+    void verify_chkSweep_data();
+    void verify_chkSweep();
+    void verify_chkIntersectCached_data();
+    void verify_chkIntersectCached();
 
 private:
     QScopedPointer<Gjk> mp_gjk;
     QScopedPointer<Gjk> mp_gjkMinDist;
+    QScopedPointer<Gjk> mp_gjkEpa;
 };
 
 #endif
@@ -0,0 +1,148 @@
+#include "ObstacleSetQTests.h"
+#include "TestScenario.h"
+#include <RrtPlannerLib/framework/algorithm/gjk/ObstacleSet.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/Polygon.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/Gjk.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/GjkFactory.h>
+#include <RrtPlannerLib/framework/UtilHelper.h>
+#include <QtTest/QtTest>
+#include <QtGlobal>
+#include <cmath>
+
+
+using namespace rrtplanner::framework;
+using namespace rrtplanner::framework::algorithm::gjk;
+
+namespace {
+    //20 x 20 obstacles of 3 to 8 vertices, 50 m apart
+    QVector<Polygon> obstacleField()
+    {
+        QVector<Polygon> ret;
+        for(int i = 0; i < 20; ++i){
+            for(int j = 0; j < 20; ++j){
+                int k = 20*i + j;
+                ret.append(TestScenario::regularPolygon(3 + k % 6, 5.0 + (k * 7) % 13, Vec2(50.0 * i, 50.0 * j), 0.1 * k));
+            }
+        }
+        return(ret);
+    }
+}
+
+//----------
+ObstacleSetQTests::ObstacleSetQTests()
+{
+
+}
+
+//----------
+ObstacleSetQTests::~ObstacleSetQTests()
+{
+    cleanUp();
+}
+
+//----------
+void ObstacleSetQTests::setup()
+{
+
+}
+
+//----------
+void ObstacleSetQTests::cleanUp()
+{
+
+}
+
+//----------
+void ObstacleSetQTests::verify_append()
+{
+    ObstacleSet obstacleSet;
+    QCOMPARE(obstacleSet.size(), 0);
+
+    Polygon triangle{Vec2(0.0, 0.0), Vec2(1.0, 0.0), Vec2(0.0, 1.0)};
+    QCOMPARE(obstacleSet.append(triangle), 0);
+    QCOMPARE(obstacleSet.append(QVector<Vec2>{Vec2(5.0, 5.0)}), 1);
+    QCOMPARE(obstacleSet.size(), 2);
+    QCOMPARE(obstacleSet.vertexCount(0), 3);
+    QCOMPARE(obstacleSet.vertexCount(1), 1);
+    QVERIFY(obstacleSet.vertexData(0)[2] == Vec2(0.0, 1.0));
+    QVERIFY(obstacleSet.vertexData(1)[0] == Vec2(5.0, 5.0));
+
+    //copies are independent
+    ObstacleSet copy(obstacleSet);
+    copy.append(triangle);
+    QCOMPARE(copy.size(), 3);
+    QCOMPARE(obstacleSet.size(), 2);
+
+    obstacleSet.clear();
+    QCOMPARE(obstacleSet.size(), 0);
+    QVector<int> hitIdxList{7};
+    QCOMPARE(obstacleSet.chkIntersect(triangle, hitIdxList), 0);
+    QVERIFY(hitIdxList.isEmpty());
+}
+
+//----------
+void ObstacleSetQTests::verify_chkIntersect_data()
+{
+    QTest::addColumn<Polygon>("shape");
+    QTest::addColumn<double>("distanceMax");
+
+    Polygon footprint{Vec2(-30.0, -6.0), Vec2(30.0, -6.0), Vec2(30.0, 6.0), Vec2(-30.0, 6.0)};
+    auto moved = [&footprint](const Vec2& offset){
+        Polygon ret(footprint);
+        for(Vec2& vertex: ret.vertexList()){
+            vertex += offset;
+        }
+        return(ret);
+    };
+
+    for(double distanceMax: {0.0, 8.0}){
+        QString suffix = QString(";distanceMax=%1").arg(distanceMax);
+        QTest::newRow(qPrintable("between" + suffix)) << moved(Vec2(125.0, 225.0)) << distanceMax;
+        QTest::newRow(qPrintable("on obstacle" + suffix)) << moved(Vec2(300.0, 300.0)) << distanceMax;
+        QTest::newRow(qPrintable("edge of field" + suffix)) << moved(Vec2(-10.0, 480.0)) << distanceMax;
+        QTest::newRow(qPrintable("outside" + suffix)) << moved(Vec2(-500.0, 0.0)) << distanceMax;
+        QTest::newRow(qPrintable("point" + suffix)) << Polygon{Vec2(452.0, 148.0)} << distanceMax;
+    }
+}
+
+//----------
+void ObstacleSetQTests::verify_chkIntersect()
+{
+    QFETCH(Polygon, shape);
+    QFETCH(double, distanceMax);
+
+    QVector<Polygon> obstacleList = obstacleField();
+    ObstacleSet obstacleSet;
+    for(const Polygon& obstacle: obstacleList){
+        obstacleSet.append(obstacle);
+    }
+
+    QVector<int> hitIdxList;
+    QVector<double> distanceList;
+    int nHit = obstacleSet.chkIntersect(shape, hitIdxList, &distanceList, distanceMax);
+    QCOMPARE(nHit, hitIdxList.size());
+    QCOMPARE(distanceList.size(), hitIdxList.size());
+
+    //brute force: one GJK per obstacle
+    QScopedPointer<Gjk> p_gjk(GjkFactory::getGjk(GjkFactory::GjkType::MinDist));
+    QVector<int> hitIdxList_expect;
+    QVector<double> distanceList_expect;
+    for(int i = 0; i < obstacleList.size(); ++i){
+        double distance;
+        bool isValidDistance;
+        bool isIntersect = p_gjk->chkIntersect(shape, obstacleList.at(i), distance, isValidDistance);
+        if(isIntersect || distance <= distanceMax){
+            hitIdxList_expect.append(i);
+            distanceList_expect.append(isIntersect? 0.0 : distance);
+        }
+    }
+
+    QCOMPARE(hitIdxList, hitIdxList_expect);
+    for(int i = 0; i < distanceList.size(); ++i){
+        QVERIFY(UtilHelper::compare(distanceList.at(i), distanceList_expect.at(i), 1e-3));
+    }
+
+    QVector<int> hitIdxList_noDistance;
+    QCOMPARE(obstacleSet.chkIntersect(shape, hitIdxList_noDistance, nullptr, distanceMax), nHit);
+    QCOMPARE(hitIdxList_noDistance, hitIdxList);
+}
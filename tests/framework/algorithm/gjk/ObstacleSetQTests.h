@@ -0,0 +1,25 @@
+#ifndef RRTPLANNER_LIB_OBSTACLESETQTESTS_H
+#define RRTPLANNER_LIB_OBSTACLESETQTESTS_H
+
+#include <QObject>
+#include <QScopedPointer>
+
+class ObstacleSetQTests : public QObject
+{
+    Q_OBJECT
+
+public:
+    ObstacleSetQTests();
+    ~ObstacleSetQTests();
+
+private:
+    void setup();
+    void cleanUp();
+
+private slots:
+    void verify_append();
+    void verify_chkIntersect_data();
+    void verify_chkIntersect();
+};
+
+#endif
@@ -0,0 +1,215 @@
+#include "SignedDistanceGridQTests.h"
+#include "TestScenario.h"
+#include <RrtPlannerLib/framework/algorithm/gjk/SignedDistanceGrid.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/GjkKernel.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/ObstacleSet.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/Polygon.h>
+#include <QtTest/QtTest>
+#include <QtGlobal>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+
+using namespace rrtplanner::framework;
+using namespace rrtplanner::framework::algorithm::gjk;
+
+namespace {
+    //signed distance from pt to an obstacle by the GJK kernel, with the unit direction from pt away from it
+    double gjkSignedDistance(const Polygon& obstacle, const Vec2& pt, Vec2& away)
+    {
+        ConvexView obstacleView(obstacle.vertexList_const_ref().constData(), obstacle.vertexList_const_ref().size());
+        GjkContact contact;
+        if(intersectContact(PointView(pt), obstacleView, contact)){
+            away = contact.normal;
+            return(-contact.depth);
+        }
+        away = -contact.normal;
+        return(contact.distance);
+    }
+}
+
+//----------
+SignedDistanceGridQTests::SignedDistanceGridQTests()
+{
+
+}
+
+//----------
+SignedDistanceGridQTests::~SignedDistanceGridQTests()
+{
+    cleanUp();
+}
+
+//----------
+void SignedDistanceGridQTests::setup()
+{
+
+}
+
+//----------
+void SignedDistanceGridQTests::cleanUp()
+{
+
+}
+
+//----------
+void SignedDistanceGridQTests::verify_build()
+{
+    ObstacleSet obstacleSet;
+    obstacleSet.append(Polygon{Vec2(0.0, 0.0), Vec2(10.0, 0.0), Vec2(10.0, 4.0), Vec2(0.0, 4.0)});
+
+    SignedDistanceGrid sdf;
+    QVERIFY(sdf.isEmpty());
+    QVERIFY(!sdf.contains(Vec2(0.0, 0.0)));
+    QCOMPARE(sdf.distance(Vec2(5.0, 2.0)), 0.0);
+
+    //invalid input leaves the grid empty
+    QVERIFY(!sdf.build(obstacleSet, Vec2(0.0, 0.0), Vec2(10.0, 10.0), 0.0, 5.0));
+    QVERIFY(!sdf.build(obstacleSet, Vec2(0.0, 0.0), Vec2(10.0, 10.0), 1.0, 0.0));
+    QVERIFY(!sdf.build(obstacleSet, Vec2(0.0, 0.0), Vec2(-10.0, 10.0), 1.0, 5.0));
+    QVERIFY(!sdf.build(obstacleSet, Vec2(0.0, 0.0), Vec2(1e6, 1e6), 0.1, 5.0));
+    QVERIFY(sdf.isEmpty());
+
+    //the last nodes are at or beyond maxNE
+    QVERIFY(sdf.build(obstacleSet, Vec2(-20.0, -10.0), Vec2(30.0, 14.5), 1.0, 5.0));
+    QVERIFY(!sdf.isEmpty());
+    QCOMPARE(sdf.nN(), 51);
+    QCOMPARE(sdf.nE(), 26);
+    QCOMPARE(sdf.origin(), Vec2(-20.0, -10.0));
+    QCOMPARE(sdf.resolution(), 1.0);
+    QCOMPARE(sdf.distanceMax(), 5.0);
+    QVERIFY(sdf.contains(Vec2(30.0, 15.0)));
+    QVERIFY(!sdf.contains(Vec2(30.1, 15.0)));
+    QVERIFY(!sdf.contains(Vec2(-20.0, -10.1)));
+
+    //nodes: truncated away from the box, exact near it
+    QCOMPARE(sdf.nodeDistance(0, 0), 5.0);
+    QCOMPARE(sdf.nodeDistance(25, 12), -2.0);   //(5, 2), centre of the box
+    QCOMPARE(sdf.nodeDistance(23, 10), 0.0);    //(3, 0), on an edge
+    QCOMPARE(sdf.nodeDistance(17, 10), 3.0);    //(-3, 0)
+    QVERIFY(std::abs(sdf.nodeDistance(33, 16) - std::sqrt(13.0)) < 1e-6);  //(13, 6), off the corner (10, 4)
+    QCOMPARE(sdf.nodeDistance(36, 12), 5.0);    //(16, 2), truncated
+    QCOMPARE(sdf.distance(Vec2(5.0, 2.0)), -2.0);
+    QCOMPARE(sdf.distance(Vec2(5.5, 2.0)), -2.0);
+    QCOMPARE(sdf.distance(Vec2(-2.5, 2.0)), 2.5);
+
+    //positions outside the grid are clamped
+    QCOMPARE(sdf.distance(Vec2(-100.0, -100.0)), 5.0);
+    QCOMPARE(sdf.distance(Vec2(5.0, -100.0)), sdf.distance(Vec2(5.0, -10.0)));
+
+    //truncated inside as well
+    QVERIFY(sdf.build(obstacleSet, Vec2(-20.0, -10.0), Vec2(30.0, 14.5), 1.0, 1.5));
+    QCOMPARE(sdf.nodeDistance(25, 12), -1.5);
+
+    //copies are independent
+    SignedDistanceGrid copy(sdf);
+    copy.clear();
+    QVERIFY(copy.isEmpty());
+    QVERIFY(!sdf.isEmpty());
+
+    //no obstacles, a single node
+    QVERIFY(sdf.build(ObstacleSet(), Vec2(1.0, 2.0), Vec2(1.0, 2.0), 1.0, 5.0));
+    QCOMPARE(sdf.nN(), 1);
+    QCOMPARE(sdf.nE(), 1);
+    Vec2 gradient(1.0, 1.0);
+    QCOMPARE(sdf.distance(Vec2(3.0, 3.0), gradient), 5.0);
+    QCOMPARE(gradient, Vec2(0.0, 0.0));
+}
+
+//----------
+void SignedDistanceGridQTests::verify_distance_data()
+{
+    QTest::addColumn<QVector<Polygon>>("obstacleList");
+    QTest::addColumn<double>("resolution");
+    QTest::addColumn<double>("distanceMax");
+
+    QVector<Polygon> harbour{
+        Polygon{Vec2(0.0, 0.0), Vec2(40.0, 0.0), Vec2(40.0, 15.0), Vec2(0.0, 15.0)},
+        TestScenario::regularPolygon(7, 12.0, Vec2(70.0, 60.0), 0.2),
+        Polygon{Vec2(10.0, 80.0)},
+        Polygon{Vec2(-30.0, 40.0), Vec2(-10.0, 90.0)},
+        Polygon{Vec2(80.0, 0.0), Vec2(100.0, 5.0), Vec2(85.0, 25.0), Vec2(90.0, 10.0)}
+    };
+    QVector<Polygon> overlap{
+        Polygon{Vec2(0.0, 0.0), Vec2(30.0, 0.0), Vec2(30.0, 30.0), Vec2(0.0, 30.0)},
+        TestScenario::regularPolygon(32, 20.0, Vec2(35.0, 35.0), 0.0)
+    };
+
+    QTest::newRow("harbour") << harbour << 1.0 << 25.0;
+    QTest::newRow("harbour, coarse") << harbour << 4.0 << 25.0;
+    QTest::newRow("harbour, fine, short truncation") << harbour << 0.25 << 6.0;
+    QTest::newRow("overlapping obstacles") << overlap << 0.5 << 40.0;
+    QTest::newRow("no obstacle") << QVector<Polygon>{} << 2.0 << 10.0;
+}
+
+//----------
+void SignedDistanceGridQTests::verify_distance()
+{
+    QFETCH(QVector<Polygon>, obstacleList);
+    QFETCH(double, resolution);
+    QFETCH(double, distanceMax);
+
+    ObstacleSet obstacleSet;
+    for(const Polygon& obstacle: obstacleList){
+        obstacleSet.append(obstacle);
+    }
+    const Vec2 minNE(-50.0, -40.0), maxNE(130.0, 120.0);
+    SignedDistanceGrid sdf;
+    QVERIFY(sdf.build(obstacleSet, minNE, maxNE, resolution, distanceMax));
+    const double errorBound = sdf.errorBound();
+    QVERIFY(errorBound >= std::sqrt(2.0) * resolution);
+
+    //pseudo-random positions over the grid against the GJK signed distance, truncated
+    const int nSample = 4000;
+    int nInside = 0, nNear = 0;
+    for(int k = 0; k < nSample; ++k){
+        Vec2 pt = minNE + Vec2(std::fmod(k * 0.6180339887, 1.0) * (maxNE[0] - minNE[0]),
+                               std::fmod(k * 0.7548776662, 1.0) * (maxNE[1] - minNE[1]));
+        QVERIFY(sdf.contains(pt));
+
+        double exact = std::numeric_limits<double>::max(), second = exact;
+        Vec2 away;
+        for(const Polygon& obstacle: obstacleList){
+            Vec2 awayTmp;
+            double distanceTmp = gjkSignedDistance(obstacle, pt, awayTmp);
+            if(distanceTmp < exact){
+                second = exact;
+                exact = distanceTmp;
+                away = awayTmp;
+            }
+            else{
+                second = std::min(second, distanceTmp);
+            }
+        }
+        double exactTrunc = std::min(std::max(exact, -distanceMax), distanceMax);
+
+        Vec2 gradient;
+        double value = sdf.distance(pt, gradient);
+        QCOMPARE(sdf.distance(pt), value);
+        QVERIFY2(std::abs(value - exactTrunc) <= errorBound,
+                 qPrintable(QString("pt (%1, %2): grid %3, exact %4").arg(pt[0]).arg(pt[1]).arg(value).arg(exactTrunc)));
+        nInside += exact < -errorBound? 1 : 0;
+        nNear += std::abs(exact) <= errorBound? 1 : 0;
+
+        //the gradient is that of the bilinear interpolant
+        const double h = 1e-3 * resolution;
+        Vec2 gradientFd((sdf.distance(pt + Vec2(h, 0.0)) - sdf.distance(pt - Vec2(h, 0.0))) / (2.0 * h),
+                        (sdf.distance(pt + Vec2(0.0, h)) - sdf.distance(pt - Vec2(0.0, h))) / (2.0 * h));
+        double sN = (pt[0] - minNE[0]) / resolution, sE = (pt[1] - minNE[1]) / resolution;
+        bool onCellEdge = std::abs(sN - std::round(sN)) < 2e-3 || std::abs(sE - std::round(sE)) < 2e-3;
+        if(!onCellEdge){
+            QVERIFY((gradient - gradientFd).norm2() < 1e-3);
+        }
+
+        //away from the truncation and the medial axis, it points away from the nearest obstacle
+        if(exact > 4.0 * errorBound && exact < distanceMax - 4.0 * errorBound && second - exact > 4.0 * errorBound){
+            QVERIFY(gradient.dot(away) > 0.7 * gradient.norm2());
+            QVERIFY(gradient.norm2() > 0.5);
+        }
+    }
+    if(!obstacleList.isEmpty()){
+        QVERIFY(nInside > 0);
+        QVERIFY(nNear > 0);
+    }
+}
@@ -0,0 +1,25 @@
+#ifndef RRTPLANNER_LIB_SIGNEDDISTANCEGRIDQTESTS_H
+#define RRTPLANNER_LIB_SIGNEDDISTANCEGRIDQTESTS_H
+
+#include <QObject>
+#include <QScopedPointer>
+
+class SignedDistanceGridQTests : public QObject
+{
+    Q_OBJECT
+
+public:
+    SignedDistanceGridQTests();
+    ~SignedDistanceGridQTests();
+
+private:
+    void setup();
+    void cleanUp();
+
+private slots:
+    void verify_build();
+    void verify_distance_data();
+    void verify_distance();
+};
+
+#endif
@@ -68,7 +68,7 @@ void SimplexQTests::verify_update()
 
     mp_simplex->reset();
     for(int i = 0; i < vertexList.size(); ++i){
-        VectorF v;
+        Vec2 v;
         bool results = mp_simplex->update(vertexList.at(i), v);
         QCOMPARE(results, resultsList_expect.at(i));
     }
@@ -0,0 +1,241 @@
+#include "KdTreeQTests.h"
+#include <RrtPlannerLib/framework/algorithm/rrt/KdTree.h>
+#include <RrtPlannerLib/framework/EllMap.h>
+#include <RrtPlannerLib/framework/Plan.h>
+#include <RrtPlannerLib/framework/RootData.h>
+#include <RrtPlannerLib/framework/VectorF.h>
+#include <QtTest/QtTest>
+#include <QtGlobal>
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+
+using namespace rrtplanner::framework;
+using namespace rrtplanner::framework::algorithm::rrt;
+
+namespace {
+    using Point2 = std::array<double, 2>;
+    using Point4 = std::array<double, 4>;
+
+    //L1 distance, a metric other than the default
+    class Manhattan
+    {
+    public:
+        double distance(const Point2& a, const Point2& b) const { return(std::abs(a[0] - b[0]) + std::abs(a[1] - b[1])); }
+        double axisDistance(int, double diff) const { return(std::abs(diff)); }
+    };
+
+    //checks nearest, kNearest and radius against brute force at the given queries
+    template<int Dim, class Metric>
+    void compareBruteForce(const KdTree<Dim, Metric>& kdTree, const QVector<typename KdTree<Dim, Metric>::Point>& queryList,
+                           int k, double radius)
+    {
+        const Metric& metric = kdTree.metric();
+        for(const typename KdTree<Dim, Metric>::Point& query: queryList){
+            QVector<double> distList(kdTree.size());
+            for(int idx = 0; idx < kdTree.size(); ++idx){
+                distList[idx] = metric.distance(query, kdTree.point(idx));
+            }
+            QVector<double> distSorted = distList;
+            std::sort(distSorted.begin(), distSorted.end());
+
+            double dist;
+            int nearest = kdTree.nearest(query, &dist);
+            QVERIFY(nearest >= 0);
+            QCOMPARE(dist, distSorted.first());
+            QCOMPARE(distList.at(nearest), dist);
+
+            QVector<int> idxList;
+            QVector<double> kDistList;
+            kdTree.kNearest(query, k, idxList, &kDistList);
+            QCOMPARE(idxList.size(), std::min(k, kdTree.size()));
+            QCOMPARE(kDistList.size(), idxList.size());
+            for(int j = 0; j < idxList.size(); ++j){
+                QCOMPARE(kDistList.at(j), distSorted.at(j));
+                QCOMPARE(distList.at(idxList.at(j)), kDistList.at(j));
+            }
+
+            QVector<double> rDistList;
+            kdTree.radius(query, radius, idxList, &rDistList);
+            QVector<int> idxList_expect;
+            for(int idx = 0; idx < kdTree.size(); ++idx){
+                if(distList.at(idx) <= radius){
+                    idxList_expect.append(idx);
+                }
+            }
+            QCOMPARE(rDistList.size(), idxList.size());
+            for(int j = 0; j < idxList.size(); ++j){
+                QCOMPARE(distList.at(idxList.at(j)), rDistList.at(j));
+            }
+            std::sort(idxList.begin(), idxList.end());
+            QCOMPARE(idxList, idxList_expect);
+        }
+    }
+}
+
+Q_DECLARE_METATYPE(QVector<Point2>)
+
+//----------
+KdTreeQTests::KdTreeQTests()
+{
+
+}
+
+//----------
+KdTreeQTests::~KdTreeQTests()
+{
+    cleanUp();
+}
+
+//----------
+void KdTreeQTests::setup()
+{
+
+}
+
+//----------
+void KdTreeQTests::cleanUp()
+{
+
+}
+
+//----------
+void KdTreeQTests::verify_query_data()
+{
+    QTest::addColumn<QVector<Point2>>("pointList");
+
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    std::normal_distribution<double> normal(0.0, 1.0);
+
+    QVector<Point2> uniform, sorted, clustered, grid;
+    for(int k = 0; k < 3000; ++k){
+        uniform.append(Point2{1000.0 * unit(rng), 500.0 * unit(rng)});
+        sorted.append(Point2{static_cast<double>(k), 0.01 * k * k});
+        Point2 centre{(k % 5) * 200.0, (k % 3) * 300.0};
+        clustered.append(Point2{centre[0] + 5.0 * normal(rng), centre[1] + 5.0 * normal(rng)});
+        grid.append(Point2{10.0 * (k % 50), 10.0 * (k / 50)});
+    }
+
+    QTest::newRow("uniform") << uniform;
+    QTest::newRow("sorted along a curve") << sorted;
+    QTest::newRow("clustered") << clustered;
+    QTest::newRow("grid, ties") << grid;
+}
+
+//----------
+void KdTreeQTests::verify_query()
+{
+    QFETCH(QVector<Point2>, pointList);
+
+    KdTree<2> kdTree;
+    QCOMPARE(kdTree.nearest(Point2{0.0, 0.0}), -1);
+    QCOMPARE(kdTree.depth(), -1);
+
+    //queries as the tree grows, on and off the points
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<double> unit(-100.0, 1100.0);
+    QVector<Point2> queryList;
+    for(int k = 0; k < 20; ++k){
+        queryList.append(Point2{unit(rng), unit(rng)});
+    }
+    for(int idx = 0; idx < pointList.size(); ++idx){
+        QCOMPARE(kdTree.insert(pointList.at(idx)), idx);
+        if(idx == 0 || idx == 10 || idx == 300 || idx == pointList.size() - 1){
+            QVector<Point2> queryListTmp = queryList;
+            queryListTmp.append(pointList.at(idx / 2));
+            compareBruteForce(kdTree, queryListTmp, 8, 40.0);
+        }
+    }
+    QCOMPARE(kdTree.size(), pointList.size());
+    for(int idx = 0; idx < pointList.size(); ++idx){
+        QCOMPARE(kdTree.point(idx), pointList.at(idx));
+    }
+
+    kdTree.clear();
+    QVERIFY(kdTree.isEmpty());
+    QCOMPARE(kdTree.nearest(Point2{0.0, 0.0}), -1);
+}
+
+//----------
+void KdTreeQTests::verify_balance()
+{
+    //points inserted in order would make an unbalanced tree a list
+    const int n = 20000;
+    KdTree<2> kdTree;
+    kdTree.reserve(n);
+    for(int k = 0; k < n; ++k){
+        kdTree.insert(Point2{static_cast<double>(k), static_cast<double>(k)});
+        if((k + 1) % 1000 == 0){
+            double depthMax = std::floor(std::log(static_cast<double>(k + 1)) / -std::log(RRT_KD_ALPHA)) + 1.0;
+            QVERIFY(kdTree.depth() <= depthMax);
+        }
+    }
+    double dist;
+    QCOMPARE(kdTree.nearest(Point2{1234.4, 1234.4}, &dist), 1234);
+    QVERIFY(std::abs(dist - 0.4 * std::sqrt(2.0)) < 1e-9);
+}
+
+//----------
+void KdTreeQTests::verify_metric()
+{
+    std::mt19937 rng(9);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+
+    //(dx, ell, N, E) with the position down-weighted
+    KdTree<4> kdTree4(WeightedEuclidean<4>(Point4{1.0, 1.0, 0.1, 0.1}));
+    QVector<Point4> queryList4;
+    for(int k = 0; k < 2000; ++k){
+        kdTree4.insert(Point4{200.0 * unit(rng), 2000.0 * unit(rng), 1000.0 * unit(rng), 1000.0 * unit(rng)});
+    }
+    for(int k = 0; k < 20; ++k){
+        queryList4.append(Point4{200.0 * unit(rng), 2000.0 * unit(rng), 1000.0 * unit(rng), 1000.0 * unit(rng)});
+    }
+    compareBruteForce(kdTree4, queryList4, 5, 100.0);
+
+    //L1
+    KdTree<2, Manhattan> kdTreeL1;
+    QVector<Point2> queryList2;
+    for(int k = 0; k < 2000; ++k){
+        kdTreeL1.insert(Point2{1000.0 * unit(rng), 1000.0 * unit(rng)});
+    }
+    for(int k = 0; k < 20; ++k){
+        queryList2.append(Point2{1000.0 * unit(rng), 1000.0 * unit(rng)});
+    }
+    compareBruteForce(kdTreeL1, queryList2, 5, 60.0);
+}
+
+//----------
+void KdTreeQTests::verify_rootData()
+{
+    //keys are the curvilinear coordinates of the EllMap of SMapQTests
+    Plan planNominal;
+    planNominal.setPlan(QVector<Waypt>{Waypt{0.0, 0.0, 0.0, 0},
+                                Waypt{1000.0, 1000.0, 0.0, 1},
+                                Waypt{2000.0, 1000.0, 0.0, 2},
+                                Waypt{3000.0, 0.0, 0.0, 3},
+                                Waypt{4000.0, 0.0, 0.0, 4}},
+                 0);
+    planNominal.setProperty(Plan::Property::IS_NOMINAL);
+    EllMap ellMap;
+    QVERIFY(ellMap.buildEllMap(planNominal, 500.0));
+
+    KdTree<2> kdTree;
+    std::mt19937 rng(13);
+    std::uniform_real_distribution<double> unitN(-500.0, 4500.0);
+    std::uniform_real_distribution<double> unitE(-500.0, 1500.0);
+    RootData rootData;
+    QVector<Point2> queryList;
+    while(kdTree.size() < 1000){
+        if(ellMap.getRootData(VectorF{unitN(rng), unitE(rng)}, rootData)){
+            kdTree.insert(Point2{rootData.dx(), rootData.ell()});
+        }
+    }
+    while(queryList.size() < 20){
+        if(ellMap.getRootData(VectorF{unitN(rng), unitE(rng)}, rootData)){
+            queryList.append(Point2{rootData.dx(), rootData.ell()});
+        }
+    }
+    compareBruteForce(kdTree, queryList, 10, 150.0);
+}
@@ -0,0 +1,27 @@
+#ifndef RRTPLANNER_LIB_KDTREEQTESTS_H
+#define RRTPLANNER_LIB_KDTREEQTESTS_H
+
+#include <QObject>
+#include <QScopedPointer>
+
+class KdTreeQTests : public QObject
+{
+    Q_OBJECT
+
+public:
+    KdTreeQTests();
+    ~KdTreeQTests();
+
+private:
+    void setup();
+    void cleanUp();
+
+private slots:
+    void verify_query_data();
+    void verify_query();
+    void verify_balance();
+    void verify_metric();
+    void verify_rootData();
+};
+
+#endif
@@ -0,0 +1,136 @@
+#include "ParallelRrtQTests.h"
+#include "TestScenario.h"
+#include <RrtPlannerLib/framework/algorithm/rrt/ParallelRrt.h>
+#include <RrtPlannerLib/framework/algorithm/rrt/RrtStar.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/ObstacleSet.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/Polygon.h>
+#include <RrtPlannerLib/framework/SMap.h>
+#include <RrtPlannerLib/framework/vessel.h>
+#include <QtTest/QtTest>
+#include <QThread>
+#include <QtGlobal>
+#include <algorithm>
+#include <cmath>
+
+
+using namespace rrtplanner::framework;
+using namespace rrtplanner::framework::algorithm::gjk;
+using namespace rrtplanner::framework::algorithm::rrt;
+
+namespace {
+    //the problem of RrtStarQTests, with the box on the route
+    bool buildProblem(SMap& sMap, Vessel& vessel, ObstacleSet& obstacleSet)
+    {
+        obstacleSet.append(Polygon{Vec2(1300.0, 700.0), Vec2(1700.0, 700.0), Vec2(1700.0, 1300.0), Vec2(1300.0, 1300.0)});
+        return(TestScenario::rrtProblem(TestScenario::rrtRoute(), 2500.0, VectorF{500.0, 500.0}, 45.0, sMap, vessel));
+    }
+}
+
+//----------
+ParallelRrtQTests::ParallelRrtQTests()
+{
+
+}
+
+//----------
+ParallelRrtQTests::~ParallelRrtQTests()
+{
+    cleanUp();
+}
+
+//----------
+void ParallelRrtQTests::setup()
+{
+
+}
+
+//----------
+void ParallelRrtQTests::cleanUp()
+{
+
+}
+
+//----------
+void ParallelRrtQTests::verify_solve_data()
+{
+    QTest::addColumn<int>("nThread");
+
+    QTest::newRow("1 thread") << 1;
+    QTest::newRow("4 threads") << 4;
+    QTest::newRow("ideal thread count") << 0;
+}
+
+//----------
+void ParallelRrtQTests::verify_solve()
+{
+    QFETCH(int, nThread);
+
+    SMap sMap;
+    Vessel vessel;
+    ObstacleSet obstacleSet;
+    QVERIFY(buildProblem(sMap, vessel, obstacleSet));
+
+    ParallelRrt parallelRrt;
+    parallelRrt.setSMap(sMap);
+    parallelRrt.setVessel(vessel);
+    parallelRrt.setObstacleSet(obstacleSet);
+    parallelRrt.setSeed(7);
+    parallelRrt.setThreadCount(nThread);
+    QString desc;
+    QVERIFY2(parallelRrt.solve(&desc), qPrintable(desc));
+    QVERIFY(parallelRrt.isSolved());
+    int nTree_expect = nThread > 0? nThread : std::max(QThread::idealThreadCount(), 1);
+    QCOMPARE(parallelRrt.nTree(), nTree_expect);
+    QCOMPARE(parallelRrt.nIteration(), nTree_expect * RRT_MAX_ITERATION);
+    QVERIFY(parallelRrt.elapsed_ms() > 0.0);
+    QVERIFY(parallelRrt.nodeRate() > 0.0);
+
+    //each tree runs as an RrtStar with its own seed, the best is the cheapest
+    int nNode{};
+    for(int t = 0; t < parallelRrt.nTree(); ++t){
+        const RrtStar& tree = parallelRrt.tree(t);
+        nNode += tree.nNode();
+        if(tree.isSolved()){
+            QVERIFY(parallelRrt.cost() <= tree.cost());
+        }
+    }
+    QCOMPARE(parallelRrt.nNode(), nNode);
+    QVERIFY(parallelRrt.bestTree() >= 0);
+    QCOMPARE(parallelRrt.cost(), parallelRrt.tree(parallelRrt.bestTree()).cost());
+
+    RrtStar rrtStar;
+    rrtStar.setSMap(sMap);
+    rrtStar.setVessel(vessel);
+    rrtStar.setObstacleSet(obstacleSet);
+    rrtStar.setSeed(ParallelRrt::treeSeed(7, 0));
+    rrtStar.solve();
+    QCOMPARE(parallelRrt.tree(0).nNode(), rrtStar.nNode());
+    QCOMPARE(parallelRrt.tree(0).cost(), rrtStar.cost());
+
+    Plan plan;
+    QVERIFY(parallelRrt.path(plan));
+    QCOMPARE(plan.wayptList().first().coord_const_ref(), Vec2(500.0, 500.0));
+    QVERIFY(std::abs(plan.length() - parallelRrt.cost()) < 1e-6);
+
+    //reproducible for a given seed and thread count
+    ParallelRrt parallelRrtCopy(parallelRrt);
+    QVERIFY(parallelRrtCopy.solve());
+    QCOMPARE(parallelRrtCopy.nNode(), parallelRrt.nNode());
+    QCOMPARE(parallelRrtCopy.bestTree(), parallelRrt.bestTree());
+    QCOMPARE(parallelRrtCopy.cost(), parallelRrt.cost());
+}
+
+//----------
+void ParallelRrtQTests::verify_notSet()
+{
+    ParallelRrt parallelRrt;
+    parallelRrt.setThreadCount(2);
+    QString desc;
+    QVERIFY(!parallelRrt.solve(&desc));
+    QVERIFY(desc.startsWith("[RrtStar::solve]"));
+    QVERIFY(!parallelRrt.isSolved());
+    QCOMPARE(parallelRrt.cost(), -1.0);
+    QCOMPARE(parallelRrt.nNode(), 0);
+    Plan plan;
+    QVERIFY(!parallelRrt.path(plan));
+}
@@ -0,0 +1,25 @@
+#ifndef RRTPLANNER_LIB_PARALLELRRTQTESTS_H
+#define RRTPLANNER_LIB_PARALLELRRTQTESTS_H
+
+#include <QObject>
+#include <QScopedPointer>
+
+class ParallelRrtQTests : public QObject
+{
+    Q_OBJECT
+
+public:
+    ParallelRrtQTests();
+    ~ParallelRrtQTests();
+
+private:
+    void setup();
+    void cleanUp();
+
+private slots:
+    void verify_solve_data();
+    void verify_solve();
+    void verify_notSet();
+};
+
+#endif
@@ -0,0 +1,341 @@
+#include "RrtStarQTests.h"
+#include "TestScenario.h"
+#include <RrtPlannerLib/framework/algorithm/rrt/RrtStar.h>
+#include <RrtPlannerLib/framework/algorithm/rrt/internal/InformedSampling.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/ObstacleSet.h>
+#include <RrtPlannerLib/framework/algorithm/gjk/Polygon.h>
+#include <RrtPlannerLib/framework/EllMap.h>
+#include <RrtPlannerLib/framework/RootData.h>
+#include <RrtPlannerLib/framework/SMap.h>
+#include <RrtPlannerLib/framework/vessel.h>
+#include <QtTest/QtTest>
+#include <QElapsedTimer>
+#include <QtGlobal>
+#include <cmath>
+#include <random>
+#include <math.h> //for M_PI
+
+
+using namespace rrtplanner::framework;
+using namespace rrtplanner::framework::algorithm::gjk;
+using namespace rrtplanner::framework::algorithm::rrt;
+
+namespace {
+    const double VES_LENGTH = TestScenario::RRT_VES_LENGTH;
+    const double VES_WIDTH = TestScenario::RRT_VES_WIDTH;
+
+    //the nominal plan and SMap of SMapQTests, with the vessel on the first segment of the nominal plan
+    bool buildProblem(SMap& sMap, Vessel& vessel)
+    {
+        return(TestScenario::rrtProblem(TestScenario::rrtRoute(), 2500.0, VectorF{500.0, 500.0}, 45.0, sMap, vessel));
+    }
+
+    //footprint at the given position, aligned with the heading of dir
+    Polygon footprint(const Vec2& posNE, const Vec2& dir)
+    {
+        double theta = std::atan2(dir[1], dir[0]);
+        Polygon ret;
+        for(double u: {-0.5 * VES_LENGTH, 0.5 * VES_LENGTH}){
+            for(double v: {-0.5 * VES_WIDTH, 0.5 * VES_WIDTH}){
+                ret.vertexList().append(posNE + Vec2(-u*std::cos(theta) - v*std::sin(theta),
+                                                     -u*std::sin(theta) + v*std::cos(theta)));
+            }
+        }
+        return(ret);
+    }
+}
+
+//----------
+RrtStarQTests::RrtStarQTests()
+{
+
+}
+
+//----------
+RrtStarQTests::~RrtStarQTests()
+{
+    cleanUp();
+}
+
+//----------
+void RrtStarQTests::setup()
+{
+
+}
+
+//----------
+void RrtStarQTests::cleanUp()
+{
+
+}
+
+//----------
+void RrtStarQTests::verify_solve_data()
+{
+    QTest::addColumn<QVector<Polygon>>("obstacleList");
+    QTest::addColumn<double>("clearance");
+
+    QVector<Polygon> box{
+        Polygon{Vec2(1300.0, 700.0), Vec2(1700.0, 700.0), Vec2(1700.0, 1300.0), Vec2(1300.0, 1300.0)}
+    };
+    QVector<Polygon> scattered{
+        Polygon{Vec2(900.0, 850.0), Vec2(1100.0, 850.0), Vec2(1000.0, 1050.0)},
+        Polygon{Vec2(1500.0, 600.0), Vec2(1700.0, 600.0), Vec2(1700.0, 800.0), Vec2(1500.0, 800.0)},
+        Polygon{Vec2(2200.0, 700.0), Vec2(2400.0, 900.0), Vec2(2300.0, 400.0)}
+    };
+
+    QTest::newRow("open water") << QVector<Polygon>{} << 0.0;
+    QTest::newRow("box on the route") << box << 0.0;
+    QTest::newRow("box on the route, clearance") << box << 30.0;
+    QTest::newRow("scattered obstacles") << scattered << 10.0;
+}
+
+//----------
+void RrtStarQTests::verify_solve()
+{
+    QFETCH(QVector<Polygon>, obstacleList);
+    QFETCH(double, clearance);
+
+    SMap sMap;
+    Vessel vessel;
+    QVERIFY(buildProblem(sMap, vessel));
+    ObstacleSet obstacleSet;
+    for(const Polygon& obstacle: obstacleList){
+        obstacleSet.append(obstacle);
+    }
+
+    RrtStar rrtStar;
+    rrtStar.setSMap(sMap);
+    rrtStar.setVessel(vessel);
+    rrtStar.setObstacleSet(obstacleSet);
+    rrtStar.setClearance(clearance);
+    rrtStar.setSeed(7);
+    QString desc;
+    QVERIFY2(rrtStar.solve(&desc), qPrintable(desc));
+    QVERIFY(rrtStar.isSolved());
+    QCOMPARE(rrtStar.nIteration(), RRT_MAX_ITERATION);
+    QVERIFY(rrtStar.nNode() > 1 && rrtStar.nNode() <= RRT_MAX_ITERATION + 1);
+
+    //the tree: costs are path lengths, nodes inside the EllMap
+    const EllMap& ellMap = sMap.ellMap();
+    const double stepMax = RRT_STEP_FRACTION * sMap.lh0();
+    QCOMPARE(rrtStar.nodePosNE(0), Vec2(500.0, 500.0));
+    QCOMPARE(rrtStar.nodeParent(0), -1);
+    QCOMPARE(rrtStar.nodeCost(0), 0.0);
+    for(int idx = 1; idx < rrtStar.nNode(); ++idx){
+        int parent = rrtStar.nodeParent(idx);
+        QVERIFY(parent >= 0 && parent < rrtStar.nNode());
+        double edgeLength = (rrtStar.nodePosNE(idx) - rrtStar.nodePosNE(parent)).norm2();
+        QVERIFY(edgeLength <= stepMax + 1e-6);
+        QVERIFY(std::abs(rrtStar.nodeCost(idx) - rrtStar.nodeCost(parent) - edgeLength) < 1e-6);
+        int planIdx, segIdx;
+        QVERIFY(ellMap.locateSector(rrtStar.nodePosNE(idx), 0, 0, planIdx, segIdx));
+    }
+
+    //the path: from the vessel to the goal, its length is the cost
+    Plan plan;
+    QVERIFY2(rrtStar.path(plan, &desc), qPrintable(desc));
+    QVector<Waypt> wayptList = plan.wayptList();
+    QVERIFY(wayptList.size() >= 2);
+    QCOMPARE(wayptList.first().coord_const_ref(), Vec2(500.0, 500.0));
+    QVERIFY(std::abs(plan.length() - rrtStar.cost()) < 1e-6);
+
+    //default goal: on the nominal plan, at the arclength horizon ahead of the vessel
+    RootData rootData;
+    QVERIFY(ellMap.getRootData(vessel.posNE(), rootData));
+    Vec2 goalNE;
+    QVERIFY(ellMap.getPosNE(0.0, rootData.ell() + sMap.lh0(), goalNE));
+    QVERIFY((wayptList.last().coord_const_ref() - goalNE).norm2() <= 0.5 * stepMax + 1e-6);
+
+    //edges against poses sampled every metre, with the footprint aligned to the edge
+    QVector<int> hitIdxList;
+    for(int k = 1; k < wayptList.size(); ++k){
+        Vec2 posA = wayptList.at(k - 1).coord_const_ref();
+        Vec2 posB = wayptList.at(k).coord_const_ref();
+        int nStep = static_cast<int>(std::ceil((posB - posA).norm2()));
+        for(int s = 0; s <= nStep; ++s){
+            Vec2 pos = posA + (static_cast<double>(s) / nStep) * (posB - posA);
+            QCOMPARE(obstacleSet.chkIntersect(footprint(pos, posB - posA), hitIdxList, nullptr, clearance - 1e-6), 0);
+        }
+    }
+
+    //close to the straight line in open water
+    double straight = (wayptList.last().coord_const_ref() - Vec2(500.0, 500.0)).norm2();
+    QVERIFY(rrtStar.cost() >= straight - 1e-6);
+    if(obstacleList.isEmpty()){
+        QVERIFY(rrtStar.cost() < 1.1 * straight);
+    }
+
+    //reproducible for a given seed
+    RrtStar rrtStarCopy(rrtStar);
+    QVERIFY(rrtStarCopy.solve());
+    QCOMPARE(rrtStarCopy.nNode(), rrtStar.nNode());
+    QCOMPARE(rrtStarCopy.cost(), rrtStar.cost());
+}
+
+//----------
+void RrtStarQTests::verify_budget()
+{
+    SMap sMap;
+    Vessel vessel;
+    QVERIFY(buildProblem(sMap, vessel));
+
+    //nothing to plan on
+    RrtStar rrtStar;
+    Plan plan;
+    QVERIFY(!rrtStar.solve());
+    QVERIFY(!rrtStar.isSolved());
+    QCOMPARE(rrtStar.cost(), -1.0);
+    QVERIFY(!rrtStar.path(plan));
+    rrtStar.setVessel(vessel);
+    QVERIFY(!rrtStar.solve());
+
+    //iteration budget
+    rrtStar.setSMap(sMap);
+    rrtStar.setMaxIteration(100);
+    rrtStar.solve();
+    QCOMPARE(rrtStar.nIteration(), 100);
+    QVERIFY(rrtStar.nNode() <= 101);
+
+    //time budget, the iteration budget out of reach
+    rrtStar.setMaxIteration(10000000);
+    rrtStar.setTimeBudget_ms(20);
+    QElapsedTimer timer;
+    timer.start();
+    rrtStar.solve();
+    QVERIFY(timer.elapsed() < 1000);
+    QVERIFY(rrtStar.nIteration() < 10000000);
+
+    //an explicit goal, reached with a short step
+    rrtStar.setTimeBudget_ms(0);
+    rrtStar.setMaxIteration(1000);
+    rrtStar.setStepMax(50.0);
+    rrtStar.setGoalBias(0.2);
+    rrtStar.setGoal(Vec2(900.0, 1000.0), 10.0);
+    QVERIFY(rrtStar.solve());
+    QVERIFY(rrtStar.path(plan));
+    QVERIFY((plan.wayptList().last().coord_const_ref() - Vec2(900.0, 1000.0)).norm2() <= 10.0);
+    for(int idx = 1; idx < rrtStar.nNode(); ++idx){
+        QVERIFY((rrtStar.nodePosNE(idx) - rrtStar.nodePosNE(rrtStar.nodeParent(idx))).norm2() <= 50.0 + 1e-6);
+    }
+
+    //a goal out of reach
+    rrtStar.setMaxIteration(200);
+    rrtStar.setGoal(Vec2(-5000.0, 8000.0), 10.0);
+    QVERIFY(!rrtStar.solve());
+    QVERIFY(!rrtStar.path(plan));
+}
+
+//----------
+void RrtStarQTests::verify_rootTurn()
+{
+    SMap sMap;
+    Vessel vessel;
+    QVERIFY(buildProblem(sMap, vessel));
+
+    //a post abeam to stbd, 9 m from the vessel heading 45 deg: clear of the hull, but the bow sweeps it if the vessel
+    //turns stbd past 111 deg, and the stern if it turns port past -21 deg
+    const Vec2 rootNE(500.0, 500.0);
+    const Vec2 postNE = rootNE + 9.0 * Vec2(std::cos(0.75 * M_PI), std::sin(0.75 * M_PI));
+    ObstacleSet obstacleSet;
+    obstacleSet.append(Polygon{postNE + Vec2(-0.5, -0.5), postNE + Vec2(0.5, -0.5), postNE + Vec2(0.5, 0.5),
+                               postNE + Vec2(-0.5, 0.5)});
+
+    //a goal behind the vessel, towards which the goal bias pulls the root edges
+    RrtStar rrtStar;
+    rrtStar.setSMap(sMap);
+    rrtStar.setVessel(vessel);
+    rrtStar.setObstacleSet(obstacleSet);
+    rrtStar.setStepMax(50.0);
+    rrtStar.setGoalBias(0.2);
+    rrtStar.setGoal(Vec2(350.0, 350.0), 10.0);
+    rrtStar.setMaxIteration(500);
+    rrtStar.solve();
+
+    int nRootChild{};
+    for(int idx = 1; idx < rrtStar.nNode(); ++idx){
+        if(rrtStar.nodeParent(idx) != 0){
+            continue;
+        }
+        ++nRootChild;
+        Vec2 edge = rrtStar.nodePosNE(idx) - rootNE;
+        double turn_deg = std::remainder(std::atan2(edge[1], edge[0]) * 180.0 / M_PI - 45.0, 360.0);
+        QVERIFY2(turn_deg > -66.0 && turn_deg < 66.0, qPrintable(QString::number(turn_deg)));
+    }
+    QVERIFY(nRootChild > 0);
+}
+
+//----------
+void RrtStarQTests::verify_informed()
+{
+    SMap sMap;
+    Vessel vessel;
+    QVERIFY(buildProblem(sMap, vessel));
+
+    //same seeds with and without informed sampling, in open water
+    for(quint32 seed = 1; seed <= 5; ++seed){
+        RrtStar rrtStar;
+        rrtStar.setSMap(sMap);
+        rrtStar.setVessel(vessel);
+        rrtStar.setSeed(seed);
+        QVERIFY(rrtStar.solve());
+        QCOMPARE(rrtStar.nInformedSample(), 0);
+        QCOMPARE(rrtStar.nInformedFallback(), 0);
+
+        RrtStar rrtStarInformed(rrtStar);
+        rrtStarInformed.setInformed(true);
+        QVERIFY(rrtStarInformed.isInformed());
+        QVERIFY(rrtStarInformed.solve());
+        QVERIFY(rrtStarInformed.nInformedSample() > 0);
+        QVERIFY(rrtStarInformed.nInformedSample() + rrtStarInformed.nInformedFallback() < rrtStarInformed.nIteration());
+
+        //a valid tree, with all nodes inside the EllMap
+        Plan plan;
+        QVERIFY(rrtStarInformed.path(plan));
+        QVERIFY(std::abs(plan.length() - rrtStarInformed.cost()) < 1e-6);
+        for(int idx = 1; idx < rrtStarInformed.nNode(); ++idx){
+            int planIdx, segIdx;
+            QVERIFY(sMap.ellMap().locateSector(rrtStarInformed.nodePosNE(idx), 0, 0, planIdx, segIdx));
+        }
+    }
+
+    //every informed sample is within the ellipse of the best cost and within the EllMap, whatever the stream
+    const Vec2 goalNE(1500.0, 1000.0);
+    const double goalRadius = 20.0;
+    const double areaMax = 1e7;
+    RrtStar rrtStarGoal;
+    rrtStarGoal.setSMap(sMap);
+    rrtStarGoal.setVessel(vessel);
+    rrtStarGoal.setGoal(goalNE, goalRadius);
+    rrtStarGoal.setInformed(true);
+    QVERIFY(rrtStarGoal.solve());
+    const Vec2 rootNE = vessel.posNE();
+    const RootData& rootData = sMap.rootData();
+    std::mt19937 rng(1);
+    Vec2 posNE;
+    for(double costBest: {rrtStarGoal.cost(), 1.01 * (goalNE - rootNE).norm2()}){
+        for(int k = 0; k < 1000; ++k){
+            QVERIFY(sampleInformed(rootNE, goalNE, goalRadius, costBest, areaMax, sMap.ellMap(), rootData.planIdx(),
+                                   rootData.segIdx(), rng, posNE));
+            QVERIFY((posNE - rootNE).norm2() + (posNE - goalNE).norm2() <= costBest + goalRadius + 1e-6);
+            int planIdx, segIdx;
+            QVERIFY(sMap.ellMap().locateSector(posNE, 0, 0, planIdx, segIdx));
+        }
+    }
+    //an ellipse larger than areaMax falls back to the SMap, without drawing
+    std::mt19937 rngCopy(rng);
+    QVERIFY(!sampleInformed(rootNE, goalNE, goalRadius, 1e5, areaMax, sMap.ellMap(), rootData.planIdx(),
+                            rootData.segIdx(), rng, posNE));
+    QVERIFY(rng == rngCopy);
+
+    //no path, no informed sample: the goal is out of reach
+    RrtStar rrtStar;
+    rrtStar.setSMap(sMap);
+    rrtStar.setVessel(vessel);
+    rrtStar.setInformed(true);
+    rrtStar.setMaxIteration(200);
+    rrtStar.setGoal(Vec2(-5000.0, 8000.0), 10.0);
+    QVERIFY(!rrtStar.solve());
+    QCOMPARE(rrtStar.nInformedSample(), 0);
+    QCOMPARE(rrtStar.nInformedFallback(), 0);
+}
@@ -0,0 +1,27 @@
+#ifndef RRTPLANNER_LIB_RRTSTARQTESTS_H
+#define RRTPLANNER_LIB_RRTSTARQTESTS_H
+
+#include <QObject>
+#include <QScopedPointer>
+
+class RrtStarQTests : public QObject
+{
+    Q_OBJECT
+
+public:
+    RrtStarQTests();
+    ~RrtStarQTests();
+
+private:
+    void setup();
+    void cleanUp();
+
+private slots:
+    void verify_solve_data();
+    void verify_solve();
+    void verify_budget();
+    void verify_rootTurn();
+    void verify_informed();
+};
+
+#endif
@@ -1,21 +1,35 @@
 #include "WayptQTests.h"
 #include "SegmentQTests.h"
+#include "SegmentArraysQTests.h"
+#include "SectorTableQTests.h"
+#include "SectorGridQTests.h"
 #include "PlanQTests.h"
 #include "PlanHelperQTests.h"
 #include "UblasHelperQTests.h"
 #include "VectorFQTests.h"
+#include "Vec2QTests.h"
+#include "Vec2HelperQTests.h"
 #include "VectorFHelperQTests.h"
 #include "EllMapQTests.h"
 #include "SMapQTests.h"
 #include "SMapHelperQTests.h"
+#include "SMapSamplerQTests.h"
 
 #include "VesRectangleQTests.h"
 #include "VesselQTests.h"
 #include "RootDataQTests.h"
 
 #include "PolygonQTests.h"
+#include "ConvexPolygonQTests.h"
 #include "SimplexQTests.h"
 #include "GjkQTests.h"
+#include "ObstacleSetQTests.h"
+#include "GjkBatchQTests.h"
+#include "CSpaceObstacleSetQTests.h"
+#include "SignedDistanceGridQTests.h"
+#include "KdTreeQTests.h"
+#include "RrtStarQTests.h"
+#include "ParallelRrtQTests.h"
 #include <QtTest/QtTest>
 
 int main(int argc, char* argv[])
@@ -23,43 +37,73 @@ int main(int argc, char* argv[])
     QApplication app(argc, argv);
 
     VectorFQTests       vectorFQTests;
+    Vec2QTests          vec2QTests;
+    Vec2HelperQTests    vec2HelperQTests;
     VectorFHelperQTests vectorFHelperQTests;
     WayptQTests         wayptQTests;
     SegmentQTests       segmentQTests;
+    SegmentArraysQTests segmentArraysQTests;
+    SectorTableQTests   sectorTableQTests;
+    SectorGridQTests    sectorGridQTests;
     PlanQTests          planQTests;
     PlanHelperQTests    planHelperQTests;
     UblasHelperQTests   linearAlgebraHelperQTests;
     EllMapQTests        ellMapQTests;
     SMapQTests          sMapQTests;
     SMapHelperQTests    sMapHelperQTests;
+    SMapSamplerQTests   sMapSamplerQTests;
 
     VesRectangleQTests  vesRectangleQTests;
     VesselQTests        vesselQTests;
     RootDataQTests      rootDataQTests;
 
     PolygonQTests       polygonQTests;
+    ConvexPolygonQTests convexPolygonQTests;
     SimplexQTests       simplexQTests;
     GjkQTests           gjkQTests;
+    ObstacleSetQTests   obstacleSetQTests;
+    GjkBatchQTests      gjkBatchQTests;
+    CSpaceObstacleSetQTests cSpaceObstacleSetQTests;
+    SignedDistanceGridQTests signedDistanceGridQTests;
+
+    KdTreeQTests        kdTreeQTests;
+    RrtStarQTests       rrtStarQTests;
+    ParallelRrtQTests   parallelRrtQTests;
 
     int status = \
             QTest::qExec(&vectorFQTests, argc, argv) + \
+            QTest::qExec(&vec2QTests, argc, argv) + \
+            QTest::qExec(&vec2HelperQTests, argc, argv) + \
             QTest::qExec(&vectorFHelperQTests, argc, argv) + \
             QTest::qExec(&wayptQTests, argc, argv) + \
             QTest::qExec(&segmentQTests, argc, argv) + \
+            QTest::qExec(&segmentArraysQTests, argc, argv) + \
+            QTest::qExec(&sectorTableQTests, argc, argv) + \
+            QTest::qExec(&sectorGridQTests, argc, argv) + \
             QTest::qExec(&planQTests, argc, argv) + \
             QTest::qExec(&planHelperQTests, argc, argv) + \
             QTest::qExec(&linearAlgebraHelperQTests, argc, argv) + \
             QTest::qExec(&ellMapQTests, argc, argv) + \
             QTest::qExec(&sMapQTests, argc, argv) + \
             QTest::qExec(&sMapHelperQTests, argc, argv) + \
+            QTest::qExec(&sMapSamplerQTests, argc, argv) + \
 
             QTest::qExec(&vesRectangleQTests, argc, argv) + \
             QTest::qExec(&vesselQTests, argc, argv) + \
             QTest::qExec(&rootDataQTests, argc, argv) + \
 
             QTest::qExec(&polygonQTests, argc, argv) + \
+            QTest::qExec(&convexPolygonQTests, argc, argv) + \
             QTest::qExec(&simplexQTests, argc, argv) + \
-            QTest::qExec(&gjkQTests, argc, argv);
+            QTest::qExec(&gjkQTests, argc, argv) + \
+            QTest::qExec(&obstacleSetQTests, argc, argv) + \
+            QTest::qExec(&gjkBatchQTests, argc, argv) + \
+            QTest::qExec(&cSpaceObstacleSetQTests, argc, argv) + \
+            QTest::qExec(&signedDistanceGridQTests, argc, argv) + \
+
+            QTest::qExec(&kdTreeQTests, argc, argv) + \
+            QTest::qExec(&rrtStarQTests, argc, argv) + \
+            QTest::qExec(&parallelRrtQTests, argc, argv);
 
     return status;
 }